@@ -0,0 +1,611 @@
+/**
+ * @file MatrixBenchmarks.cpp
+ * @brief Google Benchmark suite for RealMatrix operations and file I/O
+ * @author Shchurko
+ * @date 2025
+ */
+
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "matrix/Matrix.h"
+#include "matrix/MatrixBatch.h"
+#include "matrix/Svd.h"
+#include "matrix/SymmetricEigen.h"
+
+// Каждый замер - квадратные матрицы n x n, n от 8 до 4096 с шагом x2.
+// Счётчики: FLOPS - операции с плавающей точкой в секунду (в выводе
+// 56.1G/s - это 56.1 GFLOP/s), bytes_per_second - минимальный объём данных,
+// который операция обязана прочитать и записать.
+// Для сравнения сборок: --benchmark_out=result.json --benchmark_out_format=json
+// и tools/compare.py из Google Benchmark
+
+namespace {
+
+constexpr std::int64_t MIN_SIZE = 8;
+constexpr std::int64_t MAX_SIZE = 4096;
+
+void squareSizes(benchmark::internal::Benchmark* benchmark) {
+    benchmark->RangeMultiplier(2)->Range(MIN_SIZE, MAX_SIZE);
+}
+
+// Детерминированные значения: замеры разных сборок сравнимы
+RealMatrix makeMatrix(std::size_t n, double seed) {
+    RealMatrix m(n, n);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            m.setValue(i, j, std::sin(seed + 0.37 * static_cast<double>(i) + 1.11 * static_cast<double>(j)));
+        }
+    }
+    return m;
+}
+
+// Хорошо обусловленная матрица для определителя
+RealMatrix makeDominantMatrix(std::size_t n) {
+    RealMatrix m = makeMatrix(n, 0.5);
+    for (std::size_t i = 0; i < n; ++i) {
+        m.setValue(i, i, m.getValue(i, i) + static_cast<double>(n));
+    }
+    return m;
+}
+
+// Нормированная матрица Адамара (n - степень двойки): плотная и
+// ортогональная, поэтому не попадает на быстрые пути для диагональных
+// матриц и не меняет масштаб значений при повторном умножении
+RealMatrix makeHadamardMatrix(std::size_t n) {
+    RealMatrix m(n, n);
+    const double scale = 1.0 / std::sqrt(static_cast<double>(n));
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            std::size_t bits = i & j;
+            bool negative = false;
+            while (bits != 0) {
+                negative = !negative;
+                bits &= bits - 1;
+            }
+            m.setValue(i, j, negative ? -scale : scale);
+        }
+    }
+    return m;
+}
+
+RealMatrix makeSymmetricMatrix(std::size_t n) {
+    RealMatrix m = makeMatrix(n, 1.5);
+    return m + m.computeTranspose();
+}
+
+std::size_t sizeOf(const benchmark::State& state) {
+    return static_cast<std::size_t>(state.range(0));
+}
+
+double elementsOf(const benchmark::State& state) {
+    const double n = static_cast<double>(state.range(0));
+    return n * n;
+}
+
+void setCounters(benchmark::State& state, double flopsPerIteration, double bytesPerIteration) {
+    if (flopsPerIteration > 0.0) {
+        state.counters["FLOPS"] = benchmark::Counter(flopsPerIteration,
+                                                     benchmark::Counter::kIsIterationInvariantRate);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>(bytesPerIteration));
+}
+
+// Для файловых замеров: размер записанного файла в байтах
+long fileSize(const std::string& filename) {
+    std::FILE* file = std::fopen(filename.c_str(), "rb");
+    if (file == nullptr) {
+        return 0;
+    }
+    std::fseek(file, 0, SEEK_END);
+    const long size = std::ftell(file);
+    std::fclose(file);
+    return size;
+}
+
+std::string benchmarkFile(const char* name, const benchmark::State& state) {
+    return std::string("matrix_bench_") + name + "_" + std::to_string(state.range(0)) + ".tmp";
+}
+
+// ==================== Поэлементная арифметика ====================
+void BM_Add(benchmark::State& state) {
+    const RealMatrix a = makeMatrix(sizeOf(state), 0.1);
+    const RealMatrix b = makeMatrix(sizeOf(state), 0.2);
+    for (auto _ : state) {
+        RealMatrix c = a + b;
+        benchmark::DoNotOptimize(c.getData());
+    }
+    setCounters(state, elementsOf(state), 3 * elementsOf(state) * sizeof(double));
+}
+BENCHMARK(BM_Add)->Apply(squareSizes);
+
+void BM_Subtract(benchmark::State& state) {
+    const RealMatrix a = makeMatrix(sizeOf(state), 0.1);
+    const RealMatrix b = makeMatrix(sizeOf(state), 0.2);
+    for (auto _ : state) {
+        RealMatrix c = a - b;
+        benchmark::DoNotOptimize(c.getData());
+    }
+    setCounters(state, elementsOf(state), 3 * elementsOf(state) * sizeof(double));
+}
+BENCHMARK(BM_Subtract)->Apply(squareSizes);
+
+void BM_ScalarMultiply(benchmark::State& state) {
+    const RealMatrix a = makeMatrix(sizeOf(state), 0.1);
+    for (auto _ : state) {
+        RealMatrix c = a * 1.5;
+        benchmark::DoNotOptimize(c.getData());
+    }
+    setCounters(state, elementsOf(state), 2 * elementsOf(state) * sizeof(double));
+}
+BENCHMARK(BM_ScalarMultiply)->Apply(squareSizes);
+
+void BM_ScalarDivide(benchmark::State& state) {
+    const RealMatrix a = makeMatrix(sizeOf(state), 0.1);
+    for (auto _ : state) {
+        RealMatrix c = a / 1.5;
+        benchmark::DoNotOptimize(c.getData());
+    }
+    setCounters(state, elementsOf(state), 2 * elementsOf(state) * sizeof(double));
+}
+BENCHMARK(BM_ScalarDivide)->Apply(squareSizes);
+
+// Составные операторы работают на месте: матрица накапливает значения
+// между итерациями, но объём работы от этого не зависит
+void BM_CompoundAdd(benchmark::State& state) {
+    RealMatrix a = makeMatrix(sizeOf(state), 0.1);
+    const RealMatrix b = makeMatrix(sizeOf(state), 0.2);
+    for (auto _ : state) {
+        a += b;
+        benchmark::ClobberMemory();
+    }
+    setCounters(state, elementsOf(state), 3 * elementsOf(state) * sizeof(double));
+}
+BENCHMARK(BM_CompoundAdd)->Apply(squareSizes);
+
+void BM_CompoundSubtract(benchmark::State& state) {
+    RealMatrix a = makeMatrix(sizeOf(state), 0.1);
+    const RealMatrix b = makeMatrix(sizeOf(state), 0.2);
+    for (auto _ : state) {
+        a -= b;
+        benchmark::ClobberMemory();
+    }
+    setCounters(state, elementsOf(state), 3 * elementsOf(state) * sizeof(double));
+}
+BENCHMARK(BM_CompoundSubtract)->Apply(squareSizes);
+
+void BM_CompoundScale(benchmark::State& state) {
+    RealMatrix a = makeMatrix(sizeOf(state), 0.1);
+    for (auto _ : state) {
+        a *= -1.0;
+        benchmark::ClobberMemory();
+    }
+    setCounters(state, elementsOf(state), 2 * elementsOf(state) * sizeof(double));
+}
+BENCHMARK(BM_CompoundScale)->Apply(squareSizes);
+
+void BM_CompoundDivide(benchmark::State& state) {
+    RealMatrix a = makeMatrix(sizeOf(state), 0.1);
+    for (auto _ : state) {
+        a /= -1.0;
+        benchmark::ClobberMemory();
+    }
+    setCounters(state, elementsOf(state), 2 * elementsOf(state) * sizeof(double));
+}
+BENCHMARK(BM_CompoundDivide)->Apply(squareSizes);
+
+void BM_PrefixIncrement(benchmark::State& state) {
+    RealMatrix a = makeMatrix(sizeOf(state), 0.1);
+    for (auto _ : state) {
+        ++a;
+        benchmark::ClobberMemory();
+    }
+    setCounters(state, elementsOf(state), 2 * elementsOf(state) * sizeof(double));
+}
+BENCHMARK(BM_PrefixIncrement)->Apply(squareSizes);
+
+void BM_PostfixDecrement(benchmark::State& state) {
+    RealMatrix a = makeMatrix(sizeOf(state), 0.1);
+    for (auto _ : state) {
+        RealMatrix previous = a--;
+        benchmark::DoNotOptimize(previous.getData());
+    }
+    setCounters(state, elementsOf(state), 2 * elementsOf(state) * sizeof(double));
+}
+BENCHMARK(BM_PostfixDecrement)->Apply(squareSizes);
+
+void BM_Equality(benchmark::State& state) {
+    const RealMatrix a = makeMatrix(sizeOf(state), 0.1);
+    const RealMatrix b = a;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a == b);
+    }
+    setCounters(state, 0.0, 2 * elementsOf(state) * sizeof(double));
+}
+BENCHMARK(BM_Equality)->Apply(squareSizes);
+
+// ==================== Умножение матриц ====================
+void BM_Multiply(benchmark::State& state) {
+    const RealMatrix a = makeMatrix(sizeOf(state), 0.1);
+    const RealMatrix b = makeMatrix(sizeOf(state), 0.2);
+    for (auto _ : state) {
+        RealMatrix c = a * b;
+        benchmark::DoNotOptimize(c.getData());
+    }
+    const double n = static_cast<double>(state.range(0));
+    setCounters(state, 2.0 * n * n * n, 3 * elementsOf(state) * sizeof(double));
+}
+BENCHMARK(BM_Multiply)->Apply(squareSizes)->Unit(benchmark::kMillisecond);
+
+// FLOPS считается по классическим 2n^3 операциям: так видно ускорение
+// относительно обычного умножения
+void BM_MultiplyStrassen(benchmark::State& state) {
+    const RealMatrix a = makeMatrix(sizeOf(state), 0.1);
+    const RealMatrix b = makeMatrix(sizeOf(state), 0.2);
+    for (auto _ : state) {
+        RealMatrix c = RealMatrix::multiplyStrassen(a.view(), b.view());
+        benchmark::DoNotOptimize(c.getData());
+    }
+    const double n = static_cast<double>(state.range(0));
+    setCounters(state, 2.0 * n * n * n, 3 * elementsOf(state) * sizeof(double));
+}
+BENCHMARK(BM_MultiplyStrassen)->RangeMultiplier(2)->Range(1024, MAX_SIZE)->Unit(benchmark::kMillisecond);
+
+void BM_CompoundMultiply(benchmark::State& state) {
+    RealMatrix a = makeMatrix(sizeOf(state), 0.1);
+    const RealMatrix rotation = makeHadamardMatrix(sizeOf(state));
+    for (auto _ : state) {
+        a *= rotation;
+        benchmark::ClobberMemory();
+    }
+    const double n = static_cast<double>(state.range(0));
+    setCounters(state, 2.0 * n * n * n, 3 * elementsOf(state) * sizeof(double));
+}
+BENCHMARK(BM_CompoundMultiply)->Apply(squareSizes)->Unit(benchmark::kMillisecond);
+
+// ==================== Транспонирование и определитель ====================
+void BM_Transpose(benchmark::State& state) {
+    const RealMatrix a = makeMatrix(sizeOf(state), 0.1);
+    for (auto _ : state) {
+        RealMatrix t = a.computeTranspose();
+        benchmark::DoNotOptimize(t.getData());
+    }
+    setCounters(state, 0.0, 2 * elementsOf(state) * sizeof(double));
+}
+BENCHMARK(BM_Transpose)->Apply(squareSizes);
+
+void BM_TransposeInPlace(benchmark::State& state) {
+    RealMatrix a = makeMatrix(sizeOf(state), 0.1);
+    for (auto _ : state) {
+        a.transposeInPlace();
+        benchmark::ClobberMemory();
+    }
+    setCounters(state, 0.0, 2 * elementsOf(state) * sizeof(double));
+}
+BENCHMARK(BM_TransposeInPlace)->Apply(squareSizes);
+
+// LU-разложение: 2/3 n^3 операций
+void BM_Determinant(benchmark::State& state) {
+    const RealMatrix a = makeDominantMatrix(sizeOf(state));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a.calculateDeterminant());
+    }
+    const double n = static_cast<double>(state.range(0));
+    setCounters(state, 2.0 / 3.0 * n * n * n, elementsOf(state) * sizeof(double));
+}
+BENCHMARK(BM_Determinant)->Apply(squareSizes)->Unit(benchmark::kMillisecond);
+
+// ==================== Свёртки ====================
+// Норма Фробениуса: попарная сумма квадратов, 2 n^2 операций
+void BM_FrobeniusNorm(benchmark::State& state) {
+    const RealMatrix a = makeMatrix(sizeOf(state), 0.1);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a.calculateNorm());
+    }
+    setCounters(state, 2.0 * elementsOf(state), elementsOf(state) * sizeof(double));
+}
+BENCHMARK(BM_FrobeniusNorm)->Apply(squareSizes);
+
+// Суммы столбцов: строки читаются подряд, группы строк складываются попарно
+void BM_ColumnSums(benchmark::State& state) {
+    const RealMatrix a = makeMatrix(sizeOf(state), 0.1);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a.reduceColumns(Reduction::Sum).data());
+    }
+    setCounters(state, elementsOf(state), elementsOf(state) * sizeof(double));
+}
+BENCHMARK(BM_ColumnSums)->Apply(squareSizes);
+
+// Копия с изменением одного элемента: state.range(1) = 1 - копирование
+// при записи, буфер копируется при setValue, а не при копировании
+void BM_CopyAndModify(benchmark::State& state) {
+    RealMatrix a = makeMatrix(sizeOf(state), 0.1);
+    a.setCopyOnWrite(state.range(1) != 0);
+    for (auto _ : state) {
+        RealMatrix copy(a);
+        copy.setValue(0, 0, 1.0);
+        benchmark::DoNotOptimize(copy.getData());
+    }
+    setCounters(state, 0.0, 2.0 * elementsOf(state) * sizeof(double));
+}
+BENCHMARK(BM_CopyAndModify)->ArgsProduct({{256, 1024}, {0, 1}});
+
+// Копии только для чтения: в режиме копирования при записи без копирования буфера
+void BM_CopyAndRead(benchmark::State& state) {
+    RealMatrix a = makeMatrix(sizeOf(state), 0.1);
+    a.setCopyOnWrite(state.range(1) != 0);
+    for (auto _ : state) {
+        const RealMatrix copy(a);
+        benchmark::DoNotOptimize(copy.getValue(1, 1));
+    }
+}
+BENCHMARK(BM_CopyAndRead)->ArgsProduct({{256, 1024}, {0, 1}});
+
+// ==================== Собственные значения ====================
+void eigenSizes(benchmark::internal::Benchmark* benchmark) {
+    benchmark->RangeMultiplier(2)->Range(64, 2048)->Unit(benchmark::kMillisecond);
+}
+
+// Приведение к трёхдиагональному виду: 4/3 n^3 операций, QL - O(n^2)
+void BM_SymmetricEigenvalues(benchmark::State& state) {
+    const RealMatrix a = makeSymmetricMatrix(sizeOf(state));
+    for (auto _ : state) {
+        SymmetricEigenDecomposition eigen(a, false);
+        benchmark::DoNotOptimize(eigen.getEigenvalues().data());
+    }
+    const double n = static_cast<double>(state.range(0));
+    setCounters(state, 4.0 / 3.0 * n * n * n, elementsOf(state) * sizeof(double));
+}
+BENCHMARK(BM_SymmetricEigenvalues)->Apply(eigenSizes);
+
+// Число операций «разделяй и властвуй» зависит от отделения, FLOPS не считается
+void BM_SymmetricEigenvectors(benchmark::State& state) {
+    const RealMatrix a = makeSymmetricMatrix(sizeOf(state));
+    for (auto _ : state) {
+        SymmetricEigenDecomposition eigen(a);
+        benchmark::DoNotOptimize(eigen.getEigenvalues().data());
+    }
+    setCounters(state, 0.0, 2 * elementsOf(state) * sizeof(double));
+}
+BENCHMARK(BM_SymmetricEigenvectors)->Apply(eigenSizes);
+
+// ==================== Сингулярное разложение ====================
+// Число циклов Якоби зависит от спектра, FLOPS не считается
+void BM_JacobiSvd(benchmark::State& state) {
+    const RealMatrix a = makeMatrix(sizeOf(state), 0.5);
+    for (auto _ : state) {
+        SingularValueDecomposition svd(a);
+        benchmark::DoNotOptimize(svd.getSingularValues().data());
+    }
+    setCounters(state, 0.0, 3 * elementsOf(state) * sizeof(double));
+}
+BENCHMARK(BM_JacobiSvd)->RangeMultiplier(2)->Range(64, 512)->Unit(benchmark::kMillisecond);
+
+// Первые 20 троек высокой матрицы m x 500: 6 проходов по A при двух
+// степенных итерациях
+void BM_RandomizedSvd(benchmark::State& state) {
+    const std::size_t rows = sizeOf(state);
+    const std::size_t cols = 500;
+    RealMatrix a(rows, cols);
+    for (std::size_t i = 0; i < rows; ++i) {
+        for (std::size_t j = 0; j < cols; ++j) {
+            a.setValue(i, j, std::sin(0.37 * static_cast<double>(i) + 1.11 * static_cast<double>(j) +
+                                      0.001 * static_cast<double>(i * j)));
+        }
+    }
+    for (auto _ : state) {
+        const SingularValueDecomposition svd = SingularValueDecomposition::computeRandomized(a, 20);
+        benchmark::DoNotOptimize(svd.getSingularValues().data());
+    }
+    const double elements = static_cast<double>(rows * cols);
+    setCounters(state, 6.0 * 2.0 * 30.0 * elements, 6.0 * elements * sizeof(double));
+}
+BENCHMARK(BM_RandomizedSvd)->Arg(5000)->Arg(20000)->Arg(50000)->Unit(benchmark::kMillisecond);
+
+// ==================== Проверки свойств ====================
+// Проверкам даются матрицы, на которых ответ true: так просматривается вся
+// матрица. Диагональность, симметричность и треугольность кэшируются,
+// поэтому перед каждой проверкой кэш сбрасывается записью элемента
+template <typename Predicate>
+void runPredicate(benchmark::State& state, RealMatrix& matrix, Predicate predicate) {
+    const double corner = matrix.getValue(0, 0);
+    for (auto _ : state) {
+        matrix.setValue(0, 0, corner);
+        benchmark::DoNotOptimize(predicate(matrix));
+    }
+    setCounters(state, 0.0, elementsOf(state) * sizeof(double));
+}
+
+void BM_CheckIsSymmetric(benchmark::State& state) {
+    RealMatrix m = makeSymmetricMatrix(sizeOf(state));
+    runPredicate(state, m, [](const RealMatrix& x) { return x.checkIsSymmetric(); });
+}
+BENCHMARK(BM_CheckIsSymmetric)->Apply(squareSizes);
+
+void BM_CheckIsDiagonal(benchmark::State& state) {
+    RealMatrix m = RealMatrix::createIdentity(sizeOf(state));
+    runPredicate(state, m, [](const RealMatrix& x) { return x.checkIsDiagonal(); });
+}
+BENCHMARK(BM_CheckIsDiagonal)->Apply(squareSizes);
+
+void BM_CheckIsUpperTriangular(benchmark::State& state) {
+    RealMatrix m = RealMatrix::createIdentity(sizeOf(state));
+    m.setValue(0, sizeOf(state) - 1, 1.0);
+    runPredicate(state, m, [](const RealMatrix& x) { return x.checkIsUpperTriangular(); });
+}
+BENCHMARK(BM_CheckIsUpperTriangular)->Apply(squareSizes);
+
+void BM_CheckIsLowerTriangular(benchmark::State& state) {
+    RealMatrix m = RealMatrix::createIdentity(sizeOf(state));
+    m.setValue(sizeOf(state) - 1, 0, 1.0);
+    runPredicate(state, m, [](const RealMatrix& x) { return x.checkIsLowerTriangular(); });
+}
+BENCHMARK(BM_CheckIsLowerTriangular)->Apply(squareSizes);
+
+void BM_CheckIsIdentity(benchmark::State& state) {
+    RealMatrix m = RealMatrix::createIdentity(sizeOf(state));
+    runPredicate(state, m, [](const RealMatrix& x) { return x.checkIsIdentity(); });
+}
+BENCHMARK(BM_CheckIsIdentity)->Apply(squareSizes);
+
+void BM_CheckIsZero(benchmark::State& state) {
+    RealMatrix m(sizeOf(state), sizeOf(state), 0.0);
+    runPredicate(state, m, [](const RealMatrix& x) { return x.checkIsZero(); });
+}
+BENCHMARK(BM_CheckIsZero)->Apply(squareSizes);
+
+// Внутри - умножение на транспонированную: 2n^3 операций
+void BM_CheckIsOrthogonal(benchmark::State& state) {
+    RealMatrix m = makeHadamardMatrix(sizeOf(state));
+    runPredicate(state, m, [](const RealMatrix& x) { return x.checkIsOrthogonal(); });
+    const double n = static_cast<double>(state.range(0));
+    state.counters["FLOPS"] = benchmark::Counter(2.0 * n * n * n, benchmark::Counter::kIsIterationInvariantRate);
+}
+BENCHMARK(BM_CheckIsOrthogonal)->Apply(squareSizes)->Unit(benchmark::kMillisecond);
+
+// ==================== Файловый ввод-вывод ====================
+// bytes_per_second считается по размеру файла
+void BM_WriteText(benchmark::State& state) {
+    const RealMatrix a = makeMatrix(sizeOf(state), 0.1);
+    const std::string filename = benchmarkFile("write_text", state);
+    for (auto _ : state) {
+        if (!a.writeToFile(filename)) {
+            state.SkipWithError("writeToFile failed");
+            break;
+        }
+    }
+    setCounters(state, 0.0, static_cast<double>(fileSize(filename)));
+    std::remove(filename.c_str());
+}
+BENCHMARK(BM_WriteText)->Apply(squareSizes)->Unit(benchmark::kMillisecond);
+
+void BM_ReadText(benchmark::State& state) {
+    const std::string filename = benchmarkFile("read_text", state);
+    makeMatrix(sizeOf(state), 0.1).writeToFile(filename);
+    RealMatrix loaded;
+    for (auto _ : state) {
+        if (!loaded.readFromFile(filename)) {
+            state.SkipWithError("readFromFile failed");
+            break;
+        }
+    }
+    setCounters(state, 0.0, static_cast<double>(fileSize(filename)));
+    std::remove(filename.c_str());
+}
+BENCHMARK(BM_ReadText)->Apply(squareSizes)->Unit(benchmark::kMillisecond);
+
+void BM_SaveBinary(benchmark::State& state) {
+    const RealMatrix a = makeMatrix(sizeOf(state), 0.1);
+    const std::string filename = benchmarkFile("save_binary", state);
+    for (auto _ : state) {
+        if (!a.saveBinary(filename)) {
+            state.SkipWithError("saveBinary failed");
+            break;
+        }
+    }
+    setCounters(state, 0.0, static_cast<double>(fileSize(filename)));
+    std::remove(filename.c_str());
+}
+BENCHMARK(BM_SaveBinary)->Apply(squareSizes)->Unit(benchmark::kMillisecond);
+
+void BM_LoadBinary(benchmark::State& state) {
+    const std::string filename = benchmarkFile("load_binary", state);
+    makeMatrix(sizeOf(state), 0.1).saveBinary(filename);
+    RealMatrix loaded;
+    for (auto _ : state) {
+        if (!loaded.loadBinary(filename)) {
+            state.SkipWithError("loadBinary failed");
+            break;
+        }
+    }
+    setCounters(state, 0.0, static_cast<double>(fileSize(filename)));
+    std::remove(filename.c_str());
+}
+BENCHMARK(BM_LoadBinary)->Apply(squareSizes)->Unit(benchmark::kMillisecond);
+
+// ==================== Пакеты малых матриц ====================
+// BATCH_COUNT матриц n x n; BM_LoopMultiply - та же работа циклом по RealMatrix
+constexpr std::size_t BATCH_COUNT = 4096;
+
+void batchSizes(benchmark::internal::Benchmark* benchmark) {
+    benchmark->Arg(4)->Arg(6)->Arg(8)->Arg(16);
+}
+
+std::vector<RealMatrix> makeBatchMatrices(std::size_t n, double seed) {
+    std::vector<RealMatrix> matrices;
+    matrices.reserve(BATCH_COUNT);
+    for (std::size_t b = 0; b < BATCH_COUNT; ++b) {
+        RealMatrix m = makeMatrix(n, seed + 0.01 * static_cast<double>(b));
+        for (std::size_t i = 0; i < n; ++i) {
+            m.setValue(i, i, m.getValue(i, i) + static_cast<double>(n));
+        }
+        matrices.push_back(m);
+    }
+    return matrices;
+}
+
+void BM_BatchMultiply(benchmark::State& state) {
+    const MatrixBatch a(makeBatchMatrices(sizeOf(state), 0.3));
+    const MatrixBatch b(makeBatchMatrices(sizeOf(state), 1.7));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a * b);
+    }
+    const double n = static_cast<double>(state.range(0));
+    setCounters(state, BATCH_COUNT * 2.0 * n * n * n, BATCH_COUNT * 3.0 * n * n * sizeof(double));
+}
+BENCHMARK(BM_BatchMultiply)->Apply(batchSizes);
+
+void BM_LoopMultiply(benchmark::State& state) {
+    const std::vector<RealMatrix> a = makeBatchMatrices(sizeOf(state), 0.3);
+    const std::vector<RealMatrix> b = makeBatchMatrices(sizeOf(state), 1.7);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < BATCH_COUNT; ++i) {
+            benchmark::DoNotOptimize(a[i] * b[i]);
+        }
+    }
+    const double n = static_cast<double>(state.range(0));
+    setCounters(state, BATCH_COUNT * 2.0 * n * n * n, BATCH_COUNT * 3.0 * n * n * sizeof(double));
+}
+BENCHMARK(BM_LoopMultiply)->Apply(batchSizes);
+
+void BM_BatchDeterminant(benchmark::State& state) {
+    const MatrixBatch a(makeBatchMatrices(sizeOf(state), 0.3));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a.calculateDeterminants());
+    }
+    const double n = static_cast<double>(state.range(0));
+    setCounters(state, BATCH_COUNT * 2.0 / 3.0 * n * n * n, BATCH_COUNT * n * n * sizeof(double));
+}
+BENCHMARK(BM_BatchDeterminant)->Apply(batchSizes);
+
+void BM_LoopDeterminant(benchmark::State& state) {
+    const std::vector<RealMatrix> a = makeBatchMatrices(sizeOf(state), 0.3);
+    for (auto _ : state) {
+        for (const RealMatrix& m : a) {
+            benchmark::DoNotOptimize(m.calculateDeterminant());
+        }
+    }
+    const double n = static_cast<double>(state.range(0));
+    setCounters(state, BATCH_COUNT * 2.0 / 3.0 * n * n * n, BATCH_COUNT * n * n * sizeof(double));
+}
+BENCHMARK(BM_LoopDeterminant)->Apply(batchSizes);
+
+// Одна правая часть на матрицу
+void BM_BatchSolve(benchmark::State& state) {
+    const MatrixBatch a(makeBatchMatrices(sizeOf(state), 0.3));
+    const MatrixBatch rhs(BATCH_COUNT, sizeOf(state), 1, 1.0);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a.solve(rhs));
+    }
+    const double n = static_cast<double>(state.range(0));
+    setCounters(state, BATCH_COUNT * (2.0 / 3.0 * n * n * n + 2.0 * n * n),
+                BATCH_COUNT * (n * n + 2.0 * n) * sizeof(double));
+}
+BENCHMARK(BM_BatchSolve)->Apply(batchSizes);
+
+} // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,65 @@
+/**
+ * @file AlignedAllocator.h
+ * @brief Allocator returning memory aligned to a cache line
+ * @author Shchurko
+ * @date 2025
+ */
+
+#ifndef MATRIXLAB_ALIGNEDALLOCATOR_H
+#define MATRIXLAB_ALIGNEDALLOCATOR_H
+
+#include <cstddef>
+#include <new>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+// Выравнивание буфера матрицы: одна строка кэша, подходит для AVX-512
+constexpr std::size_t MATRIX_ALIGNMENT = 64;
+
+template <typename T, std::size_t Alignment = MATRIX_ALIGNMENT>
+class AlignedAllocator {
+public:
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() noexcept = default;
+
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+    T* allocate(std::size_t count) {
+        if (count > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+            throw std::bad_array_new_length();
+        }
+        return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(Alignment)));
+    }
+
+    void deallocate(T* pointer, std::size_t) noexcept {
+        ::operator delete(pointer, std::align_val_t(Alignment));
+    }
+
+    // resize() без аргумента не обнуляет элементы: буфер, который сразу
+    // перезаписывается, не приходится проходить дважды
+    template <typename U>
+    void construct(U* pointer) noexcept(std::is_nothrow_default_constructible<U>::value) {
+        ::new (static_cast<void*>(pointer)) U;
+    }
+
+    template <typename U, typename... Args>
+    void construct(U* pointer, Args&&... args) {
+        ::new (static_cast<void*>(pointer)) U(std::forward<Args>(args)...);
+    }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept { return true; }
+
+    template <typename U>
+    bool operator!=(const AlignedAllocator<U, Alignment>&) const noexcept { return false; }
+};
+
+#endif // MATRIXLAB_ALIGNEDALLOCATOR_H
@@ -0,0 +1,617 @@
+/**
+ * @file BasicMatrix.h
+ * @brief Dense matrix with a configurable element type (float, long double)
+ * @author Shchurko
+ * @date 2025
+ */
+
+#ifndef MATRIXLAB_BASICMATRIX_H
+#define MATRIXLAB_BASICMATRIX_H
+
+#include "Matrix.h"
+#include "SimdKernels.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <utility>
+
+namespace basic_detail {
+
+// Поэлементные операции над непрерывным участком. Шаблон - скалярная
+// реализация для любого типа, перегрузки для float идут в SIMD-ядра
+template <typename T>
+void add(const T* a, const T* b, T* out, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) out[i] = a[i] + b[i];
+}
+
+template <typename T>
+void subtract(const T* a, const T* b, T* out, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) out[i] = a[i] - b[i];
+}
+
+template <typename T>
+void scale(const T* a, T factor, T* out, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) out[i] = a[i] * factor;
+}
+
+template <typename T>
+void addScalar(const T* a, T value, T* out, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) out[i] = a[i] + value;
+}
+
+template <typename T>
+void axpy(T factor, const T* a, T* out, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) out[i] += factor * a[i];
+}
+
+template <typename T>
+T sumSquares(const T* a, std::size_t count) {
+    T sum = T(0);
+    for (std::size_t i = 0; i < count; ++i) sum += a[i] * a[i];
+    return sum;
+}
+
+template <typename T>
+bool allClose(const T* a, const T* b, T tolerance, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        if (std::abs(a[i] - b[i]) > tolerance) return false;
+    }
+    return true;
+}
+
+inline void add(const float* a, const float* b, float* out, std::size_t count) {
+    kernels::add(a, b, out, count);
+}
+
+inline void subtract(const float* a, const float* b, float* out, std::size_t count) {
+    kernels::subtract(a, b, out, count);
+}
+
+inline void scale(const float* a, float factor, float* out, std::size_t count) {
+    kernels::scale(a, factor, out, count);
+}
+
+inline void addScalar(const float* a, float value, float* out, std::size_t count) {
+    kernels::addScalar(a, value, out, count);
+}
+
+inline void axpy(float factor, const float* a, float* out, std::size_t count) {
+    kernels::axpy(factor, a, out, count);
+}
+
+inline double sumSquares(const float* a, std::size_t count) {
+    return kernels::sumSquares(a, count);
+}
+
+inline bool allClose(const float* a, const float* b, float tolerance, std::size_t count) {
+    return kernels::allClose(a, b, tolerance, count);
+}
+
+// Глубина блока по внутреннему измерению в умножении: строка блока B
+// остаётся в кэше, пока по ней проходят все строки блока A
+constexpr std::size_t GEMM_DEPTH_BLOCK = 256;
+// Строк результата в одной задаче пула
+constexpr std::size_t GEMM_ROW_BLOCK = 16;
+
+} // namespace basic_detail
+
+/**
+ * @brief Плотная матрица с элементами типа T
+ *
+ * Та же раскладка, что у RealMatrix: один выровненный буфер, шаг строки
+ * округлён до строки кэша, хвост строки заполнен нулями. Для float
+ * поэлементные операции, норма, сравнение и умножение идут через
+ * SIMD-ядра (вдвое больше элементов на регистр, чем у double), для
+ * остальных типов - скалярные циклы. Порог сравнения с нулём берётся
+ * из MatrixTraits<T>.
+ *
+ * BasicMatrix<double> (RealMatrix) - отдельная реализация из Matrix.h;
+ * представления, ленивые выражения, разложения и файловые форматы
+ * есть только у неё. Переход между точностями - явный конструктор.
+ */
+template <typename T>
+class BasicMatrix {
+    static_assert(std::is_floating_point<T>::value, "BasicMatrix requires a floating-point element type");
+
+private:
+    std::size_t numRows;
+    std::size_t numCols;
+    std::size_t rowStride;
+    std::vector<T, AlignedAllocator<T>> matrixData;
+
+    template <typename U>
+    friend class BasicMatrix;
+
+public:
+    using value_type = T;
+
+    // Конструкторы
+    BasicMatrix() : numRows(0), numCols(0), rowStride(0), matrixData() {}
+
+    BasicMatrix(std::size_t rows, std::size_t cols, T initValue = T(0))
+            : BasicMatrix(checkedRows(rows, cols), cols, Uninitialized{}) {
+        for (std::size_t i = 0; i < numRows; ++i) {
+            std::fill(rowData(i), rowData(i) + numCols, initValue);
+        }
+    }
+
+    BasicMatrix(const std::vector<std::vector<T>>& inputData) : BasicMatrix() {
+        if (inputData.empty() || inputData[0].empty()) {
+            return;
+        }
+        for (const auto& row : inputData) {
+            if (row.size() != inputData[0].size()) {
+                throw std::invalid_argument("All rows must have the same number of columns");
+            }
+        }
+        BasicMatrix loaded(inputData.size(), inputData[0].size(), Uninitialized{});
+        for (std::size_t i = 0; i < loaded.numRows; ++i) {
+            std::copy(inputData[i].begin(), inputData[i].end(), loaded.rowData(i));
+        }
+        *this = std::move(loaded);
+    }
+
+    BasicMatrix(const BasicMatrix& other) = default;
+
+    // Перемещённая матрица становится пустой (0 x 0)
+    BasicMatrix(BasicMatrix&& other) noexcept
+            : numRows(other.numRows), numCols(other.numCols), rowStride(other.rowStride),
+              matrixData(std::move(other.matrixData)) {
+        other.numRows = 0;
+        other.numCols = 0;
+        other.rowStride = 0;
+        other.matrixData.clear();
+    }
+
+    // Явное преобразование точности, в том числе из RealMatrix
+    template <typename U>
+    explicit BasicMatrix(const BasicMatrix<U>& other) : BasicMatrix() {
+        if (other.getRows() == 0) {
+            return;
+        }
+        BasicMatrix converted(other.getRows(), other.getCols(), Uninitialized{});
+        for (std::size_t i = 0; i < converted.numRows; ++i) {
+            const U* source = other.getData() + i * other.getRowStride();
+            std::transform(source, source + converted.numCols, converted.rowData(i),
+                           [](U value) { return static_cast<T>(value); });
+        }
+        *this = std::move(converted);
+    }
+
+    // Оператор присваивания
+    BasicMatrix& operator=(const BasicMatrix& other) = default;
+
+    BasicMatrix& operator=(BasicMatrix&& other) noexcept {
+        if (this != &other) {
+            numRows = other.numRows;
+            numCols = other.numCols;
+            rowStride = other.rowStride;
+            matrixData = std::move(other.matrixData);
+            other.numRows = 0;
+            other.numCols = 0;
+            other.rowStride = 0;
+            other.matrixData.clear();
+        }
+        return *this;
+    }
+
+    // Геттеры
+    std::size_t getRows() const { return numRows; }
+    std::size_t getCols() const { return numCols; }
+    std::size_t getRowStride() const { return rowStride; }
+    const T* getData() const { return matrixData.data(); }
+    T* getData() { return matrixData.data(); }
+
+    T getValue(std::size_t row, std::size_t col) const {
+        if (!isValidIndex(row, col)) {
+            throw std::out_of_range("Matrix indices out of range");
+        }
+        return rowData(row)[col];
+    }
+
+    void setValue(std::size_t row, std::size_t col, T value) {
+        if (!isValidIndex(row, col)) {
+            throw std::out_of_range("Matrix indices out of range");
+        }
+        rowData(row)[col] = value;
+    }
+
+    // Операции с матрицами
+    void changeSize(std::size_t newRows, std::size_t newCols, T initValue = T(0)) {
+        BasicMatrix resized(newRows, newCols, initValue);
+        const std::size_t keepRows = std::min(numRows, newRows);
+        const std::size_t keepCols = std::min(numCols, newCols);
+        for (std::size_t i = 0; i < keepRows; ++i) {
+            std::copy(rowData(i), rowData(i) + keepCols, resized.rowData(i));
+        }
+        *this = std::move(resized);
+    }
+
+    BasicMatrix extractSubmatrix(std::size_t startRow, std::size_t startCol,
+                                 std::size_t subRows, std::size_t subCols) const {
+        if (startRow + subRows > numRows || startCol + subCols > numCols) {
+            throw std::out_of_range("Submatrix exceeds matrix boundaries");
+        }
+        BasicMatrix submatrix(subRows, subCols, Uninitialized{});
+        for (std::size_t i = 0; i < subRows; ++i) {
+            const T* source = rowData(startRow + i) + startCol;
+            std::copy(source, source + subCols, submatrix.rowData(i));
+        }
+        return submatrix;
+    }
+
+    // Транспонирование блоками: и чтение, и запись остаются в пределах
+    // нескольких строк кэша
+    BasicMatrix computeTranspose() const {
+        constexpr std::size_t block = 32;
+        BasicMatrix result(numCols, numRows, Uninitialized{});
+        for (std::size_t ii = 0; ii < numRows; ii += block) {
+            const std::size_t iEnd = std::min(ii + block, numRows);
+            for (std::size_t jj = 0; jj < numCols; jj += block) {
+                const std::size_t jEnd = std::min(jj + block, numCols);
+                for (std::size_t i = ii; i < iEnd; ++i) {
+                    const T* source = rowData(i);
+                    for (std::size_t j = jj; j < jEnd; ++j) {
+                        result.rowData(j)[i] = source[j];
+                    }
+                }
+            }
+        }
+        return result;
+    }
+
+    // LU-разложение с выбором ведущего элемента по столбцу, в типе T
+    T calculateDeterminant() const {
+        if (!checkIsSquare()) {
+            throw std::invalid_argument("Matrix must be square to compute determinant");
+        }
+        BasicMatrix lu(*this);
+        T determinant = T(1);
+        for (std::size_t k = 0; k < numRows; ++k) {
+            std::size_t pivot = k;
+            for (std::size_t i = k + 1; i < numRows; ++i) {
+                if (std::abs(lu.rowData(i)[k]) > std::abs(lu.rowData(pivot)[k])) {
+                    pivot = i;
+                }
+            }
+            if (lu.rowData(pivot)[k] == T(0)) {
+                return T(0);
+            }
+            if (pivot != k) {
+                std::swap_ranges(lu.rowData(k), lu.rowData(k) + numCols, lu.rowData(pivot));
+                determinant = -determinant;
+            }
+            const T* pivotRow = lu.rowData(k);
+            determinant *= pivotRow[k];
+            for (std::size_t i = k + 1; i < numRows; ++i) {
+                T* row = lu.rowData(i);
+                const T factor = row[k] / pivotRow[k];
+                basic_detail::axpy(-factor, pivotRow + k + 1, row + k + 1, numCols - k - 1);
+            }
+        }
+        return determinant;
+    }
+
+    T calculateTrace() const {
+        if (!checkIsSquare()) {
+            throw std::invalid_argument("Matrix must be square to compute trace");
+        }
+        T trace = T(0);
+        for (std::size_t i = 0; i < numRows; ++i) {
+            trace += rowData(i)[i];
+        }
+        return trace;
+    }
+
+    T calculateNorm() const {
+        using Accumulator = decltype(basic_detail::sumSquares(std::declval<const T*>(), std::size_t{0}));
+        Accumulator sum = Accumulator(0);
+        forEachSpan([&](std::size_t offset, std::size_t length) {
+            sum += basic_detail::sumSquares(matrixData.data() + offset, length);
+        });
+        return static_cast<T>(std::sqrt(sum));
+    }
+
+    // Проверки свойств матрицы
+    bool checkIsSquare() const { return numRows == numCols; }
+
+    bool checkIsDiagonal() const {
+        return checkIsSquare() && allElements([](std::size_t i, std::size_t j, T value) {
+            return i == j || std::abs(value) <= MatrixTraits<T>::epsilon;
+        });
+    }
+
+    bool checkIsZero() const {
+        return allElements([](std::size_t, std::size_t, T value) {
+            return std::abs(value) <= MatrixTraits<T>::epsilon;
+        });
+    }
+
+    bool checkIsIdentity() const {
+        return checkIsSquare() && allElements([](std::size_t i, std::size_t j, T value) {
+            return std::abs(value - (i == j ? T(1) : T(0))) <= MatrixTraits<T>::epsilon;
+        });
+    }
+
+    bool checkIsSymmetric() const {
+        return checkIsSquare() && allElements([this](std::size_t i, std::size_t j, T value) {
+            return std::abs(value - rowData(j)[i]) <= MatrixTraits<T>::epsilon;
+        });
+    }
+
+    bool checkIsUpperTriangular() const {
+        return checkIsSquare() && allElements([](std::size_t i, std::size_t j, T value) {
+            return i <= j || std::abs(value) <= MatrixTraits<T>::epsilon;
+        });
+    }
+
+    bool checkIsLowerTriangular() const {
+        return checkIsSquare() && allElements([](std::size_t i, std::size_t j, T value) {
+            return i >= j || std::abs(value) <= MatrixTraits<T>::epsilon;
+        });
+    }
+
+    bool checkIsOrthogonal() const {
+        return checkIsSquare() && (*this * computeTranspose()).checkIsIdentity();
+    }
+
+    // Арифметические операторы
+    BasicMatrix operator+(const BasicMatrix& other) const {
+        BasicMatrix result(*this);
+        return result += other;
+    }
+
+    BasicMatrix operator-(const BasicMatrix& other) const {
+        BasicMatrix result(*this);
+        return result -= other;
+    }
+
+    BasicMatrix operator*(T scalar) const {
+        BasicMatrix result(*this);
+        return result *= scalar;
+    }
+
+    friend BasicMatrix operator*(T scalar, const BasicMatrix& matrix) {
+        return matrix * scalar;
+    }
+
+    BasicMatrix operator/(T scalar) const {
+        BasicMatrix result(*this);
+        return result /= scalar;
+    }
+
+    // Умножение i-k-j: строка результата накапливается axpy по строкам B,
+    // блоки строк результата раздаются пулу потоков
+    BasicMatrix operator*(const BasicMatrix& other) const {
+        if (numCols != other.numRows) {
+            throw std::invalid_argument("Incompatible dimensions for matrix multiplication");
+        }
+
+        BasicMatrix result(numRows, other.numCols, T(0));
+        const std::size_t inner = numCols;
+        const std::size_t width = other.numCols;
+        auto multiplyRows = [&](std::size_t block) {
+            const std::size_t rowBegin = block * basic_detail::GEMM_ROW_BLOCK;
+            const std::size_t rowEnd = std::min(rowBegin + basic_detail::GEMM_ROW_BLOCK, numRows);
+            for (std::size_t kk = 0; kk < inner; kk += basic_detail::GEMM_DEPTH_BLOCK) {
+                const std::size_t kEnd = std::min(kk + basic_detail::GEMM_DEPTH_BLOCK, inner);
+                for (std::size_t i = rowBegin; i < rowEnd; ++i) {
+                    const T* left = rowData(i);
+                    T* out = result.rowData(i);
+                    for (std::size_t k = kk; k < kEnd; ++k) {
+                        if (left[k] != T(0)) {
+                            basic_detail::axpy(left[k], other.rowData(k), out, width);
+                        }
+                    }
+                }
+            }
+        };
+
+        const std::size_t blocks = (numRows + basic_detail::GEMM_ROW_BLOCK - 1) / basic_detail::GEMM_ROW_BLOCK;
+        const double work = static_cast<double>(numRows) * static_cast<double>(inner) * static_cast<double>(width);
+        if (blocks > 1 && ThreadPool::getGlobalThreadCount() > 1 &&
+            work >= static_cast<double>(RealMatrix::getParallelThreshold())) {
+            ThreadPool::global()->parallelFor(blocks, multiplyRows);
+        } else {
+            for (std::size_t block = 0; block < blocks; ++block) {
+                multiplyRows(block);
+            }
+        }
+        return result;
+    }
+
+    BasicMatrix& operator+=(const BasicMatrix& other) {
+        if (numRows != other.numRows || numCols != other.numCols) {
+            throw std::invalid_argument("Matrices dimensions must match for addition");
+        }
+        forEachSpan([&](std::size_t offset, std::size_t length) {
+            T* span = matrixData.data() + offset;
+            basic_detail::add(span, other.matrixData.data() + offset, span, length);
+        });
+        return *this;
+    }
+
+    BasicMatrix& operator-=(const BasicMatrix& other) {
+        if (numRows != other.numRows || numCols != other.numCols) {
+            throw std::invalid_argument("Matrices dimensions must match for subtraction");
+        }
+        forEachSpan([&](std::size_t offset, std::size_t length) {
+            T* span = matrixData.data() + offset;
+            basic_detail::subtract(span, other.matrixData.data() + offset, span, length);
+        });
+        return *this;
+    }
+
+    BasicMatrix& operator*=(const BasicMatrix& other) {
+        *this = *this * other;
+        return *this;
+    }
+
+    BasicMatrix& operator*=(T scalar) {
+        forEachSpan([&](std::size_t offset, std::size_t length) {
+            T* span = matrixData.data() + offset;
+            basic_detail::scale(span, scalar, span, length);
+        });
+        return *this;
+    }
+
+    BasicMatrix& operator/=(T scalar) {
+        if (std::abs(scalar) < MatrixTraits<T>::epsilon) {
+            throw std::invalid_argument("Division by zero");
+        }
+        return *this *= (T(1) / scalar);
+    }
+
+    // Инкремент/декремент. Сдвиг идёт только по значащим столбцам:
+    // хвосты строк должны оставаться нулевыми
+    BasicMatrix& operator++() { return shift(T(1)); }
+    BasicMatrix& operator--() { return shift(T(-1)); }
+
+    BasicMatrix operator++(int) {
+        BasicMatrix previous(*this);
+        shift(T(1));
+        return previous;
+    }
+
+    BasicMatrix operator--(int) {
+        BasicMatrix previous(*this);
+        shift(T(-1));
+        return previous;
+    }
+
+    // Операторы сравнения
+    bool operator==(const BasicMatrix& other) const {
+        if (numRows != other.numRows || numCols != other.numCols) {
+            return false;
+        }
+        bool close = true;
+        forEachSpan([&](std::size_t offset, std::size_t length) {
+            close = close && basic_detail::allClose(matrixData.data() + offset, other.matrixData.data() + offset,
+                                                    MatrixTraits<T>::epsilon, length);
+        });
+        return close;
+    }
+
+    bool operator!=(const BasicMatrix& other) const {
+        return !(*this == other);
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const BasicMatrix& matrix) {
+        for (std::size_t i = 0; i < matrix.numRows; ++i) {
+            const T* row = matrix.rowData(i);
+            for (std::size_t j = 0; j < matrix.numCols; ++j) {
+                os << row[j];
+                if (j < matrix.numCols - 1) os << " ";
+            }
+            if (i < matrix.numRows - 1) os << "\n";
+        }
+        return os;
+    }
+
+    // Создание специальных матриц
+    static BasicMatrix createIdentity(std::size_t size) {
+        BasicMatrix identity(size, size, T(0));
+        for (std::size_t i = 0; i < size; ++i) {
+            identity.rowData(i)[i] = T(1);
+        }
+        return identity;
+    }
+
+    static BasicMatrix createDiagonal(const std::vector<T>& diagonal) {
+        BasicMatrix diagMatrix(diagonal.size(), diagonal.size(), T(0));
+        for (std::size_t i = 0; i < diagonal.size(); ++i) {
+            diagMatrix.rowData(i)[i] = diagonal[i];
+        }
+        return diagMatrix;
+    }
+
+private:
+    struct Uninitialized {};
+
+    // Значения перезапишет вызывающий код, обнуляется только хвост строк
+    BasicMatrix(std::size_t rows, std::size_t cols, Uninitialized)
+            : numRows(rows), numCols(cols), rowStride(computeRowStride(cols)), matrixData() {
+        matrixData.resize(rows * rowStride);
+        if (rowStride != cols) {
+            for (std::size_t i = 0; i < rows; ++i) {
+                std::fill(rowData(i) + cols, rowData(i) + rowStride, T(0));
+            }
+        }
+    }
+
+    static std::size_t checkedRows(std::size_t rows, std::size_t cols) {
+        if (rows == 0 || cols == 0) {
+            throw std::invalid_argument("Matrix dimensions must be positive");
+        }
+        return rows;
+    }
+
+    static std::size_t computeRowStride(std::size_t cols) {
+        const std::size_t lane = MATRIX_ALIGNMENT / sizeof(T);
+        return (cols + lane - 1) / lane * lane;
+    }
+
+    bool isValidIndex(std::size_t row, std::size_t col) const {
+        return row < numRows && col < numCols;
+    }
+
+    T* rowData(std::size_t row) { return matrixData.data() + row * rowStride; }
+    const T* rowData(std::size_t row) const { return matrixData.data() + row * rowStride; }
+
+    // Поэлементные операции идут только по значащим столбцам (как
+    // forEachSpan у RealMatrix): хвосты строк остаются нулевыми даже после
+    // умножения на inf или NaN. Без хвостов буфер обходится одним участком
+    template <typename Operation>
+    void forEachSpan(Operation operation) const {
+        if (rowStride == numCols) {
+            operation(std::size_t{0}, numRows * numCols);
+            return;
+        }
+        for (std::size_t i = 0; i < numRows; ++i) {
+            operation(i * rowStride, numCols);
+        }
+    }
+
+    BasicMatrix& shift(T delta) {
+        for (std::size_t i = 0; i < numRows; ++i) {
+            basic_detail::addScalar(rowData(i), delta, rowData(i), numCols);
+        }
+        return *this;
+    }
+
+    // Обход значащих элементов; прекращается, как только predicate вернёт false
+    template <typename Predicate>
+    bool allElements(Predicate predicate) const {
+        for (std::size_t i = 0; i < numRows; ++i) {
+            const T* row = rowData(i);
+            for (std::size_t j = 0; j < numCols; ++j) {
+                if (!predicate(i, j, row[j])) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+};
+
+// Явное преобразование в double из другой точности
+template <typename U>
+BasicMatrix<double>::BasicMatrix(const BasicMatrix<U>& other)
+        : BasicMatrix() {
+    if (other.getRows() == 0) {
+        return;
+    }
+    RealMatrix converted(other.getRows(), other.getCols(), Uninitialized{});
+    for (std::size_t i = 0; i < converted.numRows; ++i) {
+        const U* source = other.getData() + i * other.getRowStride();
+        std::transform(source, source + converted.numCols, converted.rowData(i),
+                       [](U value) { return static_cast<double>(value); });
+    }
+    *this = std::move(converted);
+}
+
+using FloatMatrix = BasicMatrix<float>;
+using LongDoubleMatrix = BasicMatrix<long double>;
+
+#endif // MATRIXLAB_BASICMATRIX_H
@@ -0,0 +1,645 @@
+/**
+ * @file Factorization.cpp
+ * @brief Implementation of blocked LU, Cholesky and QR factorizations
+ * @author Shchurko
+ * @date 2025
+ */
+
+#include "Factorization.h"
+#include "Gemm.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace kernels {
+
+// Блоки над диагональю вычитаются через gemm
+void solveLowerInPlace(std::size_t n, const double* t, std::size_t tRow, std::size_t tCol,
+                       bool unitDiagonal, double* x, std::size_t xStride, std::size_t nrhs) {
+    for (std::size_t ib = 0; ib < n; ib += FACTORIZATION_BLOCK) {
+        std::size_t nb = std::min(FACTORIZATION_BLOCK, n - ib);
+        if (ib > 0) {
+            kernels::gemm(nb, nrhs, ib, -1.0, t + ib * tRow, tRow, tCol,
+                          x, xStride, 1, 1.0, x + ib * xStride, xStride);
+        }
+        for (std::size_t i = ib; i < ib + nb; ++i) {
+            double* xi = x + i * xStride;
+            for (std::size_t j = ib; j < i; ++j) {
+                double factor = t[i * tRow + j * tCol];
+                if (factor == 0.0) continue;
+                const double* xj = x + j * xStride;
+                for (std::size_t c = 0; c < nrhs; ++c) {
+                    xi[c] -= factor * xj[c];
+                }
+            }
+            if (!unitDiagonal) {
+                double diagonal = t[i * tRow + i * tCol];
+                for (std::size_t c = 0; c < nrhs; ++c) {
+                    xi[c] /= diagonal;
+                }
+            }
+        }
+    }
+}
+
+void solveUpperInPlace(std::size_t n, const double* t, std::size_t tRow, std::size_t tCol,
+                       double* x, std::size_t xStride, std::size_t nrhs) {
+    std::size_t blockEnd = n;
+    while (blockEnd > 0) {
+        std::size_t nb = std::min(FACTORIZATION_BLOCK, blockEnd);
+        std::size_t ib = blockEnd - nb;
+        if (blockEnd < n) {
+            kernels::gemm(nb, nrhs, n - blockEnd, -1.0, t + ib * tRow + blockEnd * tCol, tRow, tCol,
+                          x + blockEnd * xStride, xStride, 1, 1.0, x + ib * xStride, xStride);
+        }
+        for (std::size_t i = blockEnd; i-- > ib;) {
+            double* xi = x + i * xStride;
+            for (std::size_t j = i + 1; j < blockEnd; ++j) {
+                double factor = t[i * tRow + j * tCol];
+                if (factor == 0.0) continue;
+                const double* xj = x + j * xStride;
+                for (std::size_t c = 0; c < nrhs; ++c) {
+                    xi[c] -= factor * xj[c];
+                }
+            }
+            double diagonal = t[i * tRow + i * tCol];
+            for (std::size_t c = 0; c < nrhs; ++c) {
+                xi[c] /= diagonal;
+            }
+        }
+        blockEnd = ib;
+    }
+}
+
+} // namespace kernels
+
+namespace {
+
+RealMatrix columnFromVector(const std::vector<double>& values) {
+    RealMatrix column(values.size(), 1);
+    double* data = column.getData();
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        data[i * column.getRowStride()] = values[i];
+    }
+    return column;
+}
+
+std::vector<double> vectorFromColumn(const RealMatrix& column) {
+    std::vector<double> values(column.getRows());
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        values[i] = column.getData()[i * column.getRowStride()];
+    }
+    return values;
+}
+
+} // namespace
+
+// ==================== LU ====================
+LUDecomposition::LUDecomposition(const RealMatrix& matrix)
+        : factors(matrix), pivots(matrix.getRows()), permutationSign(1)
+{
+    if (!matrix.checkIsSquare()) {
+        throw std::invalid_argument("Matrix must be square for LU decomposition");
+    }
+
+    const std::size_t n = factors.getRows();
+    const std::size_t lda = factors.getRowStride();
+    double* a = factors.getData();
+
+    for (std::size_t k = 0; k < n; k += FACTORIZATION_BLOCK) {
+        const std::size_t nb = std::min(FACTORIZATION_BLOCK, n - k);
+        const std::size_t panelEnd = k + nb;
+
+        // Панель: столбцы [k, panelEnd), все строки ниже k
+        for (std::size_t j = k; j < panelEnd; ++j) {
+            std::size_t pivotRow = j;
+            double pivotMagnitude = std::abs(a[j * lda + j]);
+            for (std::size_t i = j + 1; i < n; ++i) {
+                double magnitude = std::abs(a[i * lda + j]);
+                if (magnitude > pivotMagnitude) {
+                    pivotMagnitude = magnitude;
+                    pivotRow = i;
+                }
+            }
+
+            pivots[j] = pivotRow;
+            if (pivotRow != j) {
+                // Строка переставляется целиком: и уже готовая часть L, и правая часть
+                std::swap_ranges(a + j * lda, a + j * lda + n, a + pivotRow * lda);
+                permutationSign = -permutationSign;
+            }
+
+            const double* pivotLine = a + j * lda;
+            const double pivot = pivotLine[j];
+            if (pivot == 0.0) {
+                continue;
+            }
+            for (std::size_t i = j + 1; i < n; ++i) {
+                double* line = a + i * lda;
+                double factor = line[j] / pivot;
+                line[j] = factor;
+                if (factor == 0.0) continue;
+                for (std::size_t c = j + 1; c < panelEnd; ++c) {
+                    line[c] -= factor * pivotLine[c];
+                }
+            }
+        }
+
+        if (panelEnd == n) break;
+
+        // U12 = L11^{-1} A12
+        kernels::solveLowerInPlace(nb, a + k * lda + k, lda, 1, true,
+                          a + k * lda + panelEnd, lda, n - panelEnd);
+        // A22 -= L21 U12
+        kernels::gemm(n - panelEnd, n - panelEnd, nb, -1.0,
+                      a + panelEnd * lda + k, lda, 1,
+                      a + k * lda + panelEnd, lda, 1,
+                      1.0, a + panelEnd * lda + panelEnd, lda);
+    }
+}
+
+std::size_t LUDecomposition::getSize() const {
+    return factors.getRows();
+}
+
+bool LUDecomposition::isSingular() const {
+    const double* a = factors.getData();
+    for (std::size_t i = 0; i < getSize(); ++i) {
+        if (a[i * factors.getRowStride() + i] == 0.0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::vector<double> LUDecomposition::solve(const std::vector<double>& rhs) const {
+    return vectorFromColumn(solve(columnFromVector(rhs)));
+}
+
+RealMatrix LUDecomposition::solve(const RealMatrix& rhs) const {
+    const std::size_t n = getSize();
+    if (rhs.getRows() != n) {
+        throw std::invalid_argument("Right-hand side row count must match matrix size");
+    }
+    if (isSingular()) {
+        throw std::runtime_error("Matrix is singular");
+    }
+
+    RealMatrix solution(rhs);
+    const std::size_t nrhs = solution.getCols();
+    const std::size_t stride = solution.getRowStride();
+    double* x = solution.getData();
+    for (std::size_t k = 0; k < n; ++k) {
+        if (pivots[k] != k) {
+            std::swap_ranges(x + k * stride, x + k * stride + nrhs, x + pivots[k] * stride);
+        }
+    }
+
+    kernels::solveLowerInPlace(n, factors.getData(), factors.getRowStride(), 1, true, x, stride, nrhs);
+    kernels::solveUpperInPlace(n, factors.getData(), factors.getRowStride(), 1, x, stride, nrhs);
+    return solution;
+}
+
+RealMatrix LUDecomposition::inverse() const {
+    return solve(RealMatrix::createIdentity(getSize()));
+}
+
+double LUDecomposition::determinant() const {
+    double det = static_cast<double>(permutationSign);
+    for (std::size_t i = 0; i < getSize(); ++i) {
+        det *= factors.getData()[i * factors.getRowStride() + i];
+    }
+    return det;
+}
+
+double LUDecomposition::logDeterminant(int& sign) const {
+    // Сумма логарифмов не переполняется там, где произведение уже даёт inf
+    sign = permutationSign;
+    double logAbsDet = 0.0;
+    for (std::size_t i = 0; i < getSize(); ++i) {
+        double pivot = factors.getData()[i * factors.getRowStride() + i];
+        if (pivot == 0.0) {
+            sign = 0;
+            return -std::numeric_limits<double>::infinity();
+        }
+        if (pivot < 0.0) {
+            sign = -sign;
+        }
+        logAbsDet += std::log(std::abs(pivot));
+    }
+    return logAbsDet;
+}
+
+RealMatrix LUDecomposition::getL() const {
+    const std::size_t n = getSize();
+    RealMatrix lower = RealMatrix::createIdentity(n);
+    for (std::size_t i = 1; i < n; ++i) {
+        for (std::size_t j = 0; j < i; ++j) {
+            lower.setValue(i, j, factors.getValue(i, j));
+        }
+    }
+    return lower;
+}
+
+RealMatrix LUDecomposition::getU() const {
+    const std::size_t n = getSize();
+    RealMatrix upper(n, n, 0.0);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = i; j < n; ++j) {
+            upper.setValue(i, j, factors.getValue(i, j));
+        }
+    }
+    return upper;
+}
+
+std::vector<std::size_t> LUDecomposition::getPermutation() const {
+    std::vector<std::size_t> permutation(getSize());
+    for (std::size_t i = 0; i < permutation.size(); ++i) {
+        permutation[i] = i;
+    }
+    for (std::size_t k = 0; k < pivots.size(); ++k) {
+        std::swap(permutation[k], permutation[pivots[k]]);
+    }
+    return permutation;
+}
+
+// ==================== Холецкий ====================
+CholeskyDecomposition::CholeskyDecomposition(const RealMatrix& matrix)
+        : factors(matrix)
+{
+    if (!matrix.checkIsSquare()) {
+        throw std::invalid_argument("Matrix must be square for Cholesky decomposition");
+    }
+    if (!matrix.checkIsSymmetric()) {
+        throw std::invalid_argument("Matrix must be symmetric for Cholesky decomposition");
+    }
+
+    const std::size_t n = factors.getRows();
+    const std::size_t lda = factors.getRowStride();
+    double* a = factors.getData();
+
+    for (std::size_t k = 0; k < n; k += FACTORIZATION_BLOCK) {
+        const std::size_t nb = std::min(FACTORIZATION_BLOCK, n - k);
+        const std::size_t panelEnd = k + nb;
+
+        // Диагональный блок: L11 L11^T = A11 (нижний треугольник)
+        for (std::size_t j = k; j < panelEnd; ++j) {
+            double* rowJ = a + j * lda;
+            double diagonal = rowJ[j];
+            for (std::size_t p = k; p < j; ++p) {
+                diagonal -= rowJ[p] * rowJ[p];
+            }
+            if (!(diagonal > 0.0)) {
+                throw std::invalid_argument("Matrix is not positive definite");
+            }
+            diagonal = std::sqrt(diagonal);
+            rowJ[j] = diagonal;
+
+            for (std::size_t i = j + 1; i < panelEnd; ++i) {
+                double* rowI = a + i * lda;
+                double value = rowI[j];
+                for (std::size_t p = k; p < j; ++p) {
+                    value -= rowI[p] * rowJ[p];
+                }
+                rowI[j] = value / diagonal;
+            }
+        }
+
+        if (panelEnd == n) break;
+
+        // L21 = A21 L11^{-T}: каждая строка решается прямой подстановкой
+        for (std::size_t i = panelEnd; i < n; ++i) {
+            double* rowI = a + i * lda;
+            for (std::size_t j = k; j < panelEnd; ++j) {
+                const double* rowJ = a + j * lda;
+                double value = rowI[j];
+                for (std::size_t p = k; p < j; ++p) {
+                    value -= rowI[p] * rowJ[p];
+                }
+                rowI[j] = value / rowJ[j];
+            }
+        }
+
+        // A22 -= L21 L21^T, только блоки на диагонали и под ней
+        for (std::size_t ib = panelEnd; ib < n; ib += FACTORIZATION_BLOCK) {
+            std::size_t mb = std::min(FACTORIZATION_BLOCK, n - ib);
+            kernels::gemm(mb, ib + mb - panelEnd, nb, -1.0,
+                          a + ib * lda + k, lda, 1,
+                          a + panelEnd * lda + k, 1, lda,
+                          1.0, a + ib * lda + panelEnd, lda);
+        }
+    }
+
+    // Над диагональю остались исходные и промежуточные значения
+    for (std::size_t i = 0; i < n; ++i) {
+        std::fill(a + i * lda + i + 1, a + i * lda + n, 0.0);
+    }
+}
+
+std::size_t CholeskyDecomposition::getSize() const {
+    return factors.getRows();
+}
+
+std::vector<double> CholeskyDecomposition::solve(const std::vector<double>& rhs) const {
+    return vectorFromColumn(solve(columnFromVector(rhs)));
+}
+
+RealMatrix CholeskyDecomposition::solve(const RealMatrix& rhs) const {
+    const std::size_t n = getSize();
+    if (rhs.getRows() != n) {
+        throw std::invalid_argument("Right-hand side row count must match matrix size");
+    }
+
+    RealMatrix solution(rhs);
+    const std::size_t lda = factors.getRowStride();
+    // L y = b, затем L^T x = y (L^T - та же память с переставленными шагами)
+    kernels::solveLowerInPlace(n, factors.getData(), lda, 1, false,
+                      solution.getData(), solution.getRowStride(), solution.getCols());
+    kernels::solveUpperInPlace(n, factors.getData(), 1, lda,
+                      solution.getData(), solution.getRowStride(), solution.getCols());
+    return solution;
+}
+
+RealMatrix CholeskyDecomposition::inverse() const {
+    return solve(RealMatrix::createIdentity(getSize()));
+}
+
+double CholeskyDecomposition::determinant() const {
+    double det = 1.0;
+    for (std::size_t i = 0; i < getSize(); ++i) {
+        double diagonal = factors.getData()[i * factors.getRowStride() + i];
+        det *= diagonal * diagonal;
+    }
+    return det;
+}
+
+double CholeskyDecomposition::logDeterminant() const {
+    double logDet = 0.0;
+    for (std::size_t i = 0; i < getSize(); ++i) {
+        logDet += 2.0 * std::log(factors.getData()[i * factors.getRowStride() + i]);
+    }
+    return logDet;
+}
+
+RealMatrix CholeskyDecomposition::getL() const {
+    return factors;
+}
+
+// ==================== QR ====================
+QRDecomposition::QRDecomposition(const RealMatrix& matrix)
+        : factors(matrix), tau(matrix.getCols(), 0.0)
+{
+    const std::size_t m = factors.getRows();
+    const std::size_t n = factors.getCols();
+    if (m == 0 || m < n) {
+        throw std::invalid_argument("QR decomposition requires rows >= cols");
+    }
+
+    const std::size_t lda = factors.getRowStride();
+    double* a = factors.getData();
+    std::vector<double> work;
+    std::vector<double> vPanel;
+    std::vector<double> tMatrix;
+
+    for (std::size_t k = 0; k < n; k += FACTORIZATION_BLOCK) {
+        const std::size_t nb = std::min(FACTORIZATION_BLOCK, n - k);
+        const std::size_t panelEnd = k + nb;
+
+        // Панель: отражение для каждого столбца и его применение к остатку панели
+        for (std::size_t j = k; j < panelEnd; ++j) {
+            double alpha = a[j * lda + j];
+            double sigma = 0.0;
+            for (std::size_t i = j + 1; i < m; ++i) {
+                sigma += a[i * lda + j] * a[i * lda + j];
+            }
+            if (sigma == 0.0) {
+                tau[j] = 0.0;
+                continue;
+            }
+
+            double beta = -std::copysign(std::sqrt(alpha * alpha + sigma), alpha);
+            tau[j] = (beta - alpha) / beta;
+            double scale = 1.0 / (alpha - beta);
+            for (std::size_t i = j + 1; i < m; ++i) {
+                a[i * lda + j] *= scale;
+            }
+            a[j * lda + j] = beta;
+
+            // H = I - tau v v^T, v = (1, a[j+1..m, j])
+            std::size_t width = panelEnd - j - 1;
+            if (width == 0) continue;
+            work.assign(a + j * lda + j + 1, a + j * lda + panelEnd);
+            for (std::size_t i = j + 1; i < m; ++i) {
+                double v = a[i * lda + j];
+                const double* line = a + i * lda + j + 1;
+                for (std::size_t c = 0; c < width; ++c) {
+                    work[c] += v * line[c];
+                }
+            }
+            for (std::size_t c = 0; c < width; ++c) {
+                a[j * lda + j + 1 + c] -= tau[j] * work[c];
+            }
+            for (std::size_t i = j + 1; i < m; ++i) {
+                double scaledV = tau[j] * a[i * lda + j];
+                double* line = a + i * lda + j + 1;
+                for (std::size_t c = 0; c < width; ++c) {
+                    line[c] -= scaledV * work[c];
+                }
+            }
+        }
+
+        if (panelEnd == n) break;
+
+        // Компактное WY-представление: H_k ... H_{k+nb-1} = I - V T V^T
+        const std::size_t panelRows = m - k;
+        vPanel.assign(panelRows * nb, 0.0);
+        for (std::size_t i = 0; i < panelRows; ++i) {
+            for (std::size_t c = 0; c < nb && c <= i; ++c) {
+                vPanel[i * nb + c] = (c == i) ? 1.0 : a[(k + i) * lda + k + c];
+            }
+        }
+
+        tMatrix.assign(nb * nb, 0.0);
+        for (std::size_t c = 0; c < nb; ++c) {
+            // T[0:c, c] = -tau_c * T[0:c, 0:c] * (V[:, 0:c]^T v_c)
+            std::vector<double> projection(c, 0.0);
+            for (std::size_t i = c; i < panelRows; ++i) {
+                double vc = vPanel[i * nb + c];
+                for (std::size_t p = 0; p < c; ++p) {
+                    projection[p] += vPanel[i * nb + p] * vc;
+                }
+            }
+            for (std::size_t p = 0; p < c; ++p) {
+                double value = 0.0;
+                for (std::size_t q = p; q < c; ++q) {
+                    value += tMatrix[p * nb + q] * projection[q];
+                }
+                tMatrix[p * nb + c] = -tau[k + c] * value;
+            }
+            tMatrix[c * nb + c] = tau[k + c];
+        }
+
+        // A2 = (I - V T^T V^T) A2 = A2 - V (T^T (V^T A2))
+        const std::size_t trailing = n - panelEnd;
+        double* a2 = a + k * lda + panelEnd;
+        work.assign(nb * trailing, 0.0);
+        kernels::gemm(nb, trailing, panelRows, 1.0, vPanel.data(), 1, nb,
+                      a2, lda, 1, 0.0, work.data(), trailing);
+        for (std::size_t i = nb; i-- > 0;) {
+            double* target = work.data() + i * trailing;
+            double diagonal = tMatrix[i * nb + i];
+            for (std::size_t c = 0; c < trailing; ++c) {
+                target[c] *= diagonal;
+            }
+            for (std::size_t p = 0; p < i; ++p) {
+                double factor = tMatrix[p * nb + i];
+                if (factor == 0.0) continue;
+                const double* source = work.data() + p * trailing;
+                for (std::size_t c = 0; c < trailing; ++c) {
+                    target[c] += factor * source[c];
+                }
+            }
+        }
+        kernels::gemm(panelRows, trailing, nb, -1.0, vPanel.data(), nb, 1,
+                      work.data(), trailing, 1, 1.0, a2, lda);
+    }
+}
+
+std::size_t QRDecomposition::getRows() const {
+    return factors.getRows();
+}
+
+std::size_t QRDecomposition::getCols() const {
+    return factors.getCols();
+}
+
+bool QRDecomposition::isFullRank() const {
+    for (std::size_t i = 0; i < getCols(); ++i) {
+        if (factors.getData()[i * factors.getRowStride() + i] == 0.0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void QRDecomposition::applyQTranspose(double* rhs, std::size_t rhsStride, std::size_t rhsCols) const {
+    const std::size_t m = getRows();
+    const std::size_t lda = factors.getRowStride();
+    const double* a = factors.getData();
+    std::vector<double> work(rhsCols);
+
+    for (std::size_t j = 0; j < getCols(); ++j) {
+        if (tau[j] == 0.0) continue;
+
+        std::copy(rhs + j * rhsStride, rhs + j * rhsStride + rhsCols, work.begin());
+        for (std::size_t i = j + 1; i < m; ++i) {
+            double v = a[i * lda + j];
+            const double* line = rhs + i * rhsStride;
+            for (std::size_t c = 0; c < rhsCols; ++c) {
+                work[c] += v * line[c];
+            }
+        }
+        for (std::size_t c = 0; c < rhsCols; ++c) {
+            rhs[j * rhsStride + c] -= tau[j] * work[c];
+        }
+        for (std::size_t i = j + 1; i < m; ++i) {
+            double scaledV = tau[j] * a[i * lda + j];
+            double* line = rhs + i * rhsStride;
+            for (std::size_t c = 0; c < rhsCols; ++c) {
+                line[c] -= scaledV * work[c];
+            }
+        }
+    }
+}
+
+std::vector<double> QRDecomposition::solve(const std::vector<double>& rhs) const {
+    return vectorFromColumn(solve(columnFromVector(rhs)));
+}
+
+RealMatrix QRDecomposition::solve(const RealMatrix& rhs) const {
+    if (rhs.getRows() != getRows()) {
+        throw std::invalid_argument("Right-hand side row count must match matrix rows");
+    }
+    if (!isFullRank()) {
+        throw std::runtime_error("Matrix is rank deficient");
+    }
+
+    RealMatrix work(rhs);
+    applyQTranspose(work.getData(), work.getRowStride(), work.getCols());
+    kernels::solveUpperInPlace(getCols(), factors.getData(), factors.getRowStride(), 1,
+                      work.getData(), work.getRowStride(), work.getCols());
+    return work.extractSubmatrix(0, 0, getCols(), work.getCols());
+}
+
+RealMatrix QRDecomposition::inverse() const {
+    if (getRows() != getCols()) {
+        throw std::invalid_argument("Matrix must be square to compute inverse");
+    }
+    return solve(RealMatrix::createIdentity(getRows()));
+}
+
+double QRDecomposition::determinant() const {
+    if (getRows() != getCols()) {
+        throw std::invalid_argument("Matrix must be square to compute determinant");
+    }
+    // Каждое нетривиальное отражение меняет знак определителя
+    double det = 1.0;
+    for (std::size_t i = 0; i < getCols(); ++i) {
+        det *= factors.getData()[i * factors.getRowStride() + i];
+        if (tau[i] != 0.0) {
+            det = -det;
+        }
+    }
+    return det;
+}
+
+RealMatrix QRDecomposition::getQ() const {
+    const std::size_t m = getRows();
+    const std::size_t n = getCols();
+    const std::size_t lda = factors.getRowStride();
+    const double* a = factors.getData();
+
+    // Q = H_0 ... H_{n-1} I[:, 0:n]: отражения применяются в обратном порядке
+    RealMatrix q(m, n, 0.0);
+    for (std::size_t i = 0; i < n; ++i) {
+        q.setValue(i, i, 1.0);
+    }
+    double* qData = q.getData();
+    const std::size_t qStride = q.getRowStride();
+    std::vector<double> work(n);
+
+    for (std::size_t j = n; j-- > 0;) {
+        if (tau[j] == 0.0) continue;
+        std::copy(qData + j * qStride, qData + j * qStride + n, work.begin());
+        for (std::size_t i = j + 1; i < m; ++i) {
+            double v = a[i * lda + j];
+            const double* line = qData + i * qStride;
+            for (std::size_t c = 0; c < n; ++c) {
+                work[c] += v * line[c];
+            }
+        }
+        for (std::size_t c = 0; c < n; ++c) {
+            qData[j * qStride + c] -= tau[j] * work[c];
+        }
+        for (std::size_t i = j + 1; i < m; ++i) {
+            double scaledV = tau[j] * a[i * lda + j];
+            double* line = qData + i * qStride;
+            for (std::size_t c = 0; c < n; ++c) {
+                line[c] -= scaledV * work[c];
+            }
+        }
+    }
+    return q;
+}
+
+RealMatrix QRDecomposition::getR() const {
+    const std::size_t n = getCols();
+    RealMatrix r(n, n, 0.0);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = i; j < n; ++j) {
+            r.setValue(i, j, factors.getValue(i, j));
+        }
+    }
+    return r;
+}
@@ -0,0 +1,131 @@
+/**
+ * @file Factorization.h
+ * @brief LU, Cholesky and QR factorizations of RealMatrix for repeated solves
+ * @author Shchurko
+ * @date 2025
+ */
+
+#ifndef MATRIXLAB_FACTORIZATION_H
+#define MATRIXLAB_FACTORIZATION_H
+
+#include <vector>
+#include <cstddef>
+#include "Matrix.h"
+
+// Ширина панели блочных (right-looking) разложений: обновление
+// оставшейся части матрицы идёт через kernels::gemm
+constexpr std::size_t FACTORIZATION_BLOCK = 64;
+
+namespace kernels {
+
+// Решает T X = B на месте (B затирается решением X). T - нижняя
+// треугольная n x n с шагами (tRow, tCol), X - n x nrhs по строкам с шагом
+// xStride. При unitDiagonal диагональ T считается единичной и не читается
+void solveLowerInPlace(std::size_t n, const double* t, std::size_t tRow, std::size_t tCol,
+                       bool unitDiagonal, double* x, std::size_t xStride, std::size_t nrhs);
+
+// То же для верхней треугольной T (обратный ход)
+void solveUpperInPlace(std::size_t n, const double* t, std::size_t tRow, std::size_t tCol,
+                       double* x, std::size_t xStride, std::size_t nrhs);
+
+} // namespace kernels
+
+/**
+ * @brief LU-разложение PA = LU с выбором главного элемента по столбцу
+ *
+ * Разложение выполняется один раз за O(n^3), каждое решение стоит O(n^2)
+ * на столбец правой части. Вырожденная матрица раскладывается без ошибок,
+ * но solve и inverse для неё бросают std::runtime_error.
+ */
+class LUDecomposition {
+public:
+    explicit LUDecomposition(const RealMatrix& matrix);
+
+    std::size_t getSize() const;
+    bool isSingular() const;
+
+    // Решение Ax = b для одного вектора и для нескольких столбцов B
+    std::vector<double> solve(const std::vector<double>& rhs) const;
+    RealMatrix solve(const RealMatrix& rhs) const;
+
+    RealMatrix inverse() const;
+    double determinant() const;
+    // ln|det|; sign получает знак определителя (0 для вырожденной матрицы)
+    double logDeterminant(int& sign) const;
+
+    // Нижняя унитреугольная L, верхняя U и перестановка строк:
+    // строка i матрицы PA - это строка getPermutation()[i] матрицы A
+    RealMatrix getL() const;
+    RealMatrix getU() const;
+    std::vector<std::size_t> getPermutation() const;
+
+private:
+    RealMatrix factors;
+    // pivots[k] - строка, переставленная с k на шаге k
+    std::vector<std::size_t> pivots;
+    int permutationSign;
+};
+
+/**
+ * @brief Разложение Холецкого A = L L^T для симметричной положительно
+ * определённой матрицы
+ *
+ * Конструктор бросает std::invalid_argument, если матрица не квадратная,
+ * не симметричная или не положительно определённая.
+ */
+class CholeskyDecomposition {
+public:
+    explicit CholeskyDecomposition(const RealMatrix& matrix);
+
+    std::size_t getSize() const;
+
+    std::vector<double> solve(const std::vector<double>& rhs) const;
+    RealMatrix solve(const RealMatrix& rhs) const;
+
+    RealMatrix inverse() const;
+    double determinant() const;
+    double logDeterminant() const;
+
+    RealMatrix getL() const;
+
+private:
+    RealMatrix factors;
+};
+
+/**
+ * @brief QR-разложение A = QR отражениями Хаусхолдера (m >= n)
+ *
+ * Для квадратной матрицы solve даёт точное решение, для вытянутой -
+ * решение задачи наименьших квадратов min ||Ax - b||. Если у R есть
+ * нулевой диагональный элемент (неполный ранг), solve бросает
+ * std::runtime_error.
+ */
+class QRDecomposition {
+public:
+    explicit QRDecomposition(const RealMatrix& matrix);
+
+    std::size_t getRows() const;
+    std::size_t getCols() const;
+    bool isFullRank() const;
+
+    std::vector<double> solve(const std::vector<double>& rhs) const;
+    RealMatrix solve(const RealMatrix& rhs) const;
+
+    // Только для квадратной матрицы
+    RealMatrix inverse() const;
+    double determinant() const;
+
+    // Q размера m x n с ортонормированными столбцами и верхняя треугольная R (n x n)
+    RealMatrix getQ() const;
+    RealMatrix getR() const;
+
+private:
+    // Применяет Q^T к столбцам rhs (m x nrhs) на месте
+    void applyQTranspose(double* rhs, std::size_t rhsStride, std::size_t rhsCols) const;
+
+    // Над диагональю и на ней - R, под диагональю - векторы отражений
+    RealMatrix factors;
+    std::vector<double> tau;
+};
+
+#endif // MATRIXLAB_FACTORIZATION_H
@@ -0,0 +1,386 @@
+/**
+ * @file Gemm.cpp
+ * @brief Implementation of cache-blocked matrix multiplication
+ * @author Shchurko
+ * @date 2025
+ */
+
+#include "Gemm.h"
+#include "AlignedAllocator.h"
+#include "SimdKernels.h"
+#include "ThreadPool.h"
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <functional>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define MATRIX_GEMM_X86 1
+#include <immintrin.h>
+#else
+#define MATRIX_GEMM_X86 0
+#endif
+
+namespace kernels {
+
+namespace {
+
+using PackBuffer = std::vector<double, AlignedAllocator<double>>;
+
+// C = alpha * (упакованная A) * (упакованная B) + beta * C для блока mr x nr
+using MicroKernelFunction = void (*)(std::size_t kc, const double* packedA, const double* packedB,
+                                     double* c, std::size_t cRowStride, double alpha, double beta);
+
+struct MicroKernel {
+    std::size_t mr;
+    std::size_t nr;
+    MicroKernelFunction compute;
+};
+
+// Наибольший регистровый блок среди микроядер (для краевого буфера)
+constexpr std::size_t MAX_MR = 8;
+constexpr std::size_t MAX_NR = 16;
+
+// Переносимое микроядро 4 x 8: компилятор векторизует его под базовый SSE2
+constexpr std::size_t GENERIC_MR = 4;
+constexpr std::size_t GENERIC_NR = 8;
+
+void microKernelGeneric(std::size_t kc, const double* packedA, const double* packedB,
+                        double* c, std::size_t cRowStride, double alpha, double beta) {
+    double accumulator[GENERIC_MR][GENERIC_NR] = {};
+
+    for (std::size_t p = 0; p < kc; ++p) {
+        const double* aColumn = packedA + p * GENERIC_MR;
+        const double* bRow = packedB + p * GENERIC_NR;
+        for (std::size_t i = 0; i < GENERIC_MR; ++i) {
+            double aValue = aColumn[i];
+            for (std::size_t j = 0; j < GENERIC_NR; ++j) {
+                accumulator[i][j] += aValue * bRow[j];
+            }
+        }
+    }
+
+    for (std::size_t i = 0; i < GENERIC_MR; ++i) {
+        double* cRow = c + i * cRowStride;
+        if (beta == 0.0) {
+            for (std::size_t j = 0; j < GENERIC_NR; ++j) {
+                cRow[j] = alpha * accumulator[i][j];
+            }
+        } else {
+            for (std::size_t j = 0; j < GENERIC_NR; ++j) {
+                cRow[j] = beta * cRow[j] + alpha * accumulator[i][j];
+            }
+        }
+    }
+}
+
+#if MATRIX_GEMM_X86
+
+// AVX2 + FMA, блок 6 x 8: 12 аккумуляторов ymm, 2 регистра под строку B
+__attribute__((target("avx2,fma")))
+void microKernelAvx2(std::size_t kc, const double* packedA, const double* packedB,
+                     double* c, std::size_t cRowStride, double alpha, double beta) {
+    constexpr std::size_t MR = 6;
+    __m256d accumulator[MR][2];
+#pragma GCC unroll 6
+    for (std::size_t i = 0; i < MR; ++i) {
+        accumulator[i][0] = _mm256_setzero_pd();
+        accumulator[i][1] = _mm256_setzero_pd();
+    }
+
+    for (std::size_t p = 0; p < kc; ++p) {
+        __m256d b0 = _mm256_load_pd(packedB);
+        __m256d b1 = _mm256_load_pd(packedB + 4);
+#pragma GCC unroll 6
+        for (std::size_t i = 0; i < MR; ++i) {
+            __m256d aValue = _mm256_broadcast_sd(packedA + i);
+            accumulator[i][0] = _mm256_fmadd_pd(aValue, b0, accumulator[i][0]);
+            accumulator[i][1] = _mm256_fmadd_pd(aValue, b1, accumulator[i][1]);
+        }
+        packedA += MR;
+        packedB += 8;
+    }
+
+    __m256d vAlpha = _mm256_set1_pd(alpha);
+    __m256d vBeta = _mm256_set1_pd(beta);
+#pragma GCC unroll 6
+    for (std::size_t i = 0; i < MR; ++i) {
+        double* cRow = c + i * cRowStride;
+        __m256d r0 = _mm256_mul_pd(vAlpha, accumulator[i][0]);
+        __m256d r1 = _mm256_mul_pd(vAlpha, accumulator[i][1]);
+        if (beta != 0.0) {
+            r0 = _mm256_fmadd_pd(vBeta, _mm256_loadu_pd(cRow), r0);
+            r1 = _mm256_fmadd_pd(vBeta, _mm256_loadu_pd(cRow + 4), r1);
+        }
+        _mm256_storeu_pd(cRow, r0);
+        _mm256_storeu_pd(cRow + 4, r1);
+    }
+}
+
+// AVX-512, блок 8 x 16: 16 аккумуляторов zmm
+__attribute__((target("avx512f")))
+void microKernelAvx512(std::size_t kc, const double* packedA, const double* packedB,
+                       double* c, std::size_t cRowStride, double alpha, double beta) {
+    constexpr std::size_t MR = 8;
+    __m512d accumulator[MR][2];
+#pragma GCC unroll 8
+    for (std::size_t i = 0; i < MR; ++i) {
+        accumulator[i][0] = _mm512_setzero_pd();
+        accumulator[i][1] = _mm512_setzero_pd();
+    }
+
+    for (std::size_t p = 0; p < kc; ++p) {
+        __m512d b0 = _mm512_load_pd(packedB);
+        __m512d b1 = _mm512_load_pd(packedB + 8);
+#pragma GCC unroll 8
+        for (std::size_t i = 0; i < MR; ++i) {
+            __m512d aValue = _mm512_set1_pd(packedA[i]);
+            accumulator[i][0] = _mm512_fmadd_pd(aValue, b0, accumulator[i][0]);
+            accumulator[i][1] = _mm512_fmadd_pd(aValue, b1, accumulator[i][1]);
+        }
+        packedA += MR;
+        packedB += 16;
+    }
+
+    __m512d vAlpha = _mm512_set1_pd(alpha);
+    __m512d vBeta = _mm512_set1_pd(beta);
+#pragma GCC unroll 8
+    for (std::size_t i = 0; i < MR; ++i) {
+        double* cRow = c + i * cRowStride;
+        __m512d r0 = _mm512_mul_pd(vAlpha, accumulator[i][0]);
+        __m512d r1 = _mm512_mul_pd(vAlpha, accumulator[i][1]);
+        if (beta != 0.0) {
+            r0 = _mm512_fmadd_pd(vBeta, _mm512_loadu_pd(cRow), r0);
+            r1 = _mm512_fmadd_pd(vBeta, _mm512_loadu_pd(cRow + 8), r1);
+        }
+        _mm512_storeu_pd(cRow, r0);
+        _mm512_storeu_pd(cRow + 8, r1);
+    }
+}
+
+#endif // MATRIX_GEMM_X86
+
+MicroKernel selectMicroKernel() {
+#if MATRIX_GEMM_X86
+    switch (getSimdLevel()) {
+        case SimdLevel::AVX512: return {8, 16, microKernelAvx512};
+        case SimdLevel::AVX2: return {6, 8, microKernelAvx2};
+        default: break;
+    }
+#endif
+    return {GENERIC_MR, GENERIC_NR, microKernelGeneric};
+}
+
+// Блок mc x kc матрицы A раскладывается в панели по mr строк,
+// внутри панели - столбец за столбцом; недостающие строки заполняются нулями
+void packA(std::size_t mc, std::size_t kc, const double* a,
+           std::size_t rowStride, std::size_t colStride, std::size_t mr, double* packed) {
+    for (std::size_t ir = 0; ir < mc; ir += mr) {
+        std::size_t rows = std::min(mr, mc - ir);
+        for (std::size_t p = 0; p < kc; ++p) {
+            const double* source = a + ir * rowStride + p * colStride;
+            std::size_t i = 0;
+            for (; i < rows; ++i) {
+                packed[i] = source[i * rowStride];
+            }
+            for (; i < mr; ++i) {
+                packed[i] = 0.0;
+            }
+            packed += mr;
+        }
+    }
+}
+
+// Блок kc x nc матрицы B раскладывается в панели по nr столбцов,
+// внутри панели - строка за строкой
+void packB(std::size_t kc, std::size_t nc, const double* b,
+           std::size_t rowStride, std::size_t colStride, std::size_t nr, double* packed) {
+    for (std::size_t jr = 0; jr < nc; jr += nr) {
+        std::size_t cols = std::min(nr, nc - jr);
+        for (std::size_t p = 0; p < kc; ++p) {
+            const double* source = b + p * rowStride + jr * colStride;
+            std::size_t j = 0;
+            if (colStride == 1) {
+                for (; j < cols; ++j) {
+                    packed[j] = source[j];
+                }
+            } else {
+                for (; j < cols; ++j) {
+                    packed[j] = source[j * colStride];
+                }
+            }
+            for (; j < nr; ++j) {
+                packed[j] = 0.0;
+            }
+            packed += nr;
+        }
+    }
+}
+
+void macroKernel(const MicroKernel& kernel, std::size_t mc, std::size_t nc, std::size_t kc,
+                 const double* packedA, const double* packedB, double alpha,
+                 double beta, double* c, std::size_t cRowStride) {
+    alignas(MATRIX_ALIGNMENT) double edge[MAX_MR * MAX_NR];
+    const std::size_t mr = kernel.mr;
+    const std::size_t nr = kernel.nr;
+
+    for (std::size_t jr = 0; jr < nc; jr += nr) {
+        std::size_t cols = std::min(nr, nc - jr);
+        const double* bPanel = packedB + jr * kc;
+
+        for (std::size_t ir = 0; ir < mc; ir += mr) {
+            std::size_t rows = std::min(mr, mc - ir);
+            const double* aPanel = packedA + ir * kc;
+            double* cTile = c + ir * cRowStride + jr;
+
+            if (rows == mr && cols == nr) {
+                kernel.compute(kc, aPanel, bPanel, cTile, cRowStride, alpha, beta);
+                continue;
+            }
+
+            // Краевой блок считается во временный буфер и копируется частично
+            kernel.compute(kc, aPanel, bPanel, edge, nr, alpha, 0.0);
+            for (std::size_t i = 0; i < rows; ++i) {
+                double* cRow = cTile + i * cRowStride;
+                const double* edgeRow = edge + i * nr;
+                for (std::size_t j = 0; j < cols; ++j) {
+                    cRow[j] = (beta == 0.0) ? edgeRow[j] : beta * cRow[j] + edgeRow[j];
+                }
+            }
+        }
+    }
+}
+
+void scaleC(std::size_t m, std::size_t n, double beta, double* c, std::size_t cRowStride) {
+    for (std::size_t i = 0; i < m; ++i) {
+        double* cRow = c + i * cRowStride;
+        for (std::size_t j = 0; j < n; ++j) {
+            cRow[j] = (beta == 0.0) ? 0.0 : beta * cRow[j];
+        }
+    }
+}
+
+} // namespace
+
+void gemmNaive(std::size_t m, std::size_t n, std::size_t k, double alpha,
+               const double* a, std::size_t aRowStride, std::size_t aColStride,
+               const double* b, std::size_t bRowStride, std::size_t bColStride,
+               double beta, double* c, std::size_t cRowStride) {
+    scaleC(m, n, beta, c, cRowStride);
+    if (alpha == 0.0) return;
+
+    for (std::size_t i = 0; i < m; ++i) {
+        double* cRow = c + i * cRowStride;
+        for (std::size_t p = 0; p < k; ++p) {
+            double aValue = alpha * a[i * aRowStride + p * aColStride];
+            const double* bRow = b + p * bRowStride;
+            for (std::size_t j = 0; j < n; ++j) {
+                cRow[j] += aValue * bRow[j * bColStride];
+            }
+        }
+    }
+}
+
+void gemm(std::size_t m, std::size_t n, std::size_t k, double alpha,
+          const double* a, std::size_t aRowStride, std::size_t aColStride,
+          const double* b, std::size_t bRowStride, std::size_t bColStride,
+          double beta, double* c, std::size_t cRowStride) {
+    if (m == 0 || n == 0) return;
+    if (k == 0 || alpha == 0.0) {
+        scaleC(m, n, beta, c, cRowStride);
+        return;
+    }
+    if (m * n * k <= GEMM_SMALL_WORK) {
+        gemmNaive(m, n, k, alpha, a, aRowStride, aColStride,
+                  b, bRowStride, bColStride, beta, c, cRowStride);
+        return;
+    }
+
+    const MicroKernel kernel = selectMicroKernel();
+    const std::size_t mr = kernel.mr;
+    const std::size_t nr = kernel.nr;
+
+    // Пул удерживается до конца умножения: число потоков задаёт буферы
+    std::shared_ptr<ThreadPool> pool;
+    if (m * n * k >= getGemmParallelThreshold()) {
+        pool = ThreadPool::global();
+        if (pool->getThreadCount() == 1) pool.reset();
+    }
+    const std::size_t threads = pool ? pool->getThreadCount() : 1;
+    auto run = [&pool](std::size_t count, const std::function<void(std::size_t)>& task) {
+        if (pool) {
+            pool->parallelFor(count, task);
+        } else {
+            for (std::size_t i = 0; i < count; ++i) task(i);
+        }
+    };
+
+    // Панель B общая для всех потоков; буферы A у каждого потока свои.
+    // Буферы переиспользуются между вызовами
+    thread_local PackBuffer packedB;
+    std::size_t roundedNc = (std::min(GEMM_NC, n) + nr - 1) / nr * nr;
+    if (packedB.size() < roundedNc * GEMM_KC) packedB.resize(roundedNc * GEMM_KC);
+    double* sharedB = packedB.data();
+
+    const std::size_t icBlocks = (m + GEMM_MC - 1) / GEMM_MC;
+
+    for (std::size_t jc = 0; jc < n; jc += GEMM_NC) {
+        const std::size_t nc = std::min(GEMM_NC, n - jc);
+        const std::size_t panels = (nc + nr - 1) / nr;
+
+        // Если блоков по строкам меньше, чем потоков, выходные блоки
+        // дополнительно режутся по столбцам (границы кратны nr). Каждый
+        // элемент C считается одним потоком в одном и том же порядке,
+        // поэтому результат побитово совпадает при любом числе потоков
+        const std::size_t columnChunks = std::min(panels, (threads + icBlocks - 1) / icBlocks);
+        const std::size_t panelsPerChunk = (panels + columnChunks - 1) / columnChunks;
+        const std::size_t packChunks = std::min(panels, threads);
+        const std::size_t panelsPerPack = (panels + packChunks - 1) / packChunks;
+
+        for (std::size_t pc = 0; pc < k; pc += GEMM_KC) {
+            const std::size_t kc = std::min(GEMM_KC, k - pc);
+            // beta применяется только к первому блоку по k
+            const double blockBeta = (pc == 0) ? beta : 1.0;
+            const double* bBlock = b + pc * bRowStride + jc * bColStride;
+
+            run(packChunks, [&](std::size_t chunk) {
+                std::size_t jStart = chunk * panelsPerPack * nr;
+                if (jStart >= nc) return;
+                std::size_t width = std::min(panelsPerPack * nr, nc - jStart);
+                packB(kc, width, bBlock + jStart * bColStride, bRowStride, bColStride,
+                      nr, sharedB + jStart * kc);
+            });
+
+            run(icBlocks * columnChunks, [&](std::size_t task) {
+                const std::size_t ic = (task / columnChunks) * GEMM_MC;
+                const std::size_t jStart = (task % columnChunks) * panelsPerChunk * nr;
+                if (jStart >= nc) return;
+                const std::size_t mc = std::min(GEMM_MC, m - ic);
+                const std::size_t width = std::min(panelsPerChunk * nr, nc - jStart);
+
+                thread_local PackBuffer packedA;
+                std::size_t roundedMc = (GEMM_MC + mr - 1) / mr * mr;
+                if (packedA.size() < roundedMc * GEMM_KC) packedA.resize(roundedMc * GEMM_KC);
+
+                packA(mc, kc, a + ic * aRowStride + pc * aColStride,
+                      aRowStride, aColStride, mr, packedA.data());
+                macroKernel(kernel, mc, width, kc, packedA.data(), sharedB + jStart * kc, alpha,
+                            blockBeta, c + ic * cRowStride + jc + jStart, cRowStride);
+            });
+        }
+    }
+}
+
+namespace {
+std::atomic<std::size_t> gemmParallelThreshold{GEMM_PARALLEL_WORK};
+} // namespace
+
+void setGemmParallelThreshold(std::size_t work) {
+    gemmParallelThreshold.store(work, std::memory_order_relaxed);
+}
+
+std::size_t getGemmParallelThreshold() {
+    return gemmParallelThreshold.load(std::memory_order_relaxed);
+}
+
+} // namespace kernels
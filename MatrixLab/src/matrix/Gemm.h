@@ -0,0 +1,54 @@
+/**
+ * @file Gemm.h
+ * @brief Cache-blocked general matrix multiplication kernel
+ * @author Shchurko
+ * @date 2025
+ */
+
+#ifndef MATRIXLAB_GEMM_H
+#define MATRIXLAB_GEMM_H
+
+#include <cstddef>
+
+namespace kernels {
+
+// Размеры блоков: KC x NR панель B живёт в L1, MC x KC блок A - в L2,
+// KC x NC панель B - в L3
+constexpr std::size_t GEMM_MC = 96;
+constexpr std::size_t GEMM_KC = 256;
+constexpr std::size_t GEMM_NC = 2048;
+
+// Ниже этого числа умножений-сложений упаковка не окупается
+constexpr std::size_t GEMM_SMALL_WORK = 32 * 32 * 32;
+
+// Начиная с этого числа умножений-сложений gemm раздаёт блоки
+// по общему пулу потоков (ThreadPool::global)
+constexpr std::size_t GEMM_PARALLEL_WORK = 128 * 128 * 128;
+
+/**
+ * @brief C = alpha * A * B + beta * C
+ *
+ * A (m x k) и B (k x n) задаются шагами по строкам и столбцам, поэтому
+ * транспонированный операнд передаётся перестановкой шагов. C (m x n)
+ * хранится по строкам с шагом cRowStride. При beta == 0 старое
+ * содержимое C не читается. Результат побитово одинаков при любом
+ * числе потоков.
+ */
+void gemm(std::size_t m, std::size_t n, std::size_t k, double alpha,
+          const double* a, std::size_t aRowStride, std::size_t aColStride,
+          const double* b, std::size_t bRowStride, std::size_t bColStride,
+          double beta, double* c, std::size_t cRowStride);
+
+// Простой цикл i-k-j без упаковки, используется для маленьких размеров
+void gemmNaive(std::size_t m, std::size_t n, std::size_t k, double alpha,
+               const double* a, std::size_t aRowStride, std::size_t aColStride,
+               const double* b, std::size_t bRowStride, std::size_t bColStride,
+               double beta, double* c, std::size_t cRowStride);
+
+// Порог параллельного режима (m * n * k); меньшие задачи считаются в одном потоке
+void setGemmParallelThreshold(std::size_t work);
+std::size_t getGemmParallelThreshold();
+
+} // namespace kernels
+
+#endif // MATRIXLAB_GEMM_H
@@ -0,0 +1,410 @@
+/**
+ * @file Gemv.cpp
+ * @brief Four-row GEMV kernels (scalar, AVX2, AVX-512) and their threading
+ * @author Shchurko
+ * @date 2025
+ */
+
+#include "Gemv.h"
+#include "SimdKernels.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define MATRIX_GEMV_X86 1
+#include <immintrin.h>
+#else
+#define MATRIX_GEMV_X86 0
+#endif
+
+namespace kernels {
+
+namespace {
+
+// Строк A за один проход ядра
+constexpr std::size_t GEMV_ROWS = 4;
+// Наименьший участок строк (gemv) или столбцов (gemvTransposed) на поток
+constexpr std::size_t MIN_ROWS_PER_TASK = 64;
+constexpr std::size_t MIN_COLS_PER_TASK = 256;
+// symvUpper: не меньше SYMV_MIN_ROWS строк и не больше SYMV_MAX_TASKS задач
+constexpr std::size_t SYMV_MIN_ROWS = 128;
+constexpr std::size_t SYMV_MAX_TASKS = 8;
+
+// out[r] = dot(rows[r], x) для четырёх строк
+using DotRowsFunction = void (*)(const double* const* rows, const double* x, std::size_t n, double* out);
+// y += sum_r factors[r] * rows[r] для четырёх строк
+using AxpyRowsFunction = void (*)(const double* const* rows, const double* factors, double* y, std::size_t n);
+// То и другое за один проход по строкам (симметричное произведение)
+using DotAxpyRowsFunction = void (*)(const double* const* rows, const double* x, const double* factors,
+                                     double* y, std::size_t n, double* out);
+
+struct GemvKernel {
+    DotRowsFunction dotRows;
+    AxpyRowsFunction axpyRows;
+    DotAxpyRowsFunction dotAxpyRows;
+};
+
+void dotRowsGeneric(const double* const* rows, const double* x, std::size_t n, double* out) {
+    double sum0 = 0.0, sum1 = 0.0, sum2 = 0.0, sum3 = 0.0;
+    for (std::size_t j = 0; j < n; ++j) {
+        sum0 += rows[0][j] * x[j];
+        sum1 += rows[1][j] * x[j];
+        sum2 += rows[2][j] * x[j];
+        sum3 += rows[3][j] * x[j];
+    }
+    out[0] = sum0;
+    out[1] = sum1;
+    out[2] = sum2;
+    out[3] = sum3;
+}
+
+void axpyRowsGeneric(const double* const* rows, const double* factors, double* y, std::size_t n) {
+    for (std::size_t j = 0; j < n; ++j) {
+        y[j] += factors[0] * rows[0][j] + factors[1] * rows[1][j] +
+                factors[2] * rows[2][j] + factors[3] * rows[3][j];
+    }
+}
+
+void dotAxpyRowsGeneric(const double* const* rows, const double* x, const double* factors,
+                        double* y, std::size_t n, double* out) {
+    double sum0 = 0.0, sum1 = 0.0, sum2 = 0.0, sum3 = 0.0;
+    for (std::size_t j = 0; j < n; ++j) {
+        const double a0 = rows[0][j], a1 = rows[1][j], a2 = rows[2][j], a3 = rows[3][j];
+        sum0 += a0 * x[j];
+        sum1 += a1 * x[j];
+        sum2 += a2 * x[j];
+        sum3 += a3 * x[j];
+        y[j] += factors[0] * a0 + factors[1] * a1 + factors[2] * a2 + factors[3] * a3;
+    }
+    out[0] = sum0;
+    out[1] = sum1;
+    out[2] = sum2;
+    out[3] = sum3;
+}
+
+#if MATRIX_GEMV_X86
+
+__attribute__((target("avx2,fma")))
+double horizontalSumAvx2(__m256d value) {
+    __m128d pair = _mm_add_pd(_mm256_castpd256_pd128(value), _mm256_extractf128_pd(value, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(pair, _mm_unpackhi_pd(pair, pair)));
+}
+
+__attribute__((target("avx2,fma")))
+void dotRowsAvx2(const double* const* rows, const double* x, std::size_t n, double* out) {
+    __m256d sum0 = _mm256_setzero_pd();
+    __m256d sum1 = _mm256_setzero_pd();
+    __m256d sum2 = _mm256_setzero_pd();
+    __m256d sum3 = _mm256_setzero_pd();
+    std::size_t j = 0;
+    for (; j + 4 <= n; j += 4) {
+        const __m256d xValue = _mm256_loadu_pd(x + j);
+        sum0 = _mm256_fmadd_pd(_mm256_loadu_pd(rows[0] + j), xValue, sum0);
+        sum1 = _mm256_fmadd_pd(_mm256_loadu_pd(rows[1] + j), xValue, sum1);
+        sum2 = _mm256_fmadd_pd(_mm256_loadu_pd(rows[2] + j), xValue, sum2);
+        sum3 = _mm256_fmadd_pd(_mm256_loadu_pd(rows[3] + j), xValue, sum3);
+    }
+    out[0] = horizontalSumAvx2(sum0);
+    out[1] = horizontalSumAvx2(sum1);
+    out[2] = horizontalSumAvx2(sum2);
+    out[3] = horizontalSumAvx2(sum3);
+    for (; j < n; ++j) {
+        for (std::size_t r = 0; r < GEMV_ROWS; ++r) out[r] += rows[r][j] * x[j];
+    }
+}
+
+__attribute__((target("avx2,fma")))
+void axpyRowsAvx2(const double* const* rows, const double* factors, double* y, std::size_t n) {
+    const __m256d f0 = _mm256_set1_pd(factors[0]);
+    const __m256d f1 = _mm256_set1_pd(factors[1]);
+    const __m256d f2 = _mm256_set1_pd(factors[2]);
+    const __m256d f3 = _mm256_set1_pd(factors[3]);
+    std::size_t j = 0;
+    for (; j + 4 <= n; j += 4) {
+        __m256d sum = _mm256_loadu_pd(y + j);
+        sum = _mm256_fmadd_pd(_mm256_loadu_pd(rows[0] + j), f0, sum);
+        sum = _mm256_fmadd_pd(_mm256_loadu_pd(rows[1] + j), f1, sum);
+        sum = _mm256_fmadd_pd(_mm256_loadu_pd(rows[2] + j), f2, sum);
+        sum = _mm256_fmadd_pd(_mm256_loadu_pd(rows[3] + j), f3, sum);
+        _mm256_storeu_pd(y + j, sum);
+    }
+    for (; j < n; ++j) {
+        y[j] += factors[0] * rows[0][j] + factors[1] * rows[1][j] +
+                factors[2] * rows[2][j] + factors[3] * rows[3][j];
+    }
+}
+
+__attribute__((target("avx2,fma")))
+void dotAxpyRowsAvx2(const double* const* rows, const double* x, const double* factors,
+                     double* y, std::size_t n, double* out) {
+    const __m256d f0 = _mm256_set1_pd(factors[0]);
+    const __m256d f1 = _mm256_set1_pd(factors[1]);
+    const __m256d f2 = _mm256_set1_pd(factors[2]);
+    const __m256d f3 = _mm256_set1_pd(factors[3]);
+    __m256d sum0 = _mm256_setzero_pd();
+    __m256d sum1 = _mm256_setzero_pd();
+    __m256d sum2 = _mm256_setzero_pd();
+    __m256d sum3 = _mm256_setzero_pd();
+    std::size_t j = 0;
+    for (; j + 4 <= n; j += 4) {
+        const __m256d xValue = _mm256_loadu_pd(x + j);
+        const __m256d a0 = _mm256_loadu_pd(rows[0] + j);
+        const __m256d a1 = _mm256_loadu_pd(rows[1] + j);
+        const __m256d a2 = _mm256_loadu_pd(rows[2] + j);
+        const __m256d a3 = _mm256_loadu_pd(rows[3] + j);
+        sum0 = _mm256_fmadd_pd(a0, xValue, sum0);
+        sum1 = _mm256_fmadd_pd(a1, xValue, sum1);
+        sum2 = _mm256_fmadd_pd(a2, xValue, sum2);
+        sum3 = _mm256_fmadd_pd(a3, xValue, sum3);
+        __m256d yValue = _mm256_loadu_pd(y + j);
+        yValue = _mm256_fmadd_pd(a0, f0, yValue);
+        yValue = _mm256_fmadd_pd(a1, f1, yValue);
+        yValue = _mm256_fmadd_pd(a2, f2, yValue);
+        yValue = _mm256_fmadd_pd(a3, f3, yValue);
+        _mm256_storeu_pd(y + j, yValue);
+    }
+    out[0] = horizontalSumAvx2(sum0);
+    out[1] = horizontalSumAvx2(sum1);
+    out[2] = horizontalSumAvx2(sum2);
+    out[3] = horizontalSumAvx2(sum3);
+    for (; j < n; ++j) {
+        for (std::size_t r = 0; r < GEMV_ROWS; ++r) out[r] += rows[r][j] * x[j];
+        y[j] += factors[0] * rows[0][j] + factors[1] * rows[1][j] +
+                factors[2] * rows[2][j] + factors[3] * rows[3][j];
+    }
+}
+
+// Хвост строки - загрузкой по маске, без скалярного цикла
+__attribute__((target("avx512f")))
+__mmask8 gemvTailMask(std::size_t remaining) {
+    return static_cast<__mmask8>((1u << remaining) - 1u);
+}
+
+__attribute__((target("avx512f")))
+void dotRowsAvx512(const double* const* rows, const double* x, std::size_t n, double* out) {
+    __m512d sum0 = _mm512_setzero_pd();
+    __m512d sum1 = _mm512_setzero_pd();
+    __m512d sum2 = _mm512_setzero_pd();
+    __m512d sum3 = _mm512_setzero_pd();
+    for (std::size_t j = 0; j < n; j += 8) {
+        const __mmask8 mask = gemvTailMask(n - j < 8 ? n - j : 8);
+        const __m512d xValue = _mm512_maskz_loadu_pd(mask, x + j);
+        sum0 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, rows[0] + j), xValue, sum0);
+        sum1 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, rows[1] + j), xValue, sum1);
+        sum2 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, rows[2] + j), xValue, sum2);
+        sum3 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, rows[3] + j), xValue, sum3);
+    }
+    out[0] = _mm512_reduce_add_pd(sum0);
+    out[1] = _mm512_reduce_add_pd(sum1);
+    out[2] = _mm512_reduce_add_pd(sum2);
+    out[3] = _mm512_reduce_add_pd(sum3);
+}
+
+__attribute__((target("avx512f")))
+void axpyRowsAvx512(const double* const* rows, const double* factors, double* y, std::size_t n) {
+    const __m512d f0 = _mm512_set1_pd(factors[0]);
+    const __m512d f1 = _mm512_set1_pd(factors[1]);
+    const __m512d f2 = _mm512_set1_pd(factors[2]);
+    const __m512d f3 = _mm512_set1_pd(factors[3]);
+    for (std::size_t j = 0; j < n; j += 8) {
+        const __mmask8 mask = gemvTailMask(n - j < 8 ? n - j : 8);
+        __m512d sum = _mm512_maskz_loadu_pd(mask, y + j);
+        sum = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, rows[0] + j), f0, sum);
+        sum = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, rows[1] + j), f1, sum);
+        sum = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, rows[2] + j), f2, sum);
+        sum = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, rows[3] + j), f3, sum);
+        _mm512_mask_storeu_pd(y + j, mask, sum);
+    }
+}
+
+__attribute__((target("avx512f")))
+void dotAxpyRowsAvx512(const double* const* rows, const double* x, const double* factors,
+                       double* y, std::size_t n, double* out) {
+    const __m512d f0 = _mm512_set1_pd(factors[0]);
+    const __m512d f1 = _mm512_set1_pd(factors[1]);
+    const __m512d f2 = _mm512_set1_pd(factors[2]);
+    const __m512d f3 = _mm512_set1_pd(factors[3]);
+    __m512d sum0 = _mm512_setzero_pd();
+    __m512d sum1 = _mm512_setzero_pd();
+    __m512d sum2 = _mm512_setzero_pd();
+    __m512d sum3 = _mm512_setzero_pd();
+    for (std::size_t j = 0; j < n; j += 8) {
+        const __mmask8 mask = gemvTailMask(n - j < 8 ? n - j : 8);
+        const __m512d xValue = _mm512_maskz_loadu_pd(mask, x + j);
+        const __m512d a0 = _mm512_maskz_loadu_pd(mask, rows[0] + j);
+        const __m512d a1 = _mm512_maskz_loadu_pd(mask, rows[1] + j);
+        const __m512d a2 = _mm512_maskz_loadu_pd(mask, rows[2] + j);
+        const __m512d a3 = _mm512_maskz_loadu_pd(mask, rows[3] + j);
+        sum0 = _mm512_fmadd_pd(a0, xValue, sum0);
+        sum1 = _mm512_fmadd_pd(a1, xValue, sum1);
+        sum2 = _mm512_fmadd_pd(a2, xValue, sum2);
+        sum3 = _mm512_fmadd_pd(a3, xValue, sum3);
+        __m512d yValue = _mm512_maskz_loadu_pd(mask, y + j);
+        yValue = _mm512_fmadd_pd(a0, f0, yValue);
+        yValue = _mm512_fmadd_pd(a1, f1, yValue);
+        yValue = _mm512_fmadd_pd(a2, f2, yValue);
+        yValue = _mm512_fmadd_pd(a3, f3, yValue);
+        _mm512_mask_storeu_pd(y + j, mask, yValue);
+    }
+    out[0] = _mm512_reduce_add_pd(sum0);
+    out[1] = _mm512_reduce_add_pd(sum1);
+    out[2] = _mm512_reduce_add_pd(sum2);
+    out[3] = _mm512_reduce_add_pd(sum3);
+}
+
+#endif // MATRIX_GEMV_X86
+
+GemvKernel selectGemvKernel() {
+#if MATRIX_GEMV_X86
+    switch (getSimdLevel()) {
+        case SimdLevel::AVX512: return {dotRowsAvx512, axpyRowsAvx512, dotAxpyRowsAvx512};
+        case SimdLevel::AVX2: return {dotRowsAvx2, axpyRowsAvx2, dotAxpyRowsAvx2};
+        default: break;
+    }
+#endif
+    return {dotRowsGeneric, axpyRowsGeneric, dotAxpyRowsGeneric};
+}
+
+// Делит [0, length) на участки не короче minChunk (кратные step) и
+// выполняет task(begin, end), при достаточной работе - в общем пуле
+template <typename Task>
+void forEachChunk(std::size_t length, std::size_t work, std::size_t minChunk, std::size_t step, Task task) {
+    std::size_t tasks = 1;
+    if (work >= GEMV_PARALLEL_WORK) {
+        tasks = std::min(ThreadPool::getGlobalThreadCount(), std::max<std::size_t>(1, length / minChunk));
+    }
+    if (tasks <= 1) {
+        task(std::size_t{0}, length);
+        return;
+    }
+    const std::size_t units = (length + step - 1) / step;
+    ThreadPool::global()->parallelFor(tasks, [&](std::size_t t) {
+        const std::size_t begin = std::min(length, units * t / tasks * step);
+        const std::size_t end = std::min(length, units * (t + 1) / tasks * step);
+        if (begin < end) task(begin, end);
+    });
+}
+
+// y[i] = alpha * value + beta * y[i]; при beta == 0 y не читается
+inline double combine(double alpha, double value, double beta, double old) {
+    return beta == 0.0 ? alpha * value : alpha * value + beta * old;
+}
+
+// out += A[begin:end, :] x и вклад этих строк в остальные out[j] (j > i)
+// по верхнему треугольнику: диагональный блок 4 x 4 - скалярно, правее - ядром
+void symvRowRange(const GemvKernel& kernel, std::size_t n, const double* a, std::size_t aRowStride,
+                  const double* x, std::size_t begin, std::size_t end, double* out) {
+    std::size_t i = begin;
+    for (; i + GEMV_ROWS <= end; i += GEMV_ROWS) {
+        for (std::size_t p = 0; p < GEMV_ROWS; ++p) {
+            const double* row = a + (i + p) * aRowStride;
+            out[i + p] += row[i + p] * x[i + p];
+            for (std::size_t q = p + 1; q < GEMV_ROWS; ++q) {
+                out[i + p] += row[i + q] * x[i + q];
+                out[i + q] += row[i + q] * x[i + p];
+            }
+        }
+        const std::size_t next = i + GEMV_ROWS;
+        if (next == n) continue;
+        const double* rows[GEMV_ROWS] = {a + i * aRowStride + next, a + (i + 1) * aRowStride + next,
+                                         a + (i + 2) * aRowStride + next, a + (i + 3) * aRowStride + next};
+        double sums[GEMV_ROWS];
+        kernel.dotAxpyRows(rows, x + next, x + i, out + next, n - next, sums);
+        for (std::size_t p = 0; p < GEMV_ROWS; ++p) {
+            out[i + p] += sums[p];
+        }
+    }
+    for (; i < end; ++i) {
+        const double* row = a + i * aRowStride + i;
+        out[i] += dot(row, x + i, n - i);
+        if (i + 1 < n) {
+            axpy(x[i], row + 1, out + i + 1, n - i - 1);
+        }
+    }
+}
+
+} // namespace
+
+void gemv(std::size_t m, std::size_t n, double alpha, const double* a, std::size_t aRowStride,
+          const double* x, double beta, double* y) {
+    if (m == 0) return;
+    const GemvKernel kernel = selectGemvKernel();
+    forEachChunk(m, m * n, MIN_ROWS_PER_TASK, GEMV_ROWS, [&](std::size_t begin, std::size_t end) {
+        std::size_t i = begin;
+        for (; i + GEMV_ROWS <= end; i += GEMV_ROWS) {
+            const double* rows[GEMV_ROWS] = {a + i * aRowStride, a + (i + 1) * aRowStride,
+                                             a + (i + 2) * aRowStride, a + (i + 3) * aRowStride};
+            double sums[GEMV_ROWS];
+            kernel.dotRows(rows, x, n, sums);
+            for (std::size_t r = 0; r < GEMV_ROWS; ++r) {
+                y[i + r] = combine(alpha, sums[r], beta, y[i + r]);
+            }
+        }
+        for (; i < end; ++i) {
+            y[i] = combine(alpha, dot(a + i * aRowStride, x, n), beta, y[i]);
+        }
+    });
+}
+
+void gemvTransposed(std::size_t m, std::size_t n, double alpha, const double* a, std::size_t aRowStride,
+                    const double* x, double beta, double* y) {
+    if (n == 0) return;
+    const GemvKernel kernel = selectGemvKernel();
+    // Участки столбцов кратны строке кэша: потоки не пишут в одну строку y
+    forEachChunk(n, m * n, MIN_COLS_PER_TASK, 8, [&](std::size_t begin, std::size_t end) {
+        double* yPart = y + begin;
+        const std::size_t width = end - begin;
+        if (beta == 0.0) {
+            std::fill(yPart, yPart + width, 0.0);
+        } else if (beta != 1.0) {
+            scale(yPart, beta, yPart, width);
+        }
+
+        std::size_t i = 0;
+        for (; i + GEMV_ROWS <= m; i += GEMV_ROWS) {
+            const double* rows[GEMV_ROWS] = {a + i * aRowStride + begin, a + (i + 1) * aRowStride + begin,
+                                             a + (i + 2) * aRowStride + begin, a + (i + 3) * aRowStride + begin};
+            const double factors[GEMV_ROWS] = {alpha * x[i], alpha * x[i + 1], alpha * x[i + 2], alpha * x[i + 3]};
+            kernel.axpyRows(rows, factors, yPart, width);
+        }
+        for (; i < m; ++i) {
+            axpy(alpha * x[i], a + i * aRowStride + begin, yPart, width);
+        }
+    });
+}
+
+void symvUpper(std::size_t n, double alpha, const double* a, std::size_t aRowStride,
+               const double* x, double beta, double* y) {
+    if (n == 0) return;
+    const GemvKernel kernel = selectGemvKernel();
+    const std::size_t tasks = std::min(SYMV_MAX_TASKS, std::max<std::size_t>(1, n / SYMV_MIN_ROWS));
+
+    // Границы делят треугольник на части равной площади и кратны GEMV_ROWS
+    auto boundary = [&](std::size_t t) {
+        if (t == tasks) return n;
+        const double fraction = static_cast<double>(t) / static_cast<double>(tasks);
+        const double row = static_cast<double>(n) * (1.0 - std::sqrt(1.0 - fraction));
+        return static_cast<std::size_t>(row) / GEMV_ROWS * GEMV_ROWS;
+    };
+    std::vector<double> partial(tasks * n, 0.0);
+    auto runTask = [&](std::size_t t) {
+        symvRowRange(kernel, n, a, aRowStride, x, boundary(t), boundary(t + 1), partial.data() + t * n);
+    };
+    if (tasks > 1 && n * n / 2 >= GEMV_PARALLEL_WORK) {
+        ThreadPool::global()->parallelFor(tasks, runTask);
+    } else {
+        for (std::size_t t = 0; t < tasks; ++t) runTask(t);
+    }
+
+    for (std::size_t i = 0; i < n; ++i) {
+        double sum = partial[i];
+        for (std::size_t t = 1; t < tasks; ++t) {
+            sum += partial[t * n + i];
+        }
+        y[i] = combine(alpha, sum, beta, y[i]);
+    }
+}
+
+} // namespace kernels
@@ -0,0 +1,58 @@
+/**
+ * @file Gemv.h
+ * @brief Matrix-vector product kernels with SIMD dispatch and row/column threading
+ * @author Shchurko
+ * @date 2025
+ */
+
+#ifndef MATRIXLAB_GEMV_H
+#define MATRIXLAB_GEMV_H
+
+#include <cstddef>
+
+namespace kernels {
+
+// Начиная с этого числа элементов A произведение делится между потоками
+// общего пула; меньшие укладываются в кэш и быстрее в одном потоке
+constexpr std::size_t GEMV_PARALLEL_WORK = 1 << 18;
+
+/**
+ * @brief y = alpha * A * x + beta * y
+ *
+ * A (m x n) хранится по строкам с шагом aRowStride, x длины n, y длины m.
+ * Четыре строки A проходятся за один проход по x, так что каждый
+ * загруженный блок x используется четырежды. Строки делятся между
+ * потоками; каждый y[i] считается одной и той же последовательностью
+ * операций, поэтому результат не зависит от числа потоков. При
+ * beta == 0 старое содержимое y не читается.
+ */
+void gemv(std::size_t m, std::size_t n, double alpha, const double* a, std::size_t aRowStride,
+          const double* x, double beta, double* y);
+
+/**
+ * @brief y = alpha * A^T * x + beta * y
+ *
+ * A (m x n) хранится по строкам, x длины m, y длины n. Строки A читаются
+ * подряд: к y прибавляются сразу четыре строки с весами из x. Потоки
+ * делят между собой столбцы (участки y), а не строки, поэтому частичные
+ * суммы не нужно сводить и результат тоже не зависит от числа потоков.
+ */
+void gemvTransposed(std::size_t m, std::size_t n, double alpha, const double* a, std::size_t aRowStride,
+                    const double* x, double beta, double* y);
+
+/**
+ * @brief y = alpha * A * x + beta * y для симметричной A
+ *
+ * A (n x n) задана верхним треугольником по строкам с шагом aRowStride,
+ * нижний не читается. Четыре строки проходятся вместе: каждый элемент
+ * A даёт вклад и в y[i] (как в gemv), и в y[j] (как в gemvTransposed),
+ * так что треугольник читается из памяти один раз. Строки делятся между
+ * задачами по площади с собственными частичными суммами; число задач
+ * зависит только от n, и результат не зависит от числа потоков.
+ */
+void symvUpper(std::size_t n, double alpha, const double* a, std::size_t aRowStride,
+               const double* x, double beta, double* y);
+
+} // namespace kernels
+
+#endif // MATRIXLAB_GEMV_H
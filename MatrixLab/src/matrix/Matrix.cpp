@@ -6,56 +6,138 @@
  */
 
 #include "Matrix.h"
+#include "Gemm.h"
+#include "Strassen.h"
+#include "Transpose.h"
+#include "SimdKernels.h"
+#include "ThreadPool.h"
+#include "Factorization.h"
+#include "MatrixFile.h"
+#include "TextFormat.h"
 #include <fstream>
 #include <sstream>
 #include <algorithm>
-
-const double MATRIX_EPSILON = 1e-12;
+#include <memory>
+#include <limits>
+#include <utility>
+
+// Обходит данные непрерывными участками: весь буфер сразу, если строки
+// идут без выравнивающего хвоста, иначе построчно. Матрицы одного размера
+// имеют одинаковый шаг, поэтому смещение годится для всех операндов.
+// Обход прекращается, как только операция вернёт false
+template <typename Operation>
+bool RealMatrix::forEachSpan(Operation operation) const {
+    if (rowStride == numCols) {
+        return operation(std::size_t{0}, numRows * numCols);
+    }
+    for (std::size_t i = 0; i < numRows; ++i) {
+        if (!operation(i * rowStride, numCols)) {
+            return false;
+        }
+    }
+    return true;
+}
 
 // Конструкторы
-RealMatrix::RealMatrix()
-        : numRows(0), numCols(0), matrixData()
+RealMatrix::BasicMatrix()
+        : numRows(0), numCols(0), rowStride(0), matrixData(), structureCache(0)
 {}
 
-RealMatrix::RealMatrix(std::size_t rows, std::size_t cols, double initValue)
-        : numRows(rows), numCols(cols),
-          matrixData(rows, std::vector<double>(cols, initValue))
+RealMatrix::BasicMatrix(std::size_t rows, std::size_t cols, double initValue)
+        : numRows(rows), numCols(cols), rowStride(computeRowStride(cols)),
+          matrixData(), structureCache(0)
 {
     if (rows == 0 || cols == 0) {
         throw std::invalid_argument("Matrix dimensions must be positive");
     }
+
+    // Хвост строки (выравнивание) всегда остаётся нулевым
+    matrixData.assign(rows * rowStride, 0.0);
+    if (initValue != 0.0) {
+        for (std::size_t i = 0; i < rows; ++i) {
+            std::fill(rowData(i), rowData(i) + cols, initValue);
+        }
+    }
 }
 
-RealMatrix::RealMatrix(const std::vector<std::vector<double>>& inputData) {
+RealMatrix::BasicMatrix(const std::vector<std::vector<double>>& inputData)
+        : numRows(0), numCols(0), rowStride(0), matrixData(), structureCache(0)
+{
     if (inputData.empty() || inputData[0].empty()) {
-        numRows = 0;
-        numCols = 0;
         return;
     }
 
-    numRows = inputData.size();
-    numCols = inputData[0].size();
-    matrixData = inputData;
-
     // Проверка на то, что все строки имеют одинаковую длину
-    for (std::size_t i = 1; i < numRows; ++i) {
-        if (inputData[i].size() != numCols) {
+    for (std::size_t i = 1; i < inputData.size(); ++i) {
+        if (inputData[i].size() != inputData[0].size()) {
             throw std::invalid_argument("All rows must have the same number of columns");
         }
     }
+
+    numRows = inputData.size();
+    numCols = inputData[0].size();
+    rowStride = computeRowStride(numCols);
+    matrixData.assign(numRows * rowStride, 0.0);
+    for (std::size_t i = 0; i < numRows; ++i) {
+        std::copy(inputData[i].begin(), inputData[i].end(), rowData(i));
+    }
 }
 
-RealMatrix::RealMatrix(const RealMatrix& other)
+RealMatrix::BasicMatrix(const RealMatrix& other)
         : numRows(other.numRows), numCols(other.numCols),
-          matrixData(other.matrixData)
+          rowStride(other.rowStride), matrixData(other.matrixData),
+          structureCache(other.structureCache.load(std::memory_order_relaxed))
 {}
 
+RealMatrix::BasicMatrix(RealMatrix&& other) noexcept
+        : numRows(other.numRows), numCols(other.numCols),
+          rowStride(other.rowStride), matrixData(std::move(other.matrixData)),
+          structureCache(other.structureCache.load(std::memory_order_relaxed))
+{
+    other.structureCache.store(0, std::memory_order_relaxed);
+    other.numRows = 0;
+    other.numCols = 0;
+    other.rowStride = 0;
+    other.matrixData.clear();
+}
+
+RealMatrix::BasicMatrix(std::size_t rows, std::size_t cols, Uninitialized)
+        : numRows(rows), numCols(cols), rowStride(computeRowStride(cols)),
+          matrixData(), structureCache(0)
+{
+    // Значения перезапишет вызывающий код, обнуляется только хвост строк
+    matrixData.resize(rows * rowStride);
+    if (rowStride != cols) {
+        for (std::size_t i = 0; i < rows; ++i) {
+            std::fill(rowData(i) + cols, rowData(i) + rowStride, 0.0);
+        }
+    }
+}
+
 
 RealMatrix& RealMatrix::operator=(const RealMatrix& other) {
     if (this != &other) {
         numRows = other.numRows;
         numCols = other.numCols;
+        rowStride = other.rowStride;
         matrixData = other.matrixData;
+        structureCache.store(other.structureCache.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+    return *this;
+}
+
+RealMatrix& RealMatrix::operator=(RealMatrix&& other) noexcept {
+    if (this != &other) {
+        numRows = other.numRows;
+        numCols = other.numCols;
+        rowStride = other.rowStride;
+        matrixData = std::move(other.matrixData);
+        structureCache.store(other.structureCache.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        other.structureCache.store(0, std::memory_order_relaxed);
+        other.numRows = 0;
+        other.numCols = 0;
+        other.rowStride = 0;
+        other.matrixData.clear();
     }
     return *this;
 }
@@ -68,34 +150,83 @@ double RealMatrix::getValue(std::size_t row, std::size_t col) const {
     if (!isValidIndex(row, col)) {
         throw std::out_of_range("Matrix indices out of range");
     }
-    return matrixData[row][col];
+    return matrixData[row * rowStride + col];
 }
 
 void RealMatrix::setValue(std::size_t row, std::size_t col, double value) {
     if (!isValidIndex(row, col)) {
         throw std::out_of_range("Matrix indices out of range");
     }
-    matrixData[row][col] = value;
+    matrixData[row * rowStride + col] = value;
+    invalidateStructure();
+}
+
+std::size_t RealMatrix::getRowStride() const { return rowStride; }
+
+const double* RealMatrix::getData() const { return matrixData.data(); }
+
+double* RealMatrix::getData() {
+    invalidateStructure();
+    return matrixData.data();
+}
+
+void RealMatrix::setCopyOnWrite(bool enabled) { matrixData.setShareable(enabled); }
+bool RealMatrix::isCopyOnWrite() const { return matrixData.isShareable(); }
+bool RealMatrix::isSharingData() const { return matrixData.isShared(); }
+
+// Представления
+ConstMatrixView RealMatrix::view() const {
+    return ConstMatrixView(matrixData.data(), numRows, numCols, rowStride);
+}
+
+// Представление сбрасывает кэш свойств при каждой записи
+MatrixView RealMatrix::view() {
+    return MatrixView(matrixData.data(), numRows, numCols, rowStride, false, &structureCache);
+}
+
+ConstMatrixView RealMatrix::view(std::size_t startRow, std::size_t startCol,
+                                 std::size_t rows, std::size_t cols) const {
+    return view().view(startRow, startCol, rows, cols);
+}
+
+MatrixView RealMatrix::view(std::size_t startRow, std::size_t startCol,
+                            std::size_t rows, std::size_t cols) {
+    return view().view(startRow, startCol, rows, cols);
 }
 
+ConstMatrixView RealMatrix::row(std::size_t index) const { return view().row(index); }
+
+MatrixView RealMatrix::row(std::size_t index) { return view().row(index); }
+
+ConstMatrixView RealMatrix::col(std::size_t index) const { return view().col(index); }
+
+MatrixView RealMatrix::col(std::size_t index) { return view().col(index); }
+
+ConstMatrixView RealMatrix::transposedView() const { return view().transposedView(); }
+
+MatrixView RealMatrix::transposedView() { return view().transposedView(); }
+
 // Операции с матрицами
 void RealMatrix::changeSize(std::size_t newRows, std::size_t newCols, double initValue) {
     if (newRows == 0 || newCols == 0) {
         throw std::invalid_argument("Matrix dimensions must be positive");
     }
 
-    std::vector<std::vector<double>> newData(newRows,
-                                             std::vector<double>(newCols, initValue));
+    RealMatrix resized(newRows, newCols, initValue);
 
-    for (std::size_t i = 0; i < numRows && i < newRows; ++i) {
-        for (std::size_t j = 0; j < numCols && j < newCols; ++j) {
-            newData[i][j] = matrixData[i][j];
-        }
+    // Чтение через константную ссылку не отсоединяет общий буфер
+    const RealMatrix& source = *this;
+    std::size_t keepRows = std::min(numRows, newRows);
+    std::size_t keepCols = std::min(numCols, newCols);
+    for (std::size_t i = 0; i < keepRows; ++i) {
+        std::copy(source.rowData(i), source.rowData(i) + keepCols, resized.rowData(i));
     }
 
-    matrixData = newData;
     numRows = newRows;
     numCols = newCols;
+    rowStride = resized.rowStride;
+    matrixData = std::move(resized.matrixData);
+    invalidateStructure();
 }
 
 RealMatrix RealMatrix::extractSubmatrix(std::size_t startRow, std::size_t startCol,
@@ -104,81 +235,154 @@ RealMatrix RealMatrix::extractSubmatrix(std::size_t startRow, std::size_t startC
         throw std::out_of_range("Submatrix exceeds matrix boundaries");
     }
 
-    RealMatrix submatrix(subRows, subCols);
+    RealMatrix submatrix(subRows, subCols, Uninitialized{});
     for (std::size_t i = 0; i < subRows; ++i) {
-        for (std::size_t j = 0; j < subCols; ++j) {
-            submatrix.matrixData[i][j] = matrixData[startRow + i][startCol + j];
-        }
+        const double* source = rowData(startRow + i) + startCol;
+        std::copy(source, source + subCols, submatrix.rowData(i));
     }
 
     return submatrix;
 }
 
 RealMatrix RealMatrix::computeTranspose() const {
-    RealMatrix result(numCols, numRows);
-    for (std::size_t i = 0; i < numRows; ++i) {
-        for (std::size_t j = 0; j < numCols; ++j) {
-            result.matrixData[j][i] = matrixData[i][j];
-        }
+    // Симметричная матрица совпадает со своей транспонированной:
+    // копирование идёт подряд по памяти
+    if (hasStructure(EXACT_SYMMETRIC)) {
+        return *this;
     }
+
+    RealMatrix result(numCols, numRows, Uninitialized{});
+    kernels::transpose(numRows, numCols, matrixData.data(), rowStride,
+                       result.matrixData.data(), result.rowStride);
     return result;
 }
 
-double RealMatrix::calculateDeterminant() const {
+void RealMatrix::transposeInPlace() {
     if (!checkIsSquare()) {
-        throw std::invalid_argument("Matrix must be square to compute determinant");
+        *this = computeTranspose();
+        return;
+    }
+    if (hasStructure(EXACT_SYMMETRIC)) {
+        return;
     }
-    return calculateDeterminantRecursive(matrixData);
-}
 
-double RealMatrix::calculateDeterminantRecursive(const std::vector<std::vector<double>>& m) const {
-    std::size_t n = m.size();
+    // Диагональность и симметричность сохраняются, треугольности меняются местами
+    const std::uint32_t flags = getStructure();
+    kernels::transposeInPlace(numRows, matrixData.data(), rowStride);
+    const std::uint32_t swapped = (flags & ~(UPPER_TRIANGULAR | LOWER_TRIANGULAR |
+                                             EXACT_UPPER_TRIANGULAR | EXACT_LOWER_TRIANGULAR)) |
+                                  ((flags & UPPER_TRIANGULAR) ? LOWER_TRIANGULAR : 0u) |
+                                  ((flags & LOWER_TRIANGULAR) ? UPPER_TRIANGULAR : 0u) |
+                                  ((flags & EXACT_UPPER_TRIANGULAR) ? EXACT_LOWER_TRIANGULAR : 0u) |
+                                  ((flags & EXACT_LOWER_TRIANGULAR) ? EXACT_UPPER_TRIANGULAR : 0u);
+    structureCache.store(swapped, std::memory_order_relaxed);
+}
 
-    if (n == 1) {
-        return m[0][0];
+double RealMatrix::calculateDeterminant() const {
+    if (!checkIsSquare()) {
+        throw std::invalid_argument("Matrix must be square to compute determinant");
     }
-    if (n == 2) {
-        return m[0][0] * m[1][1] - m[0][1] * m[1][0];
+    // Определитель треугольной матрицы - произведение диагонали
+    if (hasStructure(EXACT_UPPER_TRIANGULAR) || hasStructure(EXACT_LOWER_TRIANGULAR)) {
+        double det = 1.0;
+        for (std::size_t i = 0; i < numRows; ++i) {
+            det *= rowData(i)[i];
+        }
+        return det;
     }
+    return LUDecomposition(*this).determinant();
+}
 
-    double det = 0.0;
-    for (std::size_t col = 0; col < n; ++col) {
-        // Создаем минор
-        std::vector<std::vector<double>> minor(n - 1, std::vector<double>(n - 1));
-        for (std::size_t i = 1; i < n; ++i) {
-            std::size_t minorCol = 0;
-            for (std::size_t j = 0; j < n; ++j) {
-                if (j == col) continue;
-                minor[i - 1][minorCol++] = m[i][j];
+double RealMatrix::calculateLogDeterminant(int& sign) const {
+    if (!checkIsSquare()) {
+        throw std::invalid_argument("Matrix must be square to compute determinant");
+    }
+    if (hasStructure(EXACT_UPPER_TRIANGULAR) || hasStructure(EXACT_LOWER_TRIANGULAR)) {
+        sign = 1;
+        double logAbsDet = 0.0;
+        for (std::size_t i = 0; i < numRows; ++i) {
+            const double diagonal = rowData(i)[i];
+            if (diagonal == 0.0) {
+                sign = 0;
+                return -std::numeric_limits<double>::infinity();
+            }
+            if (diagonal < 0.0) {
+                sign = -sign;
             }
+            logAbsDet += std::log(std::abs(diagonal));
         }
-
-        double sign = (col % 2 == 0) ? 1.0 : -1.0;
-        det += sign * m[0][col] * calculateDeterminantRecursive(minor);
+        return logAbsDet;
     }
-    return det;
+    return LUDecomposition(*this).logDeterminant(sign);
 }
 
 double RealMatrix::calculateTrace() const {
+    return view().calculateTrace();
+}
+
+double RealMatrix::calculateNorm() const {
+    return view().calculateNorm();
+}
+
+double RealMatrix::calculateNorm1() const {
+    return view().calculateNorm1();
+}
+
+double RealMatrix::calculateNormInf() const {
+    return view().calculateNormInf();
+}
+
+double RealMatrix::calculateMaxNorm() const {
+    return view().calculateMaxNorm();
+}
+
+double RealMatrix::reduce(Reduction kind) const {
+    return view().reduce(kind);
+}
+
+std::vector<double> RealMatrix::reduceRows(Reduction kind) const {
+    return view().reduceRows(kind);
+}
+
+std::vector<double> RealMatrix::reduceColumns(Reduction kind) const {
+    return view().reduceColumns(kind);
+}
+
+RealMatrix RealMatrix::solve(const RealMatrix& rhs) const {
     if (!checkIsSquare()) {
-        throw std::invalid_argument("Matrix must be square to compute trace");
+        throw std::invalid_argument("Matrix must be square to solve a linear system");
+    }
+    if (rhs.numRows != numRows) {
+        throw std::invalid_argument("Right-hand side row count must match matrix size");
     }
 
-    double trace = 0.0;
-    for (std::size_t i = 0; i < numRows; ++i) {
-        trace += matrixData[i][i];
+    const bool upper = hasStructure(EXACT_UPPER_TRIANGULAR);
+    const bool lower = hasStructure(EXACT_LOWER_TRIANGULAR);
+    if (!upper && !lower) {
+        return LUDecomposition(*this).solve(rhs);
     }
-    return trace;
-}
 
-double RealMatrix::calculateNorm() const {
-    double sumSquares = 0.0;
     for (std::size_t i = 0; i < numRows; ++i) {
-        for (std::size_t j = 0; j < numCols; ++j) {
-            sumSquares += matrixData[i][j] * matrixData[i][j];
+        if (rowData(i)[i] == 0.0) {
+            throw std::runtime_error("Matrix is singular");
+        }
+    }
+
+    RealMatrix solution(rhs);
+    if (upper && lower) {
+        // Диагональная: каждая строка делится на свой диагональный элемент
+        for (std::size_t i = 0; i < numRows; ++i) {
+            double* row = solution.rowData(i);
+            kernels::scale(row, 1.0 / rowData(i)[i], row, solution.numCols);
         }
+    } else if (upper) {
+        kernels::solveUpperInPlace(numRows, matrixData.data(), rowStride, 1,
+                                   solution.matrixData.data(), solution.rowStride, solution.numCols);
+    } else {
+        kernels::solveLowerInPlace(numRows, matrixData.data(), rowStride, 1, false,
+                                   solution.matrixData.data(), solution.rowStride, solution.numCols);
     }
-    return std::sqrt(sumSquares);
+    return solution;
 }
 
 // Проверки свойств матрицы
@@ -187,257 +391,293 @@ bool RealMatrix::checkIsSquare() const {
 }
 
 bool RealMatrix::checkIsDiagonal() const {
-    if (!checkIsSquare()) return false;
-    for (std::size_t i = 0; i < numRows; ++i) {
-        for (std::size_t j = 0; j < numCols; ++j) {
-            if (i != j && std::abs(matrixData[i][j]) > MATRIX_EPSILON) {
-                return false;
-            }
-        }
-    }
-    return true;
+    return hasStructure(DIAGONAL);
 }
 
 bool RealMatrix::checkIsZero() const {
-    for (const auto& row : matrixData) {
-        for (double value : row) {
-            if (std::abs(value) > MATRIX_EPSILON) {
-                return false;
-            }
-        }
-    }
-    return true;
+    return view().checkIsZero();
 }
 
 bool RealMatrix::checkIsIdentity() const {
-    if (!checkIsSquare()) return false;
-    for (std::size_t i = 0; i < numRows; ++i) {
-        for (std::size_t j = 0; j < numCols; ++j) {
-            double expected = (i == j) ? 1.0 : 0.0;
-            if (std::abs(matrixData[i][j] - expected) > MATRIX_EPSILON) {
-                return false;
-            }
-        }
-    }
-    return true;
+    return view().checkIsIdentity();
 }
 
 bool RealMatrix::checkIsSymmetric() const {
-    if (!checkIsSquare()) return false;
-    for (std::size_t i = 0; i < numRows; ++i) {
-        for (std::size_t j = i + 1; j < numCols; ++j) {
-            if (std::abs(matrixData[i][j] - matrixData[j][i]) > MATRIX_EPSILON) {
-                return false;
-            }
-        }
-    }
-    return true;
+    return hasStructure(SYMMETRIC);
 }
 
 bool RealMatrix::checkIsUpperTriangular() const {
-    if (!checkIsSquare()) return false;
-    for (std::size_t i = 1; i < numRows; ++i) {
-        for (std::size_t j = 0; j < i; ++j) {
-            if (std::abs(matrixData[i][j]) > MATRIX_EPSILON) {
-                return false;
-            }
-        }
-    }
-    return true;
+    return hasStructure(UPPER_TRIANGULAR);
 }
 
 bool RealMatrix::checkIsLowerTriangular() const {
-    if (!checkIsSquare()) return false;
-    for (std::size_t i = 0; i < numRows; ++i) {
-        for (std::size_t j = i + 1; j < numCols; ++j) {
-            if (std::abs(matrixData[i][j]) > MATRIX_EPSILON) {
-                return false;
-            }
-        }
-    }
-    return true;
+    return hasStructure(LOWER_TRIANGULAR);
 }
 
 bool RealMatrix::checkIsOrthogonal() const {
-    if (!checkIsSquare()) return false;
-    RealMatrix product = (*this) * computeTranspose();
-    return product.checkIsIdentity();
+    return view().checkIsOrthogonal();
 }
 
 // Работа с файлами
 bool RealMatrix::readFromFile(const std::string& filename) {
-    std::ifstream file(filename);
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
     if (!file.is_open()) {
         return false;
     }
 
-    std::vector<std::vector<double>> newData;
-    std::string line;
-
-    while (std::getline(file, line)) {
-        if (line.empty()) continue;
-
-        std::istringstream data_stream(line);
-        std::vector<double> row;
-        double value;
-
-        while (data_stream >> value) {
-            row.push_back(value);
-        }
+    // Файл читается целиком одним блоком, разбор идёт по буферу (TextFormat.h)
+    const std::streamoff size = file.tellg();
+    if (size <= 0) {
+        return false;
+    }
+    const std::size_t length = static_cast<std::size_t>(size);
+    std::unique_ptr<char[]> text(new char[length]);
+    file.seekg(0);
+    if (!file.read(text.get(), size)) {
+        return false;
+    }
 
-        if (!row.empty()) {
-            if (!newData.empty() && row.size() != newData[0].size()) {
-                return false;
-            }
-            newData.push_back(row);
-        }
+    text_format::Layout layout;
+    if (!text_format::scan(text.get(), length, layout)) {
+        return false;
     }
 
-    if (newData.empty()) {
+    RealMatrix loaded(layout.rows, layout.cols, Uninitialized{});
+    if (!text_format::parse(text.get(), layout, loaded.matrixData.data(), loaded.rowStride)) {
         return false;
     }
 
-    matrixData = newData;
-    numRows = newData.size();
-    numCols = newData[0].size();
+    *this = std::move(loaded);
     return true;
 }
 
 bool RealMatrix::writeToFile(const std::string& filename) const {
-    std::ofstream file(filename);
+    std::ofstream file(filename, std::ios::binary);
     if (!file.is_open()) {
         return false;
     }
 
-    for (std::size_t i = 0; i < numRows; ++i) {
-        for (std::size_t j = 0; j < numCols; ++j) {
-            file << matrixData[i][j];
-            if (j < numCols - 1) file << " ";
-        }
-        if (i < numRows - 1) file << "\n";
-    }
-
-    file.close();
-    return true;
+    return text_format::write(file, matrixData.data(), numRows, numCols, rowStride);
 }
 
-// Арифметические операторы
-RealMatrix RealMatrix::operator+(const RealMatrix& other) const {
-    if (numRows != other.numRows || numCols != other.numCols) {
-        throw std::invalid_argument("Matrices dimensions must match for addition");
+bool RealMatrix::saveBinary(const std::string& filename) const {
+    if (matrixData.empty()) {
+        return false;
     }
 
-    RealMatrix result(numRows, numCols);
-    for (std::size_t i = 0; i < numRows; ++i) {
-        for (std::size_t j = 0; j < numCols; ++j) {
-            result.matrixData[i][j] = matrixData[i][j] + other.matrixData[i][j];
-        }
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
     }
-    return result;
+
+    const binary_format::Header header = binary_format::makeHeader(
+            numRows, numCols, rowStride, binary_format::checksum(matrixData.data(), matrixData.size()));
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(matrixData.data()),
+               static_cast<std::streamsize>(matrixData.size() * sizeof(double)));
+    return static_cast<bool>(file);
 }
 
-RealMatrix RealMatrix::operator-(const RealMatrix& other) const {
-    if (numRows != other.numRows || numCols != other.numCols) {
-        throw std::invalid_argument("Matrices dimensions must match for subtraction");
+bool RealMatrix::loadBinary(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
     }
 
-    RealMatrix result(numRows, numCols);
-    for (std::size_t i = 0; i < numRows; ++i) {
-        for (std::size_t j = 0; j < numCols; ++j) {
-            result.matrixData[i][j] = matrixData[i][j] - other.matrixData[i][j];
+    binary_format::Header header{};
+    bool swapped = false;
+    if (!binary_format::readHeader(file, header, swapped)) {
+        return false;
+    }
+    const std::size_t count = binary_format::payloadCount(header);
+    if (count == 0 || !binary_format::holdsPayload(file, count)) {
+        return false;
+    }
+
+    RealMatrix loaded(static_cast<std::size_t>(header.rows), static_cast<std::size_t>(header.cols),
+                      Uninitialized{});
+    const std::size_t storedStride = static_cast<std::size_t>(header.rowStride);
+    if (storedStride == loaded.rowStride) {
+        // Шаг совпадает: данные читаются сразу в буфер матрицы
+        if (!file.read(reinterpret_cast<char*>(loaded.matrixData.data()),
+                       static_cast<std::streamsize>(count * sizeof(double)))) {
+            return false;
+        }
+        if (swapped) {
+            binary_format::swapBytes(loaded.matrixData.data(), count);
+        }
+        if (binary_format::checksum(loaded.matrixData.data(), count) != header.checksum) {
+            return false;
+        }
+    } else {
+        std::vector<double> stored(count);
+        if (!file.read(reinterpret_cast<char*>(stored.data()),
+                       static_cast<std::streamsize>(count * sizeof(double)))) {
+            return false;
+        }
+        if (swapped) {
+            binary_format::swapBytes(stored.data(), count);
+        }
+        if (binary_format::checksum(stored.data(), count) != header.checksum) {
+            return false;
+        }
+        for (std::size_t i = 0; i < loaded.numRows; ++i) {
+            const double* source = stored.data() + i * storedStride;
+            std::copy(source, source + loaded.numCols, loaded.rowData(i));
         }
     }
-    return result;
+
+    *this = std::move(loaded);
+    return true;
 }
 
+// Арифметические операторы
 RealMatrix RealMatrix::operator*(const RealMatrix& other) const {
     if (numCols != other.numRows) {
         throw std::invalid_argument("Incompatible dimensions for matrix multiplication");
     }
 
-    RealMatrix result(numRows, other.numCols);
-    for (std::size_t i = 0; i < numRows; ++i) {
-        for (std::size_t j = 0; j < other.numCols; ++j) {
-            result.matrixData[i][j] = 0.0;
-            for (std::size_t k = 0; k < numCols; ++k) {
-                result.matrixData[i][j] += matrixData[i][k] * other.matrixData[k][j];
+    // Диагональный множитель: O(n^2) вместо O(n^3). Проверяется только
+    // квадратный множитель, чтобы не сканировать прямоугольные матрицы;
+    // маленькие произведения дешевле посчитать, чем проверять структуру
+    const bool checkStructure = numRows * numCols * other.numCols > kernels::GEMM_SMALL_WORK;
+    if (checkStructure && checkIsSquare() && hasStructure(EXACT_DIAGONAL)) {
+        RealMatrix result(other.numRows, other.numCols, Uninitialized{});
+        for (std::size_t i = 0; i < numRows; ++i) {
+            kernels::scale(other.rowData(i), rowData(i)[i], result.rowData(i), other.numCols);
+        }
+        return result;
+    }
+    if (checkStructure && other.checkIsSquare() && other.hasStructure(EXACT_DIAGONAL)) {
+        std::vector<double> diagonal(other.numRows);
+        for (std::size_t j = 0; j < other.numRows; ++j) {
+            diagonal[j] = other.rowData(j)[j];
+        }
+        RealMatrix result(numRows, numCols, Uninitialized{});
+        for (std::size_t i = 0; i < numRows; ++i) {
+            const double* source = rowData(i);
+            double* target = result.rowData(i);
+            for (std::size_t j = 0; j < numCols; ++j) {
+                target[j] = source[j] * diagonal[j];
             }
         }
+        return result;
     }
-    return result;
+
+    return multiply(view(), other.view());
 }
 
-RealMatrix RealMatrix::operator*(double scalar) const {
-    RealMatrix result(numRows, numCols);
-    for (std::size_t i = 0; i < numRows; ++i) {
-        for (std::size_t j = 0; j < numCols; ++j) {
-            result.matrixData[i][j] = matrixData[i][j] * scalar;
-        }
+RealMatrix RealMatrix::multiply(const ConstMatrixView& left, const ConstMatrixView& right) {
+    if (left.getCols() != right.getRows()) {
+        throw std::invalid_argument("Incompatible dimensions for matrix multiplication");
     }
+
+    // Транспонированное представление передаётся в gemm перестановкой шагов
+    auto rowStep = [](const ConstMatrixView& v) { return v.isTransposed() ? 1 : v.getRowStride(); };
+    auto colStep = [](const ConstMatrixView& v) { return v.isTransposed() ? v.getRowStride() : 1; };
+
+    RealMatrix result(left.getRows(), right.getCols(), Uninitialized{});
+    kernels::gemm(left.getRows(), right.getCols(), left.getCols(), 1.0,
+                  left.getData(), rowStep(left), colStep(left),
+                  right.getData(), rowStep(right), colStep(right),
+                  0.0, result.matrixData.data(), result.rowStride);
     return result;
 }
 
-RealMatrix RealMatrix::operator/(double scalar) const {
-    if (std::abs(scalar) < MATRIX_EPSILON) {
-        throw std::invalid_argument("Division by zero");
+RealMatrix RealMatrix::multiplyStrassen(const ConstMatrixView& left, const ConstMatrixView& right) {
+    if (left.getCols() != right.getRows()) {
+        throw std::invalid_argument("Incompatible dimensions for matrix multiplication");
     }
-    return *this * (1.0 / scalar);
+
+    auto rowStep = [](const ConstMatrixView& v) { return v.isTransposed() ? 1 : v.getRowStride(); };
+    auto colStep = [](const ConstMatrixView& v) { return v.isTransposed() ? v.getRowStride() : 1; };
+
+    RealMatrix result(left.getRows(), right.getCols(), Uninitialized{});
+    kernels::strassen(left.getRows(), right.getCols(), left.getCols(),
+                      left.getData(), rowStep(left), colStep(left),
+                      right.getData(), rowStep(right), colStep(right),
+                      result.matrixData.data(), result.rowStride, kernels::getStrassenCrossover());
+    return result;
 }
 
 RealMatrix& RealMatrix::operator+=(const RealMatrix& other) {
-    *this = *this + other;
+    if (numRows != other.numRows || numCols != other.numCols) {
+        throw std::invalid_argument("Matrices dimensions must match for addition");
+    }
+
+    forEachSpan([&](std::size_t offset, std::size_t length) {
+        double* span = matrixData.data() + offset;
+        kernels::add(span, other.matrixData.data() + offset, span, length);
+        return true;
+    });
+    invalidateStructure();
     return *this;
 }
 
 RealMatrix& RealMatrix::operator-=(const RealMatrix& other) {
-    *this = *this - other;
+    if (numRows != other.numRows || numCols != other.numCols) {
+        throw std::invalid_argument("Matrices dimensions must match for subtraction");
+    }
+
+    forEachSpan([&](std::size_t offset, std::size_t length) {
+        double* span = matrixData.data() + offset;
+        kernels::subtract(span, other.matrixData.data() + offset, span, length);
+        return true;
+    });
+    invalidateStructure();
     return *this;
 }
 
 RealMatrix& RealMatrix::operator*=(const RealMatrix& other) {
+    // Произведению всё равно нужен новый буфер; старый освобождается при перемещении
     *this = *this * other;
     return *this;
 }
 
 RealMatrix& RealMatrix::operator*=(double scalar) {
-    *this = *this * scalar;
+    forEachSpan([&](std::size_t offset, std::size_t length) {
+        double* span = matrixData.data() + offset;
+        kernels::scale(span, scalar, span, length);
+        return true;
+    });
+    invalidateStructure();
     return *this;
 }
 
 RealMatrix& RealMatrix::operator/=(double scalar) {
-    *this = *this / scalar;
-    return *this;
+    if (std::abs(scalar) < MATRIX_EPSILON) {
+        throw std::invalid_argument("Division by zero");
+    }
+    return *this *= (1.0 / scalar);
 }
 
 // Инкремент/декремент
 RealMatrix& RealMatrix::operator++() {
-    for (std::size_t i = 0; i < numRows; ++i) {
-        for (std::size_t j = 0; j < numCols; ++j) {
-            matrixData[i][j] += 1.0;
-        }
-    }
+    forEachSpan([&](std::size_t offset, std::size_t length) {
+        double* span = matrixData.data() + offset;
+        kernels::addScalar(span, 1.0, span, length);
+        return true;
+    });
+    invalidateStructure();
     return *this;
 }
 
 RealMatrix RealMatrix::operator++(int) {
-    RealMatrix temp = *this;
-    ++(*this);
-    return temp;
+    return shiftedPostfix(1.0);
 }
 
 RealMatrix& RealMatrix::operator--() {
-    for (std::size_t i = 0; i < numRows; ++i) {
-        for (std::size_t j = 0; j < numCols; ++j) {
-            matrixData[i][j] -= 1.0;
-        }
-    }
+    forEachSpan([&](std::size_t offset, std::size_t length) {
+        double* span = matrixData.data() + offset;
+        kernels::addScalar(span, -1.0, span, length);
+        return true;
+    });
+    invalidateStructure();
     return *this;
 }
 
 RealMatrix RealMatrix::operator--(int) {
-    RealMatrix temp = *this;
-    --(*this);
-    return temp;
+    return shiftedPostfix(-1.0);
 }
 
 // Операторы сравнения
@@ -446,14 +686,10 @@ bool RealMatrix::operator==(const RealMatrix& other) const {
         return false;
     }
 
-    for (std::size_t i = 0; i < numRows; ++i) {
-        for (std::size_t j = 0; j < numCols; ++j) {
-            if (std::abs(matrixData[i][j] - other.matrixData[i][j]) > MATRIX_EPSILON) {
-                return false;
-            }
-        }
-    }
-    return true;
+    return forEachSpan([&](std::size_t offset, std::size_t length) {
+        return kernels::allClose(matrixData.data() + offset, other.matrixData.data() + offset,
+                                 MATRIX_EPSILON, length);
+    });
 }
 
 bool RealMatrix::operator!=(const RealMatrix& other) const {
@@ -463,8 +699,9 @@ bool RealMatrix::operator!=(const RealMatrix& other) const {
 // Потоковые операторы
 std::ostream& operator<<(std::ostream& os, const RealMatrix& matrix) {
     for (std::size_t i = 0; i < matrix.numRows; ++i) {
+        const double* row = matrix.rowData(i);
         for (std::size_t j = 0; j < matrix.numCols; ++j) {
-            os << matrix.matrixData[i][j];
+            os << row[j];
             if (j < matrix.numCols - 1) os << " ";
         }
         if (i < matrix.numRows - 1) os << "\n";
@@ -501,7 +738,7 @@ std::istream& operator>>(std::istream& is, RealMatrix& matrix) {
 RealMatrix RealMatrix::createIdentity(std::size_t size) {
     RealMatrix identity(size, size, 0.0);
     for (std::size_t i = 0; i < size; ++i) {
-        identity.matrixData[i][i] = 1.0;
+        identity.matrixData[i * identity.rowStride + i] = 1.0;
     }
     return identity;
 }
@@ -510,12 +747,137 @@ RealMatrix RealMatrix::createDiagonal(const std::vector<double>& diagonal) {
     std::size_t size = diagonal.size();
     RealMatrix diagMatrix(size, size, 0.0);
     for (std::size_t i = 0; i < size; ++i) {
-        diagMatrix.matrixData[i][i] = diagonal[i];
+        diagMatrix.matrixData[i * diagMatrix.rowStride + i] = diagonal[i];
     }
     return diagMatrix;
 }
 
+// Настройки параллельных вычислений
+void RealMatrix::setThreadCount(std::size_t threadCount) {
+    ThreadPool::setGlobalThreadCount(threadCount);
+}
+
+std::size_t RealMatrix::getThreadCount() {
+    return ThreadPool::getGlobalThreadCount();
+}
+
+void RealMatrix::setParallelThreshold(std::size_t multiplyAdds) {
+    kernels::setGemmParallelThreshold(multiplyAdds);
+}
+
+std::size_t RealMatrix::getParallelThreshold() {
+    return kernels::getGemmParallelThreshold();
+}
+
+void RealMatrix::setStrassenCrossover(std::size_t size) {
+    kernels::setStrassenCrossover(size);
+}
+
+std::size_t RealMatrix::getStrassenCrossover() {
+    return kernels::getStrassenCrossover();
+}
+
 // Приватные методы
+// Старый буфер уходит в возвращаемое значение без копирования, новый
+// заполняется за один проход: чтение старого значения и запись сдвинутого.
+// Новый буфер выделяется до перемещения: при исключении матрица не меняется
+RealMatrix RealMatrix::shiftedPostfix(double delta) {
+    RealMatrix shifted(numRows, numCols, Uninitialized{});
+    RealMatrix previous(std::move(*this));
+    const MatrixStorage& source = previous.matrixData;
+    previous.forEachSpan([&](std::size_t offset, std::size_t length) {
+        kernels::addScalar(source.data() + offset, delta,
+                           shifted.matrixData.data() + offset, length);
+        return true;
+    });
+    *this = std::move(shifted);
+    return previous;
+}
+
+std::uint32_t RealMatrix::getStructure() const {
+    std::uint32_t flags = structureCache.load(std::memory_order_acquire);
+    if ((flags & STRUCTURE_KNOWN) == 0) {
+        // Одновременный подсчёт из нескольких потоков даёт одно и то же значение
+        flags = detectStructure();
+        structureCache.store(flags, std::memory_order_release);
+    }
+    return flags;
+}
+
+bool RealMatrix::hasStructure(std::uint32_t flags) const {
+    return (getStructure() & flags) == flags;
+}
+
+// Один проход по парам плиток (I, J) и (J, I) над и под диагональю: плитка
+// и её отражение помещаются в L1, поэтому сравнение a[i][j] с a[j][i] не
+// читает память с шагом в строку. Проход заканчивается, как только все
+// свойства опровергнуты - для плотной матрицы это первая же плитка
+std::uint32_t RealMatrix::detectStructure() const {
+    constexpr std::size_t TILE = 32;
+    if (!checkIsSquare()) {
+        return STRUCTURE_KNOWN;
+    }
+
+    std::uint32_t flags = STRUCTURE_KNOWN | DIAGONAL | SYMMETRIC | UPPER_TRIANGULAR | LOWER_TRIANGULAR |
+                          EXACT_DIAGONAL | EXACT_SYMMETRIC | EXACT_UPPER_TRIANGULAR | EXACT_LOWER_TRIANGULAR;
+    const std::size_t n = numRows;
+    for (std::size_t ib = 0; ib < n; ib += TILE) {
+        const std::size_t iEnd = std::min(ib + TILE, n);
+        for (std::size_t jb = ib; jb < n; jb += TILE) {
+            const std::size_t jEnd = std::min(jb + TILE, n);
+            // Точные свойства проверяются сравнением с нулём (NaN тоже их нарушает),
+            // свойства с допуском - по наибольшему модулю
+            bool upperNonZero = false;
+            bool lowerNonZero = false;
+            bool asymmetric = false;
+            double upperMax = 0.0;
+            double lowerMax = 0.0;
+            double asymmetryMax = 0.0;
+            for (std::size_t i = ib; i < iEnd; ++i) {
+                const double* row = rowData(i);
+                for (std::size_t j = std::max(jb, i + 1); j < jEnd; ++j) {
+                    const double upper = row[j];
+                    const double lower = rowData(j)[i];
+                    upperNonZero |= (upper != 0.0);
+                    lowerNonZero |= (lower != 0.0);
+                    asymmetric |= (upper != lower);
+                    upperMax = std::max(upperMax, std::abs(upper));
+                    lowerMax = std::max(lowerMax, std::abs(lower));
+                    asymmetryMax = std::max(asymmetryMax, std::abs(upper - lower));
+                }
+            }
+
+            if (upperNonZero) flags &= ~(EXACT_DIAGONAL | EXACT_LOWER_TRIANGULAR);
+            if (lowerNonZero) flags &= ~(EXACT_DIAGONAL | EXACT_UPPER_TRIANGULAR);
+            if (asymmetric) flags &= ~EXACT_SYMMETRIC;
+            if (upperMax > MATRIX_EPSILON) flags &= ~(DIAGONAL | LOWER_TRIANGULAR);
+            if (lowerMax > MATRIX_EPSILON) flags &= ~(DIAGONAL | UPPER_TRIANGULAR);
+            if (asymmetryMax > MATRIX_EPSILON) flags &= ~SYMMETRIC;
+            if (flags == STRUCTURE_KNOWN) {
+                return flags;
+            }
+        }
+    }
+    return flags;
+}
+
+void RealMatrix::invalidateStructure() {
+    structureCache.store(0, std::memory_order_relaxed);
+}
+
 bool RealMatrix::isValidIndex(std::size_t row, std::size_t col) const {
     return row < numRows && col < numCols;
+}
+
+double* RealMatrix::rowData(std::size_t row) {
+    return matrixData.data() + row * rowStride;
+}
+
+const double* RealMatrix::rowData(std::size_t row) const {
+    return matrixData.data() + row * rowStride;
+}
+
+std::size_t RealMatrix::computeRowStride(std::size_t cols) {
+    const std::size_t lane = MATRIX_ALIGNMENT / sizeof(double);
+    return (cols + lane - 1) / lane * lane;
 }
\ No newline at end of file
@@ -13,39 +13,154 @@
 #include <string>
 #include <stdexcept>
 #include <cmath>
+#include <atomic>
+#include <cstdint>
+#include "MatrixStorage.h"
+#include "Reductions.h"
 
-class RealMatrix {
+// Порог сравнения с нулём в проверках свойств и при делении на скаляр,
+// свой для каждого типа элементов (целые типы сравниваются точно)
+template <typename T>
+struct MatrixTraits {
+    static constexpr T epsilon = T(0);
+};
+
+template <>
+struct MatrixTraits<float> {
+    static constexpr float epsilon = 1e-5f;
+};
+
+template <>
+struct MatrixTraits<double> {
+    static constexpr double epsilon = 1e-12;
+};
+
+template <>
+struct MatrixTraits<long double> {
+    static constexpr long double epsilon = 1e-15L;
+};
+
+constexpr double MATRIX_EPSILON = MatrixTraits<double>::epsilon;
+
+template <typename Derived>
+class MatrixExpression;
+class ConstMatrixView;
+class MatrixView;
+
+// Матрица с элементами типа T (BasicMatrix.h). Для double - отдельная
+// реализация ниже с SIMD-ядрами, GEMM, представлениями и выражениями
+template <typename T>
+class BasicMatrix;
+template <>
+class BasicMatrix<double>;
+using RealMatrix = BasicMatrix<double>;
+
+template <>
+class BasicMatrix<double> {
 private:
     std::size_t numRows;
     std::size_t numCols;
-    std::vector<std::vector<double>> matrixData;
+    // Шаг строки в элементах: numCols, округлённое до строки кэша
+    std::size_t rowStride;
+    // Единый непрерывный буфер rows * rowStride, строки подряд; в режиме
+    // копирования при записи общий с копиями матрицы (MatrixStorage.h)
+    MatrixStorage matrixData;
+    // Кэш структурных свойств (биты Structure), вычисляется при первом
+    // запросе и сбрасывается любой операцией, которая может изменить
+    // элементы, в том числе выдачей изменяемого указателя. Изменяемое
+    // представление хранит указатель на кэш и сбрасывает его при каждой
+    // записи. Запись через сырой указатель, полученный до запроса
+    // свойства, кэш не отслеживает
+    mutable std::atomic<std::uint32_t> structureCache;
 
 public:
     // Конструкторы
-    RealMatrix();
-    RealMatrix(std::size_t rows, std::size_t cols, double initValue = 0.0);
-    RealMatrix(const std::vector<std::vector<double>>& inputData);
-    RealMatrix(const RealMatrix& other);
+    BasicMatrix();
+    BasicMatrix(std::size_t rows, std::size_t cols, double initValue = 0.0);
+    BasicMatrix(const std::vector<std::vector<double>>& inputData);
+    BasicMatrix(const RealMatrix& other);
+    // Перемещённая матрица становится пустой (0 x 0)
+    BasicMatrix(RealMatrix&& other) noexcept;
+    // Вычисление ленивого выражения (MatrixExpression.h)
+    template <typename Derived>
+    BasicMatrix(const MatrixExpression<Derived>& expression);
+    template <typename Derived>
+    BasicMatrix(MatrixExpression<Derived>&& expression);
+    // Явное преобразование из матрицы другой точности (BasicMatrix.h)
+    template <typename U>
+    explicit BasicMatrix(const BasicMatrix<U>& other);
 
     // Оператор присваивания
     RealMatrix& operator=(const RealMatrix& other);
+    RealMatrix& operator=(RealMatrix&& other) noexcept;
+    // Выражение того же размера вычисляется в существующий буфер
+    template <typename Derived>
+    RealMatrix& operator=(const MatrixExpression<Derived>& expression);
+    template <typename Derived>
+    RealMatrix& operator=(MatrixExpression<Derived>&& expression);
 
     // Геттеры
     std::size_t getRows() const;
     std::size_t getCols() const;
     double getValue(std::size_t row, std::size_t col) const;
     void setValue(std::size_t row, std::size_t col, double value);
+    std::size_t getRowStride() const;
+    const double* getData() const;
+    double* getData();
+
+    // Представления без копирования (MatrixView.h): действительны, пока
+    // матрица существует и не меняет размер. Изменяемое представление
+    // общей матрицы в режиме копирования при записи сначала отсоединяет её
+    ConstMatrixView view() const;
+    MatrixView view();
+    ConstMatrixView view(std::size_t startRow, std::size_t startCol,
+                         std::size_t rows, std::size_t cols) const;
+    MatrixView view(std::size_t startRow, std::size_t startCol,
+                    std::size_t rows, std::size_t cols);
+    ConstMatrixView row(std::size_t index) const;
+    MatrixView row(std::size_t index);
+    ConstMatrixView col(std::size_t index) const;
+    MatrixView col(std::size_t index);
+    ConstMatrixView transposedView() const;
+    MatrixView transposedView();
+
+    // Копирование при записи (по умолчанию выключено). Копии матрицы в этом
+    // режиме делят её буфер, а первое изменение копии или оригинала
+    // (setValue, операторы на месте, изменяемый указатель или
+    // представление) копирует буфер. Режим переходит к копиям. Указатель
+    // или представление, полученные до копирования, пишут в общий буфер
+    void setCopyOnWrite(bool enabled);
+    bool isCopyOnWrite() const;
+    // true, если буфер сейчас общий с другой матрицей
+    bool isSharingData() const;
 
     // Операции с матрицами
     void changeSize(std::size_t newRows, std::size_t newCols, double initValue = 0.0);
     RealMatrix extractSubmatrix(std::size_t startRow, std::size_t startCol,
                                 std::size_t subRows, std::size_t subCols) const;
     RealMatrix computeTranspose() const;
+    // Квадратная матрица транспонируется без выделения памяти,
+    // прямоугольная получает новый буфер
+    void transposeInPlace();
     double calculateDeterminant() const;
+    // ln|det|; sign получает знак определителя (0 для вырожденной матрицы)
+    double calculateLogDeterminant(int& sign) const;
     double calculateTrace() const;
+    // Нормы и свёртки (Reductions.h): попарное суммирование, норма
+    // Фробениуса без переполнения, большие матрицы - в несколько потоков
     double calculateNorm() const;
+    double calculateNorm1() const;
+    double calculateNormInf() const;
+    double calculateMaxNorm() const;
+    double reduce(Reduction kind) const;
+    std::vector<double> reduceRows(Reduction kind) const;
+    std::vector<double> reduceColumns(Reduction kind) const;
+    // Решение A X = B. Диагональная и треугольная матрицы решаются
+    // подстановкой за O(n^2) на столбец, остальные - через LUDecomposition
+    RealMatrix solve(const RealMatrix& rhs) const;
 
-    // Проверки свойств матрицы
+    // Проверки свойств матрицы. Диагональность, симметричность и
+    // треугольность кэшируются до первого изменения матрицы
     bool checkIsSquare() const;
     bool checkIsDiagonal() const;
     bool checkIsZero() const;
@@ -58,21 +173,33 @@ public:
     // Работа с файлами
     bool readFromFile(const std::string& filename);
     bool writeToFile(const std::string& filename) const;
+    // Двоичный формат (MatrixFile.h): заголовок с размерами, типом,
+    // порядком байтов и контрольной суммой, данные читаются одним блоком
+    bool saveBinary(const std::string& filename) const;
+    bool loadBinary(const std::string& filename);
 
-    // Арифметические операторы
-    RealMatrix operator+(const RealMatrix& other) const;
-    RealMatrix operator-(const RealMatrix& other) const;
+    // Арифметические операторы. Сложение, вычитание, умножение и деление
+    // на скаляр строят ленивые выражения (MatrixExpression.h), умножение
+    // матриц вычисляется сразу через kernels::gemm, а если один из
+    // множителей диагональный - масштабированием строк или столбцов
     RealMatrix operator*(const RealMatrix& other) const;
-    RealMatrix operator*(double scalar) const;
-    RealMatrix operator/(double scalar) const;
+    // Произведение матриц, заданных представлениями (в том числе транспонированными)
+    static RealMatrix multiply(const ConstMatrixView& left, const ConstMatrixView& right);
+    // Умножение по схеме Штрассена-Винограда (Strassen.h) - только по явному
+    // запросу: быстрее для больших матриц, но оценка погрешности слабее, чем у gemm
+    static RealMatrix multiplyStrassen(const ConstMatrixView& left, const ConstMatrixView& right);
 
     RealMatrix& operator+=(const RealMatrix& other);
     RealMatrix& operator-=(const RealMatrix& other);
+    template <typename Derived>
+    RealMatrix& operator+=(const MatrixExpression<Derived>& expression);
+    template <typename Derived>
+    RealMatrix& operator-=(const MatrixExpression<Derived>& expression);
     RealMatrix& operator*=(const RealMatrix& other);
     RealMatrix& operator*=(double scalar);
     RealMatrix& operator/=(double scalar);
 
-    // Инкремент/декремент
+    // Инкремент/декремент (префиксные и составные операторы работают на месте)
     RealMatrix& operator++();
     RealMatrix operator++(int);
     RealMatrix& operator--();
@@ -90,9 +217,55 @@ public:
     static RealMatrix createIdentity(std::size_t size);
     static RealMatrix createDiagonal(const std::vector<double>& diagonal);
 
+    // Настройки параллельного умножения (общие для всех матриц).
+    // 0 потоков означает число аппаратных потоков
+    static void setThreadCount(std::size_t threadCount);
+    static std::size_t getThreadCount();
+    static void setParallelThreshold(std::size_t multiplyAdds);
+    static std::size_t getParallelThreshold();
+    // Размер, начиная с которого multiplyStrassen делит блоки пополам
+    static void setStrassenCrossover(std::size_t size);
+    static std::size_t getStrassenCrossover();
+
 private:
+    // Биты structureCache. Свойства с допуском MATRIX_EPSILON отвечают
+    // на checkIs*, точные (вне структуры только нули) выбирают ядра:
+    // специализированное ядро должно давать тот же результат, что и общее
+    enum Structure : std::uint32_t {
+        STRUCTURE_KNOWN = 1u << 0,
+        DIAGONAL = 1u << 1,
+        SYMMETRIC = 1u << 2,
+        UPPER_TRIANGULAR = 1u << 3,
+        LOWER_TRIANGULAR = 1u << 4,
+        EXACT_DIAGONAL = 1u << 5,
+        EXACT_SYMMETRIC = 1u << 6,
+        EXACT_UPPER_TRIANGULAR = 1u << 7,
+        EXACT_LOWER_TRIANGULAR = 1u << 8
+    };
+
+    std::uint32_t getStructure() const;
+    bool hasStructure(std::uint32_t flags) const;
+    std::uint32_t detectStructure() const;
+    void invalidateStructure();
+
+    // Конструктор без заполнения значений: для результатов, которые сразу перезаписываются
+    struct Uninitialized {};
+    BasicMatrix(std::size_t rows, std::size_t cols, Uninitialized);
+
+    RealMatrix shiftedPostfix(double delta);
+
     bool isValidIndex(std::size_t row, std::size_t col) const;
-    double calculateDeterminantRecursive(const std::vector<std::vector<double>>& m) const;
+
+    double* rowData(std::size_t row);
+    const double* rowData(std::size_t row) const;
+    static std::size_t computeRowStride(std::size_t cols);
+
+    template <typename Operation>
+    bool forEachSpan(Operation operation) const;
 };
 
+#include "MatrixExpression.h"
+#include "MatrixView.h"
+#include "BasicMatrix.h"
+
 #endif // MATRIXLAB_MATRIX_H
\ No newline at end of file
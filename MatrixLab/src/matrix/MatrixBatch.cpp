@@ -0,0 +1,539 @@
+/**
+ * @file MatrixBatch.cpp
+ * @brief Implementation of batched multiply, transpose, determinant and solve
+ * @author Shchurko
+ * @date 2025
+ */
+
+#include "MatrixBatch.h"
+#include "SimdKernels.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define MATRIX_BATCH_X86 1
+#else
+#define MATRIX_BATCH_X86 0
+#endif
+
+namespace {
+
+constexpr std::size_t LANES = MatrixBatch::BATCH_LANES;
+
+// Ядра групп написаны один раз над типом Lanes - вектором из LANES
+// значений, по одному на матрицу группы. С векторными расширениями GCC
+// операции над Lanes отображаются на регистры того набора инструкций,
+// под который собрана функция, куда встроено ядро (обёртки ниже)
+#if defined(__GNUC__) || defined(__clang__)
+#define MATRIX_BATCH_INLINE inline __attribute__((always_inline))
+
+// Функции с Lanes в сигнатуре всегда встраиваются, поэтому предупреждение
+// о соглашении передачи 512-битных векторов к ним не относится. Оно
+// выключено только до обёрток: для Lanes, вспомогательных функций и тел ядер
+#if defined(__GNUC__) && !defined(__clang__)
+#define MATRIX_BATCH_PSABI_SUPPRESSED 1
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+#endif
+
+typedef double Lanes __attribute__((vector_size(LANES * sizeof(double))));
+typedef std::int64_t LaneMask __attribute__((vector_size(LANES * sizeof(double))));
+
+#define MATRIX_BATCH_SELECT(mask, a, b) ((mask) ? (a) : (b))
+#else
+#define MATRIX_BATCH_INLINE inline
+
+// Переносимая замена векторных расширений: те же операции циклом по линиям
+struct LaneMask {
+    bool value[LANES];
+    bool operator[](std::size_t lane) const { return value[lane]; }
+};
+
+struct Lanes {
+    double value[LANES];
+
+    double operator[](std::size_t lane) const { return value[lane]; }
+    double& operator[](std::size_t lane) { return value[lane]; }
+
+    template <typename Operation>
+    friend Lanes apply(const Lanes& a, const Lanes& b, Operation operation) {
+        Lanes result;
+        for (std::size_t lane = 0; lane < LANES; ++lane) result.value[lane] = operation(a.value[lane], b.value[lane]);
+        return result;
+    }
+    template <typename Operation>
+    friend LaneMask compare(const Lanes& a, const Lanes& b, Operation operation) {
+        LaneMask result;
+        for (std::size_t lane = 0; lane < LANES; ++lane) result.value[lane] = operation(a.value[lane], b.value[lane]);
+        return result;
+    }
+
+    friend Lanes operator+(const Lanes& a, const Lanes& b) { return apply(a, b, [](double x, double y) { return x + y; }); }
+    friend Lanes operator-(const Lanes& a, const Lanes& b) { return apply(a, b, [](double x, double y) { return x - y; }); }
+    friend Lanes operator*(const Lanes& a, const Lanes& b) { return apply(a, b, [](double x, double y) { return x * y; }); }
+    friend Lanes operator/(const Lanes& a, const Lanes& b) { return apply(a, b, [](double x, double y) { return x / y; }); }
+    friend Lanes operator-(const Lanes& a) { return Lanes{} - a; }
+    Lanes& operator+=(const Lanes& b) { return *this = *this + b; }
+    Lanes& operator-=(const Lanes& b) { return *this = *this - b; }
+    Lanes& operator*=(const Lanes& b) { return *this = *this * b; }
+
+    friend LaneMask operator<(const Lanes& a, const Lanes& b) { return compare(a, b, [](double x, double y) { return x < y; }); }
+    friend LaneMask operator>(const Lanes& a, const Lanes& b) { return compare(a, b, [](double x, double y) { return x > y; }); }
+    friend LaneMask operator==(const Lanes& a, const Lanes& b) { return compare(a, b, [](double x, double y) { return x == y; }); }
+    friend LaneMask operator!=(const Lanes& a, const Lanes& b) { return compare(a, b, [](double x, double y) { return x != y; }); }
+};
+
+inline Lanes selectLanes(const LaneMask& mask, const Lanes& a, const Lanes& b) {
+    Lanes result;
+    for (std::size_t lane = 0; lane < LANES; ++lane) result.value[lane] = mask.value[lane] ? a.value[lane] : b.value[lane];
+    return result;
+}
+
+#define MATRIX_BATCH_SELECT(mask, a, b) selectLanes(mask, a, b)
+#endif
+
+// Загрузка и запись через memcpy: без требований к выравниванию и без
+// нарушения правил псевдонимов; компилятор сводит их к одной инструкции
+MATRIX_BATCH_INLINE Lanes loadLanes(const double* source) {
+    Lanes value;
+    std::memcpy(&value, source, sizeof(Lanes));
+    return value;
+}
+
+MATRIX_BATCH_INLINE void storeLanes(double* destination, const Lanes& value) {
+    std::memcpy(destination, &value, sizeof(Lanes));
+}
+
+MATRIX_BATCH_INLINE Lanes broadcastLanes(double value) {
+    Lanes result;
+    for (std::size_t lane = 0; lane < LANES; ++lane) {
+        result[lane] = value;
+    }
+    return result;
+}
+
+MATRIX_BATCH_INLINE bool anyLane(const LaneMask& mask) {
+    bool any = false;
+    for (std::size_t lane = 0; lane < LANES; ++lane) {
+        any |= mask[lane] != 0;
+    }
+    return any;
+}
+
+// C = A * B для одной группы: A - m x k, B - k x n, C - m x n
+MATRIX_BATCH_INLINE void multiplyGroupBody(std::size_t m, std::size_t n, std::size_t k,
+                                           const double* a, const double* b, double* c) {
+    for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            Lanes sum = {};
+            for (std::size_t p = 0; p < k; ++p) {
+                sum += loadLanes(a + (i * k + p) * LANES) * loadLanes(b + (p * n + j) * LANES);
+            }
+            storeLanes(c + (i * n + j) * LANES, sum);
+        }
+    }
+}
+
+// Меняет местами элементы [from, to) двух строк группы в линиях маски swap
+MATRIX_BATCH_INLINE void swapRowsMasked(double* top, double* bottom, std::size_t from, std::size_t to,
+                                        const LaneMask& swap) {
+    for (std::size_t c = from; c < to; ++c) {
+        const Lanes topValue = loadLanes(top + c * LANES);
+        const Lanes bottomValue = loadLanes(bottom + c * LANES);
+        storeLanes(top + c * LANES, MATRIX_BATCH_SELECT(swap, bottomValue, topValue));
+        storeLanes(bottom + c * LANES, MATRIX_BATCH_SELECT(swap, topValue, bottomValue));
+    }
+}
+
+/**
+ * Прямой ход Гаусса с выбором главного элемента для группы: lu (n x n)
+ * превращается в U, x (n x nrhs, может быть пустой) - в L^-1 P x.
+ * Главный элемент выбирается в каждой линии свой: поиск максимума и
+ * перестановка строк выполняются выборкой по маске, без ветвлений.
+ * det получает определители линий. В вырожденной линии нулевой главный
+ * элемент не делится, и исключение в ней пропускается
+ */
+MATRIX_BATCH_INLINE void eliminateGroupBody(std::size_t n, std::size_t nrhs,
+                                            double* lu, double* x, double* det) {
+    const Lanes zero = {};
+    const Lanes one = broadcastLanes(1.0);
+    Lanes determinant = one;
+
+    for (std::size_t k = 0; k < n; ++k) {
+        // Номер строки хранится в double, чтобы сравнения и выборки шли
+        // в тех же регистрах, что и значения
+        const Lanes diagonal = loadLanes(lu + (k * n + k) * LANES);
+        Lanes best = MATRIX_BATCH_SELECT(diagonal < zero, -diagonal, diagonal);
+        Lanes pivotRow = broadcastLanes(static_cast<double>(k));
+        for (std::size_t r = k + 1; r < n; ++r) {
+            const Lanes candidate = loadLanes(lu + (r * n + k) * LANES);
+            const Lanes value = MATRIX_BATCH_SELECT(candidate < zero, -candidate, candidate);
+            const LaneMask better = value > best;
+            best = MATRIX_BATCH_SELECT(better, value, best);
+            pivotRow = MATRIX_BATCH_SELECT(better, broadcastLanes(static_cast<double>(r)), pivotRow);
+        }
+
+        // Обмен строк k и r в линиях, где главный элемент найден в строке r.
+        // Строки, которые не выбраны ни в одной линии, пропускаются: их не
+        // больше LANES на шаг
+        for (std::size_t r = k + 1; r < n; ++r) {
+            const LaneMask swap = pivotRow == broadcastLanes(static_cast<double>(r));
+            if (!anyLane(swap)) continue;
+            swapRowsMasked(lu + k * n * LANES, lu + r * n * LANES, k, n, swap);
+            swapRowsMasked(x + k * nrhs * LANES, x + r * nrhs * LANES, 0, nrhs, swap);
+        }
+
+        const Lanes pivot = loadLanes(lu + (k * n + k) * LANES);
+        const LaneMask singular = pivot == zero;
+        const LaneMask swapped = pivotRow != broadcastLanes(static_cast<double>(k));
+        determinant *= MATRIX_BATCH_SELECT(swapped, -pivot, pivot);
+        const Lanes inverse = MATRIX_BATCH_SELECT(singular, zero, one / MATRIX_BATCH_SELECT(singular, one, pivot));
+
+        for (std::size_t r = k + 1; r < n; ++r) {
+            const Lanes factor = loadLanes(lu + (r * n + k) * LANES) * inverse;
+            for (std::size_t c = k + 1; c < n; ++c) {
+                double* target = lu + (r * n + c) * LANES;
+                storeLanes(target, loadLanes(target) - factor * loadLanes(lu + (k * n + c) * LANES));
+            }
+            for (std::size_t c = 0; c < nrhs; ++c) {
+                double* target = x + (r * nrhs + c) * LANES;
+                storeLanes(target, loadLanes(target) - factor * loadLanes(x + (k * nrhs + c) * LANES));
+            }
+        }
+    }
+    storeLanes(det, determinant);
+}
+
+// Обратный ход U x = y на месте (U - результат eliminateGroupBody).
+// Нулевой диагональный элемент (линия дополнения или вырожденная матрица)
+// заменяется единицей: дополнение остаётся нулевым, а не 0 / 0 = NaN
+MATRIX_BATCH_INLINE void backSubstituteGroupBody(std::size_t n, std::size_t nrhs,
+                                                 const double* u, double* x) {
+    const Lanes zero = {};
+    const Lanes one = broadcastLanes(1.0);
+    for (std::size_t k = n; k-- > 0;) {
+        const Lanes stored = loadLanes(u + (k * n + k) * LANES);
+        const Lanes diagonal = MATRIX_BATCH_SELECT(stored == zero, one, stored);
+        for (std::size_t c = 0; c < nrhs; ++c) {
+            double* value = x + (k * nrhs + c) * LANES;
+            Lanes sum = loadLanes(value);
+            for (std::size_t p = k + 1; p < n; ++p) {
+                sum -= loadLanes(u + (k * n + p) * LANES) * loadLanes(x + (p * nrhs + c) * LANES);
+            }
+            storeLanes(value, sum / diagonal);
+        }
+    }
+}
+
+#ifdef MATRIX_BATCH_PSABI_SUPPRESSED
+#pragma GCC diagnostic pop
+#undef MATRIX_BATCH_PSABI_SUPPRESSED
+#endif
+
+// Обёртки для каждого уровня SIMD: тело ядра встраивается и векторизуется
+// под набор инструкций обёртки
+#define MATRIX_BATCH_KERNELS(SUFFIX, TARGET)                                                   \
+    TARGET void multiplyGroup##SUFFIX(std::size_t m, std::size_t n, std::size_t k,             \
+                                      const double* a, const double* b, double* c) {           \
+        multiplyGroupBody(m, n, k, a, b, c);                                                   \
+    }                                                                                          \
+    TARGET void eliminateGroup##SUFFIX(std::size_t n, std::size_t nrhs, double* lu,            \
+                                       double* x, double* det) {                               \
+        eliminateGroupBody(n, nrhs, lu, x, det);                                               \
+    }                                                                                          \
+    TARGET void backSubstituteGroup##SUFFIX(std::size_t n, std::size_t nrhs,                   \
+                                            const double* u, double* x) {                      \
+        backSubstituteGroupBody(n, nrhs, u, x);                                                \
+    }
+
+MATRIX_BATCH_KERNELS(Generic, )
+#if MATRIX_BATCH_X86
+MATRIX_BATCH_KERNELS(Avx2, __attribute__((target("avx2,fma"))))
+MATRIX_BATCH_KERNELS(Avx512, __attribute__((target("avx512f"))))
+#endif
+
+#undef MATRIX_BATCH_KERNELS
+
+struct GroupKernels {
+    void (*multiply)(std::size_t m, std::size_t n, std::size_t k,
+                     const double* a, const double* b, double* c);
+    void (*eliminate)(std::size_t n, std::size_t nrhs, double* lu, double* x, double* det);
+    void (*backSubstitute)(std::size_t n, std::size_t nrhs, const double* u, double* x);
+};
+
+// Базовый уровень x86-64 уже включает SSE2, поэтому общая версия
+// векторизуется под SSE2 без отдельной обёртки
+GroupKernels selectGroupKernels() {
+#if MATRIX_BATCH_X86
+    switch (kernels::getSimdLevel()) {
+        case kernels::SimdLevel::AVX512:
+            return {multiplyGroupAvx512, eliminateGroupAvx512, backSubstituteGroupAvx512};
+        case kernels::SimdLevel::AVX2:
+            return {multiplyGroupAvx2, eliminateGroupAvx2, backSubstituteGroupAvx2};
+        default:
+            break;
+    }
+#endif
+    return {multiplyGroupGeneric, eliminateGroupGeneric, backSubstituteGroupGeneric};
+}
+
+// Выполняет task(begin, end) над группами [0, groups). Если суммарная
+// работа не меньше порога параллельного умножения, группы делятся поровну
+// между потоками общего пула
+template <typename Task>
+void forEachGroupRange(std::size_t groups, std::size_t workPerGroup, Task task) {
+    std::size_t tasks = 1;
+    if (groups * workPerGroup >= RealMatrix::getParallelThreshold()) {
+        tasks = std::min(ThreadPool::getGlobalThreadCount(), groups);
+    }
+    if (tasks <= 1) {
+        task(std::size_t{0}, groups);
+        return;
+    }
+    ThreadPool::global()->parallelFor(tasks, [&](std::size_t t) {
+        task(groups * t / tasks, groups * (t + 1) / tasks);
+    });
+}
+
+} // namespace
+
+MatrixBatch::MatrixBatch() : count(0), numRows(0), numCols(0) {}
+
+MatrixBatch::MatrixBatch(std::size_t count, std::size_t rows, std::size_t cols, double initValue)
+    : count(count), numRows(rows), numCols(cols) {
+    if (count == 0 || rows == 0 || cols == 0) {
+        throw std::invalid_argument("Batch dimensions must be positive");
+    }
+    batchData.assign(getGroupCount() * getGroupSize(), 0.0);
+    if (initValue != 0.0) {
+        for (std::size_t b = 0; b < count; ++b) {
+            for (std::size_t i = 0; i < rows; ++i) {
+                for (std::size_t j = 0; j < cols; ++j) {
+                    batchData[offset(b, i, j)] = initValue;
+                }
+            }
+        }
+    }
+}
+
+MatrixBatch::MatrixBatch(const std::vector<RealMatrix>& matrices) : MatrixBatch() {
+    if (matrices.empty()) {
+        return;
+    }
+    *this = MatrixBatch(matrices.size(), matrices[0].getRows(), matrices[0].getCols());
+    for (std::size_t b = 0; b < count; ++b) {
+        setMatrix(b, matrices[b]);
+    }
+}
+
+std::size_t MatrixBatch::getCount() const {
+    return count;
+}
+
+std::size_t MatrixBatch::getRows() const {
+    return numRows;
+}
+
+std::size_t MatrixBatch::getCols() const {
+    return numCols;
+}
+
+double MatrixBatch::getValue(std::size_t index, std::size_t row, std::size_t col) const {
+    checkIndex(index, row, col);
+    return batchData[offset(index, row, col)];
+}
+
+void MatrixBatch::setValue(std::size_t index, std::size_t row, std::size_t col, double value) {
+    checkIndex(index, row, col);
+    batchData[offset(index, row, col)] = value;
+}
+
+const double* MatrixBatch::getData() const {
+    return batchData.data();
+}
+
+double* MatrixBatch::getData() {
+    return batchData.data();
+}
+
+RealMatrix MatrixBatch::getMatrix(std::size_t index) const {
+    checkIndex(index, 0, 0);
+    RealMatrix matrix(numRows, numCols);
+    double* data = matrix.getData();
+    const std::size_t stride = matrix.getRowStride();
+    for (std::size_t i = 0; i < numRows; ++i) {
+        for (std::size_t j = 0; j < numCols; ++j) {
+            data[i * stride + j] = batchData[offset(index, i, j)];
+        }
+    }
+    return matrix;
+}
+
+void MatrixBatch::setMatrix(std::size_t index, const RealMatrix& matrix) {
+    checkIndex(index, 0, 0);
+    if (matrix.getRows() != numRows || matrix.getCols() != numCols) {
+        throw std::invalid_argument("Matrix size must match batch matrix size");
+    }
+    const double* data = matrix.getData();
+    const std::size_t stride = matrix.getRowStride();
+    for (std::size_t i = 0; i < numRows; ++i) {
+        for (std::size_t j = 0; j < numCols; ++j) {
+            batchData[offset(index, i, j)] = data[i * stride + j];
+        }
+    }
+}
+
+std::vector<RealMatrix> MatrixBatch::toMatrices() const {
+    std::vector<RealMatrix> matrices;
+    matrices.reserve(count);
+    for (std::size_t b = 0; b < count; ++b) {
+        matrices.push_back(getMatrix(b));
+    }
+    return matrices;
+}
+
+MatrixBatch MatrixBatch::operator*(const MatrixBatch& other) const {
+    if (count != other.count) {
+        throw std::invalid_argument("Batches must contain the same number of matrices");
+    }
+    if (numCols != other.numRows) {
+        throw std::invalid_argument("Matrix dimensions don't match for multiplication");
+    }
+
+    MatrixBatch result(count, numRows, other.numCols);
+    const GroupKernels kernels = selectGroupKernels();
+    const std::size_t m = numRows;
+    const std::size_t n = other.numCols;
+    const std::size_t k = numCols;
+    forEachGroupRange(getGroupCount(), m * n * k * LANES, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t g = begin; g < end; ++g) {
+            kernels.multiply(m, n, k, batchData.data() + g * getGroupSize(),
+                             other.batchData.data() + g * other.getGroupSize(),
+                             result.batchData.data() + g * result.getGroupSize());
+        }
+    });
+    return result;
+}
+
+MatrixBatch MatrixBatch::computeTranspose() const {
+    MatrixBatch result(count, numCols, numRows);
+    // Перестановка целых векторов линий: группа читается и пишется подряд
+    forEachGroupRange(getGroupCount(), getGroupSize(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t g = begin; g < end; ++g) {
+            const double* source = batchData.data() + g * getGroupSize();
+            double* destination = result.batchData.data() + g * getGroupSize();
+            for (std::size_t i = 0; i < numRows; ++i) {
+                for (std::size_t j = 0; j < numCols; ++j) {
+                    std::copy_n(source + (i * numCols + j) * LANES, LANES,
+                                destination + (j * numRows + i) * LANES);
+                }
+            }
+        }
+    });
+    return result;
+}
+
+std::vector<double> MatrixBatch::calculateDeterminants() const {
+    if (numRows != numCols) {
+        throw std::invalid_argument("Matrix must be square to compute determinant");
+    }
+
+    std::vector<double> determinants(count);
+    const GroupKernels kernels = selectGroupKernels();
+    const std::size_t n = numRows;
+    forEachGroupRange(getGroupCount(), n * n * n * LANES, [&](std::size_t begin, std::size_t end) {
+        // Рабочая копия одной группы на весь участок
+        std::vector<double, AlignedAllocator<double>> lu(getGroupSize());
+        double det[LANES];
+        for (std::size_t g = begin; g < end; ++g) {
+            const double* group = batchData.data() + g * getGroupSize();
+            std::copy(group, group + getGroupSize(), lu.begin());
+            kernels.eliminate(n, 0, lu.data(), nullptr, det);
+            const std::size_t lanes = std::min(LANES, count - g * LANES);
+            std::copy_n(det, lanes, determinants.begin() + g * LANES);
+        }
+    });
+    return determinants;
+}
+
+MatrixBatch MatrixBatch::solve(const MatrixBatch& rhs) const {
+    if (numRows != numCols) {
+        throw std::invalid_argument("Matrix must be square to solve a linear system");
+    }
+    if (count != rhs.count) {
+        throw std::invalid_argument("Batches must contain the same number of matrices");
+    }
+    if (rhs.numRows != numRows) {
+        throw std::invalid_argument("Right-hand side row count must match matrix size");
+    }
+
+    MatrixBatch solution(rhs);
+    const GroupKernels kernels = selectGroupKernels();
+    const std::size_t n = numRows;
+    const std::size_t nrhs = rhs.numCols;
+    // Наименьший номер вырожденной матрицы; count - вырожденных нет
+    std::vector<std::size_t> firstSingular(getGroupCount(), count);
+    forEachGroupRange(getGroupCount(), n * n * (n + nrhs) * LANES, [&](std::size_t begin, std::size_t end) {
+        std::vector<double, AlignedAllocator<double>> lu(getGroupSize());
+        double det[LANES];
+        for (std::size_t g = begin; g < end; ++g) {
+            const double* group = batchData.data() + g * getGroupSize();
+            double* x = solution.batchData.data() + g * solution.getGroupSize();
+            std::copy(group, group + getGroupSize(), lu.begin());
+            kernels.eliminate(n, nrhs, lu.data(), x, det);
+            // Вырожденная линия - та, где на диагонали U остался ноль
+            // (по определителю нельзя: произведение может уйти в ноль)
+            const std::size_t lanes = std::min(LANES, count - g * LANES);
+            for (std::size_t lane = 0; lane < lanes && firstSingular[g] == count; ++lane) {
+                for (std::size_t k = 0; k < n; ++k) {
+                    if (lu[(k * n + k) * LANES + lane] == 0.0) {
+                        firstSingular[g] = g * LANES + lane;
+                        break;
+                    }
+                }
+            }
+            kernels.backSubstitute(n, nrhs, lu.data(), x);
+        }
+    });
+
+    const std::size_t singular = *std::min_element(firstSingular.begin(), firstSingular.end());
+    if (singular < count) {
+        throw std::runtime_error("Matrix " + std::to_string(singular) + " of the batch is singular");
+    }
+    return solution;
+}
+
+bool MatrixBatch::operator==(const MatrixBatch& other) const {
+    if (count != other.count || numRows != other.numRows || numCols != other.numCols) {
+        return false;
+    }
+    // Дополнительные матрицы обеих сторон нулевые и сравнение не меняют
+    return kernels::allClose(batchData.data(), other.batchData.data(), MATRIX_EPSILON, batchData.size());
+}
+
+bool MatrixBatch::operator!=(const MatrixBatch& other) const {
+    return !(*this == other);
+}
+
+std::size_t MatrixBatch::getGroupCount() const {
+    return (count + LANES - 1) / LANES;
+}
+
+std::size_t MatrixBatch::getGroupSize() const {
+    return numRows * numCols * LANES;
+}
+
+std::size_t MatrixBatch::offset(std::size_t index, std::size_t row, std::size_t col) const {
+    return index / LANES * getGroupSize() + (row * numCols + col) * LANES + index % LANES;
+}
+
+void MatrixBatch::checkIndex(std::size_t index, std::size_t row, std::size_t col) const {
+    if (index >= count || row >= numRows || col >= numCols) {
+        throw std::out_of_range("Batch indices out of range");
+    }
+}
@@ -0,0 +1,82 @@
+/**
+ * @file MatrixBatch.h
+ * @brief Batch of equally sized small matrices in interleaved (SoA) layout
+ * @author Shchurko
+ * @date 2025
+ */
+
+#ifndef MATRIXLAB_MATRIXBATCH_H
+#define MATRIXLAB_MATRIXBATCH_H
+
+#include <cstddef>
+#include <vector>
+#include "Matrix.h"
+
+/**
+ * @brief Пакет из count независимых матриц rows x cols
+ *
+ * Матрицы хранятся группами по BATCH_LANES: внутри группы элемент (i, j)
+ * всех матриц лежит подряд, поэтому каждая линия SIMD-регистра обрабатывает
+ * свою матрицу пакета, а ядра выполняют одни и те же инструкции для всех
+ * матриц группы без ветвлений по данным. Элемент (i, j) матрицы b находится
+ * по смещению
+ *
+ *     (b / BATCH_LANES) * rows * cols * BATCH_LANES
+ *         + (i * cols + j) * BATCH_LANES + b % BATCH_LANES.
+ *
+ * Число матриц дополняется до кратного BATCH_LANES нулевыми матрицами,
+ * которые не видны через интерфейс. Операции над большим пакетом делятся
+ * между потоками общего пула по тому же порогу, что и умножение
+ * RealMatrix (RealMatrix::setParallelThreshold).
+ */
+class MatrixBatch {
+public:
+    // Матриц в группе: ширина регистра AVX-512 для double и одна строка кэша
+    static constexpr std::size_t BATCH_LANES = 8;
+
+    // Конструкторы
+    MatrixBatch();
+    MatrixBatch(std::size_t count, std::size_t rows, std::size_t cols, double initValue = 0.0);
+    // Все матрицы должны быть одного размера
+    explicit MatrixBatch(const std::vector<RealMatrix>& matrices);
+
+    // Геттеры
+    std::size_t getCount() const;
+    std::size_t getRows() const;
+    std::size_t getCols() const;
+    double getValue(std::size_t index, std::size_t row, std::size_t col) const;
+    void setValue(std::size_t index, std::size_t row, std::size_t col, double value);
+    // Упакованные данные (раскладка описана у класса)
+    const double* getData() const;
+    double* getData();
+
+    // Обмен с RealMatrix
+    RealMatrix getMatrix(std::size_t index) const;
+    void setMatrix(std::size_t index, const RealMatrix& matrix);
+    std::vector<RealMatrix> toMatrices() const;
+
+    // Поэлементные произведения пакетов: C[b] = A[b] * B[b]
+    MatrixBatch operator*(const MatrixBatch& other) const;
+    MatrixBatch computeTranspose() const;
+    // Определители всех матриц (LU с выбором главного элемента в каждой матрице)
+    std::vector<double> calculateDeterminants() const;
+    // Решение A[b] X[b] = B[b] для всех b. Если хотя бы одна матрица
+    // вырождена, бросает std::runtime_error с её номером
+    MatrixBatch solve(const MatrixBatch& rhs) const;
+
+    bool operator==(const MatrixBatch& other) const;
+    bool operator!=(const MatrixBatch& other) const;
+
+private:
+    std::size_t count;
+    std::size_t numRows;
+    std::size_t numCols;
+    std::vector<double, AlignedAllocator<double>> batchData;
+
+    std::size_t getGroupCount() const;
+    std::size_t getGroupSize() const;
+    std::size_t offset(std::size_t index, std::size_t row, std::size_t col) const;
+    void checkIndex(std::size_t index, std::size_t row, std::size_t col) const;
+};
+
+#endif // MATRIXLAB_MATRIXBATCH_H
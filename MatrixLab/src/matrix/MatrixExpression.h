@@ -0,0 +1,443 @@
+/**
+ * @file MatrixExpression.h
+ * @brief Lazy elementwise expressions over RealMatrix evaluated in a single pass
+ * @author Shchurko
+ * @date 2025
+ */
+
+#ifndef MATRIXLAB_MATRIXEXPRESSION_H
+#define MATRIXLAB_MATRIXEXPRESSION_H
+
+#include <cstddef>
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "Matrix.h"
+#include "SimdKernels.h"
+#include "Transpose.h"
+
+// Длина участка, который выражение считает за один шаг. Промежуточные
+// значения живут в буферах на стеке и не покидают L1, а данные матриц
+// читаются из памяти один раз
+constexpr std::size_t EXPRESSION_BLOCK = 256;
+
+// Область памяти, в которую записывается выражение. При transposed
+// элемент (i, j) лежит по адресу data[j * rowStride + i]
+struct ExpressionTarget {
+    double* data;
+    std::size_t rows;
+    std::size_t cols;
+    std::size_t rowStride;
+    bool transposed;
+};
+
+namespace expression_detail {
+
+// Может ли запись в target испортить ещё не прочитанные значения операнда.
+// Операнд с той же раскладкой, что и target, безопасен: каждый элемент
+// читается до записи на то же место
+inline bool conflicts(const double* data, std::size_t rows, std::size_t cols,
+                      std::size_t rowStride, bool transposed, const ExpressionTarget& target) {
+    if (rows == 0 || cols == 0 || target.rows == 0 || target.cols == 0) {
+        return false;
+    }
+    if (data == target.data && rowStride == target.rowStride && transposed == target.transposed) {
+        return false;
+    }
+
+    const std::size_t storageRows = transposed ? cols : rows;
+    const std::size_t storageCols = transposed ? rows : cols;
+    const double* end = data + (storageRows - 1) * rowStride + storageCols;
+    const std::size_t targetRows = target.transposed ? target.cols : target.rows;
+    const std::size_t targetCols = target.transposed ? target.rows : target.cols;
+    const double* targetEnd = target.data + (targetRows - 1) * target.rowStride + targetCols;
+
+    std::less<const double*> before;
+    return before(data, targetEnd) && before(target.data, end);
+}
+
+} // namespace expression_detail
+
+// Общая база всех выражений, по ней операторы узнают свои операнды
+struct MatrixExpressionTag {};
+
+/**
+ * @brief Базовый класс (CRTP) для ленивых поэлементных выражений
+ *
+ * A + B * 2.0 - C не создаёт промежуточных матриц: операторы строят дерево
+ * узлов, а вычисление происходит при присваивании одним проходом по
+ * участкам строк длины EXPRESSION_BLOCK. Узел реализует
+ * evaluateRow(row, col, length, out): значения элементов строки row,
+ * начиная со столбца col, либо записываются в out, либо возвращаются
+ * указателем на готовые данные. isContiguous() означает, что строки
+ * операнда идут подряд без промежутков, и тогда всё выражение считается
+ * как одна строка длины rows * cols. Размеры проверяются при построении.
+ */
+template <typename Derived>
+class MatrixExpression : public MatrixExpressionTag {
+public:
+    const Derived& derived() const { return static_cast<const Derived&>(*this); }
+
+    std::size_t getRows() const { return derived().getRows(); }
+    std::size_t getCols() const { return derived().getCols(); }
+
+    RealMatrix evaluate() const { return RealMatrix(*this); }
+};
+
+// Лист выражения: матрица, которая переживёт выражение
+class MatrixReference : public MatrixExpression<MatrixReference> {
+public:
+    explicit MatrixReference(const RealMatrix& source) : matrix(source) {}
+
+    std::size_t getRows() const { return matrix.getRows(); }
+    std::size_t getCols() const { return matrix.getCols(); }
+
+    const double* evaluateRow(std::size_t row, std::size_t col, std::size_t, double*) const {
+        return matrix.getData() + row * matrix.getRowStride() + col;
+    }
+
+    bool isContiguous() const { return matrix.getRowStride() == matrix.getCols(); }
+
+    bool conflictsWith(const ExpressionTarget& target) const {
+        return expression_detail::conflicts(matrix.getData(), matrix.getRows(), matrix.getCols(),
+                                            matrix.getRowStride(), false, target);
+    }
+
+    RealMatrix* findTemporary() const { return nullptr; }
+
+private:
+    const RealMatrix& matrix;
+};
+
+// Лист выражения: временная матрица, которую выражение забирает себе.
+// Её буфер может стать буфером результата
+class MatrixTemporary : public MatrixExpression<MatrixTemporary> {
+public:
+    explicit MatrixTemporary(RealMatrix&& source) : matrix(std::move(source)) {}
+
+    std::size_t getRows() const { return matrix.getRows(); }
+    std::size_t getCols() const { return matrix.getCols(); }
+
+    const double* evaluateRow(std::size_t row, std::size_t col, std::size_t, double*) const {
+        return matrix.getData() + row * matrix.getRowStride() + col;
+    }
+
+    bool isContiguous() const { return matrix.getRowStride() == matrix.getCols(); }
+
+    // Временную матрицу не видит никто, кроме выражения
+    bool conflictsWith(const ExpressionTarget&) const { return false; }
+
+    RealMatrix* findTemporary() const { return &matrix; }
+
+private:
+    mutable RealMatrix matrix;
+};
+
+struct MatrixAddition {
+    static constexpr const char* mismatchMessage = "Matrices dimensions must match for addition";
+
+    static void apply(const double* left, const double* right, double* out, std::size_t count) {
+        kernels::add(left, right, out, count);
+    }
+};
+
+struct MatrixSubtraction {
+    static constexpr const char* mismatchMessage = "Matrices dimensions must match for subtraction";
+
+    static void apply(const double* left, const double* right, double* out, std::size_t count) {
+        kernels::subtract(left, right, out, count);
+    }
+};
+
+template <typename Left, typename Right, typename Operation>
+class BinaryExpression : public MatrixExpression<BinaryExpression<Left, Right, Operation>> {
+public:
+    BinaryExpression(Left leftOperand, Right rightOperand)
+            : left(std::move(leftOperand)), right(std::move(rightOperand)) {
+        if (left.getRows() != right.getRows() || left.getCols() != right.getCols()) {
+            throw std::invalid_argument(Operation::mismatchMessage);
+        }
+    }
+
+    std::size_t getRows() const { return left.getRows(); }
+    std::size_t getCols() const { return left.getCols(); }
+
+    // Операнды считаются в собственные буферы, поэтому out может
+    // совпадать с данными любого из листьев
+    const double* evaluateRow(std::size_t row, std::size_t col, std::size_t length, double* out) const {
+        alignas(MATRIX_ALIGNMENT) double leftBuffer[EXPRESSION_BLOCK];
+        alignas(MATRIX_ALIGNMENT) double rightBuffer[EXPRESSION_BLOCK];
+        const double* leftValues = left.evaluateRow(row, col, length, leftBuffer);
+        const double* rightValues = right.evaluateRow(row, col, length, rightBuffer);
+        Operation::apply(leftValues, rightValues, out, length);
+        return out;
+    }
+
+    bool isContiguous() const { return left.isContiguous() && right.isContiguous(); }
+
+    bool conflictsWith(const ExpressionTarget& target) const {
+        return left.conflictsWith(target) || right.conflictsWith(target);
+    }
+
+    RealMatrix* findTemporary() const {
+        RealMatrix* temporary = left.findTemporary();
+        return temporary != nullptr ? temporary : right.findTemporary();
+    }
+
+private:
+    Left left;
+    Right right;
+};
+
+template <typename Operand>
+class ScaledExpression : public MatrixExpression<ScaledExpression<Operand>> {
+public:
+    ScaledExpression(Operand operand, double scaleFactor)
+            : source(std::move(operand)), factor(scaleFactor) {}
+
+    std::size_t getRows() const { return source.getRows(); }
+    std::size_t getCols() const { return source.getCols(); }
+
+    const double* evaluateRow(std::size_t row, std::size_t col, std::size_t length, double* out) const {
+        alignas(MATRIX_ALIGNMENT) double buffer[EXPRESSION_BLOCK];
+        kernels::scale(source.evaluateRow(row, col, length, buffer), factor, out, length);
+        return out;
+    }
+
+    bool isContiguous() const { return source.isContiguous(); }
+
+    bool conflictsWith(const ExpressionTarget& target) const { return source.conflictsWith(target); }
+
+    RealMatrix* findTemporary() const { return source.findTemporary(); }
+
+private:
+    Operand source;
+    double factor;
+};
+
+namespace expression_detail {
+
+template <typename T>
+using Decayed = typename std::decay<T>::type;
+
+template <typename T>
+struct IsExpression : std::is_base_of<MatrixExpressionTag, Decayed<T>> {};
+
+template <typename T>
+struct IsMatrix : std::is_same<Decayed<T>, RealMatrix> {};
+
+template <typename T>
+struct IsOperand
+        : std::integral_constant<bool, IsMatrix<T>::value || IsExpression<T>::value> {};
+
+// Неконстантное rvalue забирается в выражение, остальные матрицы
+// запоминаются по ссылке, узлы выражений копируются/перемещаются
+template <typename T>
+struct TakesOwnership
+        : std::integral_constant<bool, IsMatrix<T>::value &&
+                                       !std::is_lvalue_reference<T>::value &&
+                                       !std::is_const<typename std::remove_reference<T>::type>::value> {};
+
+template <typename T>
+using Node = typename std::conditional<
+        IsMatrix<T>::value,
+        typename std::conditional<TakesOwnership<T>::value, MatrixTemporary, MatrixReference>::type,
+        Decayed<T>>::type;
+
+template <typename T>
+Node<T> makeNode(T&& operand) {
+    return Node<T>(std::forward<T>(operand));
+}
+
+template <typename Left, typename Right>
+using EnableElementwise = typename std::enable_if<
+        IsOperand<Left>::value && IsOperand<Right>::value>::type;
+
+// Операции над вычисленными матрицами (произведение, сравнение): хотя бы
+// один операнд - выражение, случай двух матриц обрабатывает RealMatrix
+template <typename Left, typename Right>
+using EnableMaterialized = typename std::enable_if<
+        IsOperand<Left>::value && IsOperand<Right>::value &&
+        (IsExpression<Left>::value || IsExpression<Right>::value)>::type;
+
+template <typename T>
+using EnableScalar = typename std::enable_if<IsOperand<T>::value>::type;
+
+inline const RealMatrix& materialize(const RealMatrix& matrix) {
+    return matrix;
+}
+
+template <typename Derived>
+RealMatrix materialize(const MatrixExpression<Derived>& expression) {
+    return RealMatrix(expression);
+}
+
+// Записывает значения выражения в target. Размеры должны совпадать,
+// а source не должен конфликтовать с target (conflictsWith)
+template <typename Source>
+void assignExpression(const Source& source, const ExpressionTarget& target) {
+    // Копия представления в другой раскладке - чистое транспонирование
+    if constexpr (std::is_base_of<ConstMatrixView, Source>::value) {
+        if (source.isTransposed() != target.transposed) {
+            const std::size_t sourceRows = source.isTransposed() ? target.cols : target.rows;
+            const std::size_t sourceCols = source.isTransposed() ? target.rows : target.cols;
+            kernels::transpose(sourceRows, sourceCols, source.getData(), source.getRowStride(),
+                               target.data, target.rowStride);
+            return;
+        }
+    }
+
+    auto evaluateRow = [&](std::size_t row, std::size_t length) {
+        alignas(MATRIX_ALIGNMENT) double buffer[EXPRESSION_BLOCK];
+        for (std::size_t col = 0; col < length; col += EXPRESSION_BLOCK) {
+            const std::size_t count = std::min(EXPRESSION_BLOCK, length - col);
+            if (!target.transposed) {
+                double* out = target.data + row * target.rowStride + col;
+                const double* values = source.evaluateRow(row, col, count, out);
+                if (values != out) {
+                    std::copy(values, values + count, out);
+                }
+                continue;
+            }
+
+            const double* values = source.evaluateRow(row, col, count, buffer);
+            double* out = target.data + col * target.rowStride + row;
+            for (std::size_t k = 0; k < count; ++k) {
+                out[k * target.rowStride] = values[k];
+            }
+        }
+    };
+
+    if (!target.transposed && target.rowStride == target.cols && source.isContiguous()) {
+        evaluateRow(0, target.rows * target.cols);
+        return;
+    }
+    for (std::size_t i = 0; i < target.rows; ++i) {
+        evaluateRow(i, target.cols);
+    }
+}
+
+} // namespace expression_detail
+
+template <typename Left, typename Right>
+using MatrixSum = BinaryExpression<Left, Right, MatrixAddition>;
+
+template <typename Left, typename Right>
+using MatrixDifference = BinaryExpression<Left, Right, MatrixSubtraction>;
+
+// Операторы выражений
+template <typename Left, typename Right,
+          typename = expression_detail::EnableElementwise<Left, Right>>
+MatrixSum<expression_detail::Node<Left>, expression_detail::Node<Right>>
+operator+(Left&& left, Right&& right) {
+    return {expression_detail::makeNode(std::forward<Left>(left)),
+            expression_detail::makeNode(std::forward<Right>(right))};
+}
+
+template <typename Left, typename Right,
+          typename = expression_detail::EnableElementwise<Left, Right>>
+MatrixDifference<expression_detail::Node<Left>, expression_detail::Node<Right>>
+operator-(Left&& left, Right&& right) {
+    return {expression_detail::makeNode(std::forward<Left>(left)),
+            expression_detail::makeNode(std::forward<Right>(right))};
+}
+
+template <typename Operand, typename = expression_detail::EnableScalar<Operand>>
+ScaledExpression<expression_detail::Node<Operand>> operator*(Operand&& operand, double scalar) {
+    return {expression_detail::makeNode(std::forward<Operand>(operand)), scalar};
+}
+
+template <typename Operand, typename = expression_detail::EnableScalar<Operand>>
+ScaledExpression<expression_detail::Node<Operand>> operator*(double scalar, Operand&& operand) {
+    return {expression_detail::makeNode(std::forward<Operand>(operand)), scalar};
+}
+
+template <typename Operand, typename = expression_detail::EnableScalar<Operand>>
+ScaledExpression<expression_detail::Node<Operand>> operator/(Operand&& operand, double scalar) {
+    if (std::abs(scalar) < MATRIX_EPSILON) {
+        throw std::invalid_argument("Division by zero");
+    }
+    return {expression_detail::makeNode(std::forward<Operand>(operand)), 1.0 / scalar};
+}
+
+// Сравнение и вывод вычисляют выражение во временную матрицу
+template <typename Left, typename Right,
+          typename = expression_detail::EnableMaterialized<Left, Right>>
+bool operator==(const Left& left, const Right& right) {
+    return expression_detail::materialize(left) == expression_detail::materialize(right);
+}
+
+template <typename Left, typename Right,
+          typename = expression_detail::EnableMaterialized<Left, Right>>
+bool operator!=(const Left& left, const Right& right) {
+    return !(left == right);
+}
+
+template <typename Derived>
+std::ostream& operator<<(std::ostream& os, const MatrixExpression<Derived>& expression) {
+    return os << expression.evaluate();
+}
+
+// Вычисление выражений в RealMatrix
+template <typename Derived>
+RealMatrix::BasicMatrix(const MatrixExpression<Derived>& expression)
+        : BasicMatrix() {
+    *this = expression;
+}
+
+template <typename Derived>
+RealMatrix::BasicMatrix(MatrixExpression<Derived>&& expression)
+        : BasicMatrix() {
+    *this = std::move(expression);
+}
+
+template <typename Derived>
+RealMatrix& RealMatrix::operator=(const MatrixExpression<Derived>& expression) {
+    const Derived& source = expression.derived();
+    // Общий буфер копирования при записи не копируется ради перезаписи:
+    // результат считается в новый
+    if (numRows == source.getRows() && numCols == source.getCols() && !matrixData.isShared()) {
+        // Поэлементное вычисление допускает запись поверх операнда: A = A + B
+        ExpressionTarget target{matrixData.data(), numRows, numCols, rowStride, false};
+        if (!source.conflictsWith(target)) {
+            expression_detail::assignExpression(source, target);
+            invalidateStructure();
+            return *this;
+        }
+    }
+
+    RealMatrix result(source.getRows(), source.getCols(), Uninitialized{});
+    expression_detail::assignExpression(
+            source, {result.matrixData.data(), result.numRows, result.numCols, result.rowStride, false});
+    return *this = std::move(result);
+}
+
+template <typename Derived>
+RealMatrix& RealMatrix::operator=(MatrixExpression<Derived>&& expression) {
+    const Derived& source = expression.derived();
+    RealMatrix* temporary = source.findTemporary();
+    if (temporary == nullptr || (numRows == source.getRows() && numCols == source.getCols())) {
+        return *this = static_cast<const MatrixExpression<Derived>&>(expression);
+    }
+
+    // Результат пишется в буфер временного операнда, затем буфер забирается
+    expression_detail::assignExpression(
+            source, {temporary->matrixData.data(), temporary->numRows, temporary->numCols,
+                     temporary->rowStride, false});
+    temporary->invalidateStructure();
+    return *this = std::move(*temporary);
+}
+
+template <typename Derived>
+RealMatrix& RealMatrix::operator+=(const MatrixExpression<Derived>& expression) {
+    return *this = *this + expression.derived();
+}
+
+template <typename Derived>
+RealMatrix& RealMatrix::operator-=(const MatrixExpression<Derived>& expression) {
+    return *this = *this - expression.derived();
+}
+
+#endif // MATRIXLAB_MATRIXEXPRESSION_H
@@ -0,0 +1,260 @@
+/**
+ * @file MatrixFile.cpp
+ * @brief Implementation of the binary matrix format and memory-mapped matrices
+ * @author Shchurko
+ * @date 2025
+ */
+
+#include "MatrixFile.h"
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define MATRIX_FILE_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define MATRIX_FILE_MMAP 0
+#endif
+
+namespace binary_format {
+
+namespace {
+
+constexpr char MAGIC[8] = {'M', 'T', 'X', 'L', 'A', 'B', '\0', '\0'};
+
+std::uint32_t swap32(std::uint32_t value) {
+    return (value >> 24) | ((value >> 8) & 0x0000FF00u) |
+           ((value << 8) & 0x00FF0000u) | (value << 24);
+}
+
+std::uint64_t swap64(std::uint64_t value) {
+    return (static_cast<std::uint64_t>(swap32(static_cast<std::uint32_t>(value))) << 32) |
+           swap32(static_cast<std::uint32_t>(value >> 32));
+}
+
+} // namespace
+
+Header makeHeader(std::size_t rows, std::size_t cols, std::size_t rowStride, std::uint64_t checksum) {
+    Header header{};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.type = static_cast<std::uint32_t>(BinaryType::Float64);
+    header.byteOrder = BYTE_ORDER_MARK;
+    header.headerSize = static_cast<std::uint32_t>(HEADER_SIZE);
+    header.rows = rows;
+    header.cols = cols;
+    header.rowStride = rowStride;
+    header.checksum = checksum;
+    return header;
+}
+
+bool parseHeader(const void* bytes, Header& header, bool& swapped) {
+    std::memcpy(&header, bytes, sizeof(Header));
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+        return false;
+    }
+
+    if (header.byteOrder == BYTE_ORDER_MARK) {
+        swapped = false;
+    } else if (header.byteOrder == swap32(BYTE_ORDER_MARK)) {
+        swapped = true;
+        header.version = swap32(header.version);
+        header.type = swap32(header.type);
+        header.byteOrder = BYTE_ORDER_MARK;
+        header.headerSize = swap32(header.headerSize);
+        header.rows = swap64(header.rows);
+        header.cols = swap64(header.cols);
+        header.rowStride = swap64(header.rowStride);
+        header.checksum = swap64(header.checksum);
+    } else {
+        return false;
+    }
+
+    return header.version == VERSION &&
+           header.type == static_cast<std::uint32_t>(BinaryType::Float64) &&
+           header.headerSize == HEADER_SIZE &&
+           header.rows > 0 && header.cols > 0 && header.rowStride >= header.cols;
+}
+
+bool readHeader(std::istream& stream, Header& header, bool& swapped) {
+    char bytes[HEADER_SIZE];
+    if (!stream.read(bytes, sizeof(bytes))) {
+        return false;
+    }
+    return parseHeader(bytes, header, swapped);
+}
+
+std::size_t payloadCount(const Header& header) {
+    const std::uint64_t limit = static_cast<std::uint64_t>(-1) / sizeof(double);
+    if (header.rows > limit / header.rowStride || header.rows * header.rowStride > SIZE_MAX) {
+        return 0;
+    }
+    return static_cast<std::size_t>(header.rows * header.rowStride);
+}
+
+// Размер потока без позиционирования (канал) неизвестен - данные не проверить
+bool holdsPayload(std::istream& stream, std::size_t count) {
+    const std::istream::pos_type position = stream.tellg();
+    if (position == std::istream::pos_type(-1) || !stream.seekg(0, std::ios::end)) {
+        return false;
+    }
+    const std::istream::pos_type end = stream.tellg();
+    if (end == std::istream::pos_type(-1) || !stream.seekg(position)) {
+        return false;
+    }
+    const std::uint64_t available = static_cast<std::uint64_t>(end - position);
+    return available / sizeof(double) >= count;
+}
+
+// Сумма Флетчера по 64-битным словам: вторая сумма учитывает положение
+// слова, поэтому перестановка строк тоже меняет результат
+std::uint64_t checksum(const double* data, std::size_t count) {
+    std::uint64_t sum = 0;
+    std::uint64_t weighted = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        std::uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        sum += word;
+        weighted += sum;
+    }
+    return sum ^ ((weighted << 32) | (weighted >> 32));
+}
+
+void swapBytes(double* data, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        std::uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        word = swap64(word);
+        std::memcpy(data + i, &word, sizeof(word));
+    }
+}
+
+} // namespace binary_format
+
+// Конструкторы
+MappedMatrix::MappedMatrix(const std::string& filename, bool verifyChecksum)
+        : mapping(nullptr), mappingSize(0), values(nullptr),
+          numRows(0), numCols(0), rowStride(0), fallback()
+{
+#if MATRIX_FILE_MMAP
+    const int descriptor = ::open(filename.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        throw std::runtime_error("Cannot open matrix file: " + filename);
+    }
+
+    struct stat status {};
+    if (::fstat(descriptor, &status) != 0 || status.st_size < static_cast<off_t>(binary_format::HEADER_SIZE)) {
+        ::close(descriptor);
+        throw std::runtime_error("Matrix file is truncated: " + filename);
+    }
+
+    mappingSize = static_cast<std::size_t>(status.st_size);
+    void* address = ::mmap(nullptr, mappingSize, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    // Отображение остаётся действительным и после закрытия дескриптора
+    ::close(descriptor);
+    if (address == MAP_FAILED) {
+        throw std::runtime_error("Cannot map matrix file: " + filename);
+    }
+    mapping = address;
+
+    binary_format::Header header{};
+    bool swapped = false;
+    std::string error;
+    std::size_t count = 0;
+    if (!binary_format::parseHeader(mapping, header, swapped)) {
+        error = "Invalid matrix file header: ";
+    } else if (swapped) {
+        error = "Matrix file byte order differs from this machine: ";
+    } else if ((count = binary_format::payloadCount(header)) == 0 ||
+               (mappingSize - binary_format::HEADER_SIZE) / sizeof(double) < count) {
+        error = "Matrix file is truncated: ";
+    } else {
+        values = reinterpret_cast<const double*>(static_cast<const char*>(mapping) + binary_format::HEADER_SIZE);
+        if (verifyChecksum && binary_format::checksum(values, count) != header.checksum) {
+            error = "Matrix file checksum mismatch: ";
+        }
+    }
+    if (!error.empty()) {
+        release();
+        throw std::runtime_error(error + filename);
+    }
+
+    numRows = static_cast<std::size_t>(header.rows);
+    numCols = static_cast<std::size_t>(header.cols);
+    rowStride = static_cast<std::size_t>(header.rowStride);
+#else
+    (void)verifyChecksum;
+    if (!fallback.loadBinary(filename)) {
+        throw std::runtime_error("Cannot load matrix file: " + filename);
+    }
+    values = fallback.getData();
+    numRows = fallback.getRows();
+    numCols = fallback.getCols();
+    rowStride = fallback.getRowStride();
+#endif
+}
+
+MappedMatrix::~MappedMatrix() {
+    release();
+}
+
+MappedMatrix::MappedMatrix(MappedMatrix&& other) noexcept
+        : mapping(other.mapping), mappingSize(other.mappingSize), values(other.values),
+          numRows(other.numRows), numCols(other.numCols), rowStride(other.rowStride),
+          fallback(std::move(other.fallback))
+{
+    other.mapping = nullptr;
+    other.mappingSize = 0;
+    other.values = nullptr;
+    other.numRows = other.numCols = other.rowStride = 0;
+}
+
+MappedMatrix& MappedMatrix::operator=(MappedMatrix&& other) noexcept {
+    if (this != &other) {
+        release();
+        mapping = other.mapping;
+        mappingSize = other.mappingSize;
+        values = other.values;
+        numRows = other.numRows;
+        numCols = other.numCols;
+        rowStride = other.rowStride;
+        fallback = std::move(other.fallback);
+
+        other.mapping = nullptr;
+        other.mappingSize = 0;
+        other.values = nullptr;
+        other.numRows = other.numCols = other.rowStride = 0;
+    }
+    return *this;
+}
+
+void MappedMatrix::release() noexcept {
+#if MATRIX_FILE_MMAP
+    if (mapping != nullptr) {
+        ::munmap(mapping, mappingSize);
+    }
+#endif
+    mapping = nullptr;
+    mappingSize = 0;
+    values = nullptr;
+}
+
+// Доступ к элементам
+double MappedMatrix::getValue(std::size_t row, std::size_t col) const {
+    if (row >= numRows || col >= numCols) {
+        throw std::out_of_range("Matrix indices out of range");
+    }
+    return values[row * rowStride + col];
+}
+
+ConstMatrixView MappedMatrix::view() const {
+    return ConstMatrixView(values, numRows, numCols, rowStride);
+}
+
+RealMatrix MappedMatrix::toMatrix() const {
+    return RealMatrix(view());
+}
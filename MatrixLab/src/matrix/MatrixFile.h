@@ -0,0 +1,127 @@
+/**
+ * @file MatrixFile.h
+ * @brief Versioned binary matrix format and memory-mapped read-only matrices
+ * @author Shchurko
+ * @date 2025
+ */
+
+#ifndef MATRIXLAB_MATRIXFILE_H
+#define MATRIXLAB_MATRIXFILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <string>
+#include "Matrix.h"
+
+/*
+ * Формат файла (все поля заголовка - в порядке байтов записавшей машины):
+ *
+ *   0  char[8]   магическая строка "MTXLAB\0\0"
+ *   8  uint32    версия формата
+ *  12  uint32    тип элементов (BinaryType)
+ *  16  uint32    метка порядка байтов BYTE_ORDER_MARK
+ *  20  uint32    размер заголовка (смещение данных)
+ *  24  uint64    число строк
+ *  32  uint64    число столбцов
+ *  40  uint64    шаг строки в элементах
+ *  48  uint64    контрольная сумма данных
+ *  56  byte[8]   резерв (нули)
+ *  64  данные    rows * rowStride элементов, строки подряд, хвост строк нулевой
+ *
+ * Данные лежат с тем же шагом строки, что и в RealMatrix, и начинаются
+ * с границы 64 байт: файл читается в буфер матрицы одним вызовом, а
+ * отображённые в память страницы сразу служат хранилищем представления.
+ */
+namespace binary_format {
+
+constexpr std::uint32_t VERSION = 1;
+constexpr std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+constexpr std::size_t HEADER_SIZE = 64;
+
+enum class BinaryType : std::uint32_t {
+    Float64 = 1
+};
+
+struct Header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t type;
+    std::uint32_t byteOrder;
+    std::uint32_t headerSize;
+    std::uint64_t rows;
+    std::uint64_t cols;
+    std::uint64_t rowStride;
+    std::uint64_t checksum;
+    std::uint8_t reserved[8];
+};
+
+static_assert(sizeof(Header) == HEADER_SIZE, "Binary header must be exactly 64 bytes");
+
+Header makeHeader(std::size_t rows, std::size_t cols, std::size_t rowStride, std::uint64_t checksum);
+
+// Читает и проверяет заголовок. swapped получает true, если файл записан
+// с другим порядком байтов (поля заголовка уже приведены к родному)
+bool readHeader(std::istream& stream, Header& header, bool& swapped);
+bool parseHeader(const void* bytes, Header& header, bool& swapped);
+
+// Число элементов данных; 0, если размеры не помещаются в size_t
+std::size_t payloadCount(const Header& header);
+
+// true, если от текущей позиции до конца потока есть count значений.
+// Проверяется до выделения памяти под данные: размеры в заголовке
+// испорченного файла могут быть сколь угодно большими
+bool holdsPayload(std::istream& stream, std::size_t count);
+
+// Контрольная сумма по 64-битным словам данных (в родном порядке байтов)
+std::uint64_t checksum(const double* data, std::size_t count);
+
+void swapBytes(double* data, std::size_t count);
+
+} // namespace binary_format
+
+/**
+ * @brief Матрица только для чтения, хранящаяся в отображённом в память файле
+ *
+ * Открывает файл, записанный RealMatrix::saveBinary, и отображает его
+ * в память без копирования: страницы подгружаются системой по мере
+ * обращения и разделяются между процессами. Значения доступны через
+ * представление view(), которое участвует в выражениях и умножении как
+ * обычная матрица и действительно, пока жив объект MappedMatrix.
+ * Файлы с чужим порядком байтов отобразить нельзя - их читает loadBinary.
+ * Где отображение недоступно, файл читается в собственную матрицу.
+ */
+class MappedMatrix {
+public:
+    // Бросает std::runtime_error, если файл не открывается или повреждён.
+    // verifyChecksum = false пропускает проход по всем данным при открытии
+    explicit MappedMatrix(const std::string& filename, bool verifyChecksum = true);
+    ~MappedMatrix();
+
+    MappedMatrix(MappedMatrix&& other) noexcept;
+    MappedMatrix& operator=(MappedMatrix&& other) noexcept;
+    MappedMatrix(const MappedMatrix&) = delete;
+    MappedMatrix& operator=(const MappedMatrix&) = delete;
+
+    std::size_t getRows() const { return numRows; }
+    std::size_t getCols() const { return numCols; }
+    double getValue(std::size_t row, std::size_t col) const;
+
+    ConstMatrixView view() const;
+    // Копия значений в обычную матрицу
+    RealMatrix toMatrix() const;
+
+private:
+    void release() noexcept;
+
+    void* mapping;
+    std::size_t mappingSize;
+    const double* values;
+    std::size_t numRows;
+    std::size_t numCols;
+    std::size_t rowStride;
+    // Хранилище для платформ без отображения файлов
+    RealMatrix fallback;
+};
+
+#endif // MATRIXLAB_MATRIXFILE_H
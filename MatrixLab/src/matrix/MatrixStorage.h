@@ -0,0 +1,164 @@
+/**
+ * @file MatrixStorage.h
+ * @brief Element buffer of RealMatrix with optional copy-on-write sharing
+ * @author Shchurko
+ * @date 2025
+ */
+
+#ifndef MATRIXLAB_MATRIXSTORAGE_H
+#define MATRIXLAB_MATRIXSTORAGE_H
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include "AlignedAllocator.h"
+
+/**
+ * @brief Буфер элементов с интерфейсом подмножества std::vector и
+ * необязательным копированием при записи
+ *
+ * В обычном режиме копия буфера глубокая. В режиме разделения
+ * (setShareable(true)) копии ссылаются на один блок со счётчиком ссылок
+ * std::atomic, а изменяемый доступ (data(), operator[]) к блоку, у
+ * которого есть другие владельцы, сначала копирует его («отсоединение»).
+ * Константный доступ не копирует никогда.
+ *
+ * Режим переходит к копиям и при присваивании от буфера в этом режиме и
+ * снимается только setShareable(false). Блок делят только буферы в
+ * режиме разделения: буфер без него пишет, не глядя на счётчик.
+ * Разные буферы, делящие блок, можно читать и изменять из разных
+ * потоков; один буфер, как и std::vector, - из одного потока за раз.
+ */
+class MatrixStorage {
+public:
+    using Values = std::vector<double, AlignedAllocator<double>>;
+
+    MatrixStorage() = default;
+
+    MatrixStorage(const MatrixStorage& other) : shareable(other.shareable) {
+        adopt(other);
+    }
+
+    MatrixStorage(MatrixStorage&& other) noexcept
+            : block(other.block), elements(other.elements), shareable(other.shareable) {
+        other.block = nullptr;
+        other.elements = nullptr;
+    }
+
+    ~MatrixStorage() { release(); }
+
+    // Копия строится до освобождения своего блока: при исключении буфер не меняется
+    MatrixStorage& operator=(const MatrixStorage& other) {
+        if (this != &other && (block != other.block || block == nullptr)) {
+            *this = MatrixStorage(other);
+        }
+        return *this;
+    }
+
+    // Чужой блок забирается без копирования; если он общий, режим
+    // разделения включается и у приёмника
+    MatrixStorage& operator=(MatrixStorage&& other) noexcept {
+        if (this != &other) {
+            release();
+            block = other.block;
+            elements = other.elements;
+            shareable = shareable || other.shareable;
+            other.block = nullptr;
+            other.elements = nullptr;
+        }
+        return *this;
+    }
+
+    std::size_t size() const { return block != nullptr ? block->values.size() : 0; }
+    bool empty() const { return size() == 0; }
+
+    const double* data() const { return elements; }
+    double* data() {
+        if (isShared()) detach();
+        return elements;
+    }
+
+    double operator[](std::size_t index) const { return elements[index]; }
+    double& operator[](std::size_t index) { return data()[index]; }
+
+    // Старые значения не нужны: общий блок не копируется, а отпускается
+    void assign(std::size_t count, double value) {
+        if (block != nullptr && !isShared()) {
+            block->values.assign(count, value);
+        } else {
+            release();
+            block = new Block(Values(count, value));
+        }
+        elements = block->values.data();
+    }
+
+    void resize(std::size_t count) {
+        if (block == nullptr) {
+            block = new Block(Values(count));
+        } else {
+            if (isShared()) detach();
+            block->values.resize(count);
+        }
+        elements = block->values.data();
+    }
+
+    void clear() { release(); }
+
+    bool isShareable() const { return shareable; }
+
+    // Выключение режима у общего блока сразу отсоединяет буфер
+    void setShareable(bool enabled) {
+        if (!enabled && isShared()) detach();
+        shareable = enabled;
+    }
+
+    // true, если блок сейчас делят несколько буферов
+    bool isShared() const {
+        return shareable && block != nullptr && block->references.load(std::memory_order_acquire) > 1;
+    }
+
+private:
+    struct Block {
+        explicit Block(Values initial) : values(std::move(initial)) {}
+
+        std::atomic<std::size_t> references{1};
+        Values values;
+    };
+
+    // Общий блок other или его копия (shareable уже установлен)
+    void adopt(const MatrixStorage& other) {
+        if (other.block == nullptr) return;
+        if (other.shareable) {
+            other.block->references.fetch_add(1, std::memory_order_relaxed);
+            block = other.block;
+        } else {
+            block = new Block(other.block->values);
+        }
+        elements = block->values.data();
+    }
+
+    // acq_rel: все обращения прежних владельцев к блоку завершаются до
+    // его удаления или записи единственным оставшимся владельцем
+    void release() {
+        if (block != nullptr && block->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete block;
+        }
+        block = nullptr;
+        elements = nullptr;
+    }
+
+    void detach() {
+        Block* copy = new Block(block->values);
+        release();
+        block = copy;
+        elements = block->values.data();
+    }
+
+    Block* block = nullptr;
+    // block->values.data(), чтобы чтение элемента не шло через два указателя
+    double* elements = nullptr;
+    bool shareable = false;
+};
+
+#endif // MATRIXLAB_MATRIXSTORAGE_H
@@ -0,0 +1,262 @@
+/**
+ * @file MatrixView.cpp
+ * @brief Implementation of matrix views
+ * @author Shchurko
+ * @date 2025
+ */
+
+#include "MatrixView.h"
+#include "SimdKernels.h"
+#include <algorithm>
+#include <cmath>
+
+// Конструкторы
+ConstMatrixView::ConstMatrixView(const double* data, std::size_t rows, std::size_t cols,
+                                 std::size_t rowStride, bool transposed)
+        : viewData(data), numRows(rows), numCols(cols), rowStride(rowStride),
+          transposed(transposed)
+{}
+
+MatrixView::MatrixView(double* data, std::size_t rows, std::size_t cols,
+                       std::size_t rowStride, bool transposed,
+                       std::atomic<std::uint32_t>* structureCache)
+        : ConstMatrixView(data, rows, cols, rowStride, transposed),
+          structureCache(structureCache)
+{}
+
+// Доступ к элементам
+double ConstMatrixView::getValue(std::size_t row, std::size_t col) const {
+    if (row >= numRows || col >= numCols) {
+        throw std::out_of_range("Matrix indices out of range");
+    }
+    return at(row, col);
+}
+
+void MatrixView::setValue(std::size_t row, std::size_t col, double value) {
+    if (row >= numRows || col >= numCols) {
+        throw std::out_of_range("Matrix indices out of range");
+    }
+    mutableData()[offsetOf(row, col, 1, 1)] = value;
+    markModified();
+}
+
+// Представления представления
+std::size_t ConstMatrixView::offsetOf(std::size_t startRow, std::size_t startCol,
+                                      std::size_t rows, std::size_t cols) const {
+    if (startRow + rows > numRows || startCol + cols > numCols) {
+        throw std::out_of_range("Submatrix exceeds matrix boundaries");
+    }
+    return transposed ? startCol * rowStride + startRow : startRow * rowStride + startCol;
+}
+
+ConstMatrixView ConstMatrixView::view(std::size_t startRow, std::size_t startCol,
+                                      std::size_t rows, std::size_t cols) const {
+    return ConstMatrixView(viewData + offsetOf(startRow, startCol, rows, cols),
+                           rows, cols, rowStride, transposed);
+}
+
+ConstMatrixView ConstMatrixView::row(std::size_t index) const {
+    return view(index, 0, 1, numCols);
+}
+
+ConstMatrixView ConstMatrixView::col(std::size_t index) const {
+    return view(0, index, numRows, 1);
+}
+
+ConstMatrixView ConstMatrixView::transposedView() const {
+    return ConstMatrixView(viewData, numCols, numRows, rowStride, !transposed);
+}
+
+MatrixView MatrixView::view(std::size_t startRow, std::size_t startCol,
+                            std::size_t rows, std::size_t cols) const {
+    return MatrixView(mutableData() + offsetOf(startRow, startCol, rows, cols),
+                      rows, cols, rowStride, transposed, structureCache);
+}
+
+MatrixView MatrixView::row(std::size_t index) const {
+    return view(index, 0, 1, numCols);
+}
+
+MatrixView MatrixView::col(std::size_t index) const {
+    return view(0, index, numRows, 1);
+}
+
+MatrixView MatrixView::transposedView() const {
+    return MatrixView(mutableData(), numCols, numRows, rowStride, !transposed, structureCache);
+}
+
+// Присваивание
+MatrixView& MatrixView::operator=(const MatrixView& other) {
+    return *this = static_cast<const ConstMatrixView&>(other);
+}
+
+MatrixView& MatrixView::operator=(const RealMatrix& matrix) {
+    return *this = MatrixReference(matrix);
+}
+
+MatrixView& MatrixView::operator*=(double scalar) {
+    return *this = *this * scalar;
+}
+
+MatrixView& MatrixView::operator/=(double scalar) {
+    return *this = *this / scalar;
+}
+
+void MatrixView::fill(double value) {
+    const std::size_t storageRows = transposed ? numCols : numRows;
+    const std::size_t storageCols = transposed ? numRows : numCols;
+    for (std::size_t i = 0; i < storageRows; ++i) {
+        double* start = mutableData() + i * rowStride;
+        std::fill(start, start + storageCols, value);
+    }
+    markModified();
+}
+
+// Обход хранимых строк: у транспонированного представления это столбцы
+template <typename Operation>
+bool ConstMatrixView::forEachSpan(Operation operation) const {
+    const std::size_t storageRows = transposed ? numCols : numRows;
+    const std::size_t storageCols = transposed ? numRows : numCols;
+    if (rowStride == storageCols) {
+        return operation(viewData, storageRows * storageCols);
+    }
+    for (std::size_t i = 0; i < storageRows; ++i) {
+        if (!operation(viewData + i * rowStride, storageCols)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Нормы и след
+double ConstMatrixView::calculateTrace() const {
+    if (!checkIsSquare()) {
+        throw std::invalid_argument("Matrix must be square to compute trace");
+    }
+    return kernels::sumStrided(viewData, numRows, rowStride + 1);
+}
+
+double ConstMatrixView::calculateNorm() const {
+    return reduce(Reduction::Norm);
+}
+
+double ConstMatrixView::calculateNorm1() const {
+    const std::vector<double> sums = reduceColumns(Reduction::SumAbs);
+    return sums.empty() ? 0.0 : *std::max_element(sums.begin(), sums.end());
+}
+
+double ConstMatrixView::calculateNormInf() const {
+    const std::vector<double> sums = reduceRows(Reduction::SumAbs);
+    return sums.empty() ? 0.0 : *std::max_element(sums.begin(), sums.end());
+}
+
+double ConstMatrixView::calculateMaxNorm() const {
+    return reduce(Reduction::MaxAbs);
+}
+
+// Свёртки идут по хранимым строкам: у транспонированного представления
+// строки и столбцы меняются местами
+double ConstMatrixView::reduce(Reduction kind) const {
+    const std::size_t storageRows = transposed ? numCols : numRows;
+    const std::size_t storageCols = transposed ? numRows : numCols;
+    return kernels::reduce(kind, viewData, storageRows, storageCols, rowStride);
+}
+
+std::vector<double> ConstMatrixView::reduceRows(Reduction kind) const {
+    std::vector<double> result(numRows);
+    if (transposed) {
+        kernels::reduceColumns(kind, viewData, numCols, numRows, rowStride, result.data());
+    } else {
+        kernels::reduceRows(kind, viewData, numRows, numCols, rowStride, result.data());
+    }
+    return result;
+}
+
+std::vector<double> ConstMatrixView::reduceColumns(Reduction kind) const {
+    std::vector<double> result(numCols);
+    if (transposed) {
+        kernels::reduceRows(kind, viewData, numCols, numRows, rowStride, result.data());
+    } else {
+        kernels::reduceColumns(kind, viewData, numRows, numCols, rowStride, result.data());
+    }
+    return result;
+}
+
+// Проверки свойств
+bool ConstMatrixView::checkIsSquare() const {
+    return numRows == numCols;
+}
+
+bool ConstMatrixView::checkIsDiagonal() const {
+    if (!checkIsSquare()) return false;
+    for (std::size_t i = 0; i < numRows; ++i) {
+        const double* row = viewData + i * rowStride;
+        for (std::size_t j = 0; j < numCols; ++j) {
+            if (i != j && std::abs(row[j]) > MATRIX_EPSILON) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool ConstMatrixView::checkIsZero() const {
+    return forEachSpan([&](const double* span, std::size_t length) {
+        return kernels::allWithin(span, MATRIX_EPSILON, length);
+    });
+}
+
+bool ConstMatrixView::checkIsIdentity() const {
+    if (!checkIsSquare()) return false;
+    for (std::size_t i = 0; i < numRows; ++i) {
+        const double* row = viewData + i * rowStride;
+        for (std::size_t j = 0; j < numCols; ++j) {
+            double expected = (i == j) ? 1.0 : 0.0;
+            if (std::abs(row[j] - expected) > MATRIX_EPSILON) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool ConstMatrixView::checkIsSymmetric() const {
+    if (!checkIsSquare()) return false;
+    for (std::size_t i = 0; i < numRows; ++i) {
+        for (std::size_t j = i + 1; j < numCols; ++j) {
+            if (std::abs(viewData[i * rowStride + j] - viewData[j * rowStride + i]) > MATRIX_EPSILON) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool ConstMatrixView::checkIsUpperTriangular() const {
+    if (!checkIsSquare()) return false;
+    for (std::size_t i = 1; i < numRows; ++i) {
+        for (std::size_t j = 0; j < i; ++j) {
+            if (std::abs(at(i, j)) > MATRIX_EPSILON) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool ConstMatrixView::checkIsLowerTriangular() const {
+    if (!checkIsSquare()) return false;
+    for (std::size_t i = 0; i < numRows; ++i) {
+        for (std::size_t j = i + 1; j < numCols; ++j) {
+            if (std::abs(at(i, j)) > MATRIX_EPSILON) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool ConstMatrixView::checkIsOrthogonal() const {
+    if (!checkIsSquare()) return false;
+    return RealMatrix::multiply(*this, transposedView()).checkIsIdentity();
+}
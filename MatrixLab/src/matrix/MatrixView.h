@@ -0,0 +1,241 @@
+/**
+ * @file MatrixView.h
+ * @brief Non-owning views of RealMatrix blocks, rows, columns and transposes
+ * @author Shchurko
+ * @date 2025
+ */
+
+#ifndef MATRIXLAB_MATRIXVIEW_H
+#define MATRIXLAB_MATRIXVIEW_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Matrix.h"
+#include "MatrixExpression.h"
+
+/**
+ * @brief Представление части матрицы без копирования (только чтение)
+ *
+ * Хранит указатель, размеры, шаг строки и признак транспонирования:
+ * элемент (i, j) лежит по адресу data[i * rowStride + j], а у
+ * транспонированного представления - data[j * rowStride + i].
+ * Представление не владеет данными и действительно, пока матрица
+ * существует и не меняет размер. Участвует в выражениях наравне с
+ * RealMatrix, умножение представлений идёт через kernels::gemm без
+ * копирования операндов.
+ */
+class ConstMatrixView : public MatrixExpression<ConstMatrixView> {
+public:
+    ConstMatrixView(const double* data, std::size_t rows, std::size_t cols,
+                    std::size_t rowStride, bool transposed = false);
+
+    std::size_t getRows() const { return numRows; }
+    std::size_t getCols() const { return numCols; }
+    std::size_t getRowStride() const { return rowStride; }
+    bool isTransposed() const { return transposed; }
+    const double* getData() const { return viewData; }
+
+    double getValue(std::size_t row, std::size_t col) const;
+
+    // Представления представления: блок, строка, столбец, транспонирование
+    ConstMatrixView view(std::size_t startRow, std::size_t startCol,
+                         std::size_t rows, std::size_t cols) const;
+    ConstMatrixView row(std::size_t index) const;
+    ConstMatrixView col(std::size_t index) const;
+    ConstMatrixView transposedView() const;
+
+    double calculateTrace() const;
+    // Норма Фробениуса: попарная сумма без переполнения (Reductions.h)
+    double calculateNorm() const;
+    // Наибольшая сумма модулей по столбцам (1), по строкам (inf) и
+    // наибольший модуль элемента
+    double calculateNorm1() const;
+    double calculateNormInf() const;
+    double calculateMaxNorm() const;
+
+    // Свёртка всех элементов, каждой строки и каждого столбца
+    double reduce(Reduction kind) const;
+    std::vector<double> reduceRows(Reduction kind) const;
+    std::vector<double> reduceColumns(Reduction kind) const;
+
+    bool checkIsSquare() const;
+    bool checkIsDiagonal() const;
+    bool checkIsZero() const;
+    bool checkIsIdentity() const;
+    bool checkIsSymmetric() const;
+    bool checkIsUpperTriangular() const;
+    bool checkIsLowerTriangular() const;
+    bool checkIsOrthogonal() const;
+
+    // Интерфейс листа выражения (MatrixExpression.h)
+    const double* evaluateRow(std::size_t row, std::size_t col, std::size_t length, double* out) const {
+        if (!transposed) {
+            return viewData + row * rowStride + col;
+        }
+        const double* source = viewData + col * rowStride + row;
+        for (std::size_t k = 0; k < length; ++k) {
+            out[k] = source[k * rowStride];
+        }
+        return out;
+    }
+
+    bool isContiguous() const { return !transposed && rowStride == numCols; }
+
+    bool conflictsWith(const ExpressionTarget& target) const {
+        return expression_detail::conflicts(viewData, numRows, numCols, rowStride, transposed, target);
+    }
+
+    RealMatrix* findTemporary() const { return nullptr; }
+
+protected:
+    // Элемент без проверки индексов
+    double at(std::size_t row, std::size_t col) const {
+        return transposed ? viewData[col * rowStride + row] : viewData[row * rowStride + col];
+    }
+
+    // Смещение блока от начала данных с учётом транспонирования
+    std::size_t offsetOf(std::size_t startRow, std::size_t startCol,
+                         std::size_t rows, std::size_t cols) const;
+
+    // Обходит хранимые строки непрерывными участками (как forEachSpan
+    // у RealMatrix), пока операция возвращает true
+    template <typename Operation>
+    bool forEachSpan(Operation operation) const;
+
+    const double* viewData;
+    std::size_t numRows;
+    std::size_t numCols;
+    std::size_t rowStride;
+    bool transposed;
+};
+
+/**
+ * @brief Представление части матрицы с записью
+ *
+ * Присваивание представлению (в том числе другого представления)
+ * копирует значения в элементы матрицы, а не перенаправляет
+ * представление. Если источник пересекается с приёмником в другой
+ * раскладке (например, M.view() = M.transposedView()), значения сначала
+ * вычисляются во временную матрицу.
+ *
+ * Представление матрицы хранит указатель на её кэш структурных свойств
+ * и сбрасывает его после каждой записи и при выдаче изменяемого
+ * указателя getData(), поэтому запись через долго живущее представление
+ * не оставляет устаревших свойств (диагональность и т.п.).
+ */
+class MatrixView : public ConstMatrixView {
+public:
+    // structureCache - кэш свойств матрицы-владельца (nullptr для
+    // буфера, у которого кэша нет)
+    MatrixView(double* data, std::size_t rows, std::size_t cols,
+               std::size_t rowStride, bool transposed = false,
+               std::atomic<std::uint32_t>* structureCache = nullptr);
+    MatrixView(const MatrixView& other) = default;
+
+    MatrixView& operator=(const MatrixView& other);
+    MatrixView& operator=(const RealMatrix& matrix);
+    template <typename Derived>
+    MatrixView& operator=(const MatrixExpression<Derived>& expression);
+
+    template <typename Operand>
+    MatrixView& operator+=(const Operand& operand);
+    template <typename Operand>
+    MatrixView& operator-=(const Operand& operand);
+    MatrixView& operator*=(double scalar);
+    MatrixView& operator/=(double scalar);
+
+    // Запись через указатель может изменить структуру матрицы
+    double* getData() const {
+        markModified();
+        return mutableData();
+    }
+    void setValue(std::size_t row, std::size_t col, double value);
+    void fill(double value);
+
+    MatrixView view(std::size_t startRow, std::size_t startCol,
+                    std::size_t rows, std::size_t cols) const;
+    MatrixView row(std::size_t index) const;
+    MatrixView col(std::size_t index) const;
+    MatrixView transposedView() const;
+
+private:
+    double* mutableData() const { return const_cast<double*>(viewData); }
+
+    void markModified() const {
+        if (structureCache != nullptr) structureCache->store(0, std::memory_order_relaxed);
+    }
+
+    ExpressionTarget target() const {
+        return {mutableData(), numRows, numCols, rowStride, transposed};
+    }
+
+    std::atomic<std::uint32_t>* structureCache;
+};
+
+template <typename Derived>
+MatrixView& MatrixView::operator=(const MatrixExpression<Derived>& expression) {
+    const Derived& source = expression.derived();
+    if (source.getRows() != numRows || source.getCols() != numCols) {
+        throw std::invalid_argument("View dimensions must match the assigned matrix");
+    }
+
+    if (source.conflictsWith(target())) {
+        RealMatrix values(source);
+        expression_detail::assignExpression(MatrixReference(values), target());
+    } else {
+        expression_detail::assignExpression(source, target());
+    }
+    markModified();
+    return *this;
+}
+
+template <typename Operand>
+MatrixView& MatrixView::operator+=(const Operand& operand) {
+    return *this = *this + operand;
+}
+
+template <typename Operand>
+MatrixView& MatrixView::operator-=(const Operand& operand) {
+    return *this = *this - operand;
+}
+
+// Операции, которым нужны вычисленные операнды
+namespace expression_detail {
+
+inline ConstMatrixView productOperand(const RealMatrix& matrix) {
+    return matrix.view();
+}
+
+inline ConstMatrixView productOperand(const ConstMatrixView& view) {
+    return view;
+}
+
+template <typename Derived>
+RealMatrix productOperand(const MatrixExpression<Derived>& expression) {
+    return RealMatrix(expression);
+}
+
+inline ConstMatrixView asView(const RealMatrix& matrix) {
+    return matrix.view();
+}
+
+inline ConstMatrixView asView(const ConstMatrixView& view) {
+    return view;
+}
+
+} // namespace expression_detail
+
+// Матрицы и представления передаются в gemm через шаги, составное
+// выражение сначала вычисляется
+template <typename Left, typename Right,
+          typename = expression_detail::EnableMaterialized<Left, Right>>
+RealMatrix operator*(const Left& left, const Right& right) {
+    const auto& leftOperand = expression_detail::productOperand(left);
+    const auto& rightOperand = expression_detail::productOperand(right);
+    return RealMatrix::multiply(expression_detail::asView(leftOperand),
+                                expression_detail::asView(rightOperand));
+}
+
+#endif // MATRIXLAB_MATRIXVIEW_H
@@ -0,0 +1,182 @@
+/**
+ * @file RealVector.cpp
+ * @brief Implementation of the dense vector and matrix-vector products
+ * @author Shchurko
+ * @date 2025
+ */
+
+#include "RealVector.h"
+#include "Gemv.h"
+#include "Reductions.h"
+#include "SimdKernels.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+// Конструкторы
+RealVector::RealVector() = default;
+
+RealVector::RealVector(std::size_t size, double initValue) : vectorData(size, initValue) {}
+
+RealVector::RealVector(const std::vector<double>& values) : vectorData(values.begin(), values.end()) {}
+
+// Геттеры
+std::size_t RealVector::getSize() const {
+    return vectorData.size();
+}
+
+double RealVector::getValue(std::size_t index) const {
+    if (index >= vectorData.size()) {
+        throw std::out_of_range("Vector index out of range");
+    }
+    return vectorData[index];
+}
+
+void RealVector::setValue(std::size_t index, double value) {
+    if (index >= vectorData.size()) {
+        throw std::out_of_range("Vector index out of range");
+    }
+    vectorData[index] = value;
+}
+
+const double* RealVector::getData() const {
+    return vectorData.data();
+}
+
+double* RealVector::getData() {
+    return vectorData.data();
+}
+
+std::vector<double> RealVector::toStdVector() const {
+    return std::vector<double>(vectorData.begin(), vectorData.end());
+}
+
+// Операции BLAS уровня 1
+double RealVector::dot(const RealVector& other) const {
+    checkSameSize(other);
+    return kernels::dot(vectorData.data(), other.vectorData.data(), vectorData.size());
+}
+
+RealVector& RealVector::axpy(double factor, const RealVector& x) {
+    checkSameSize(x);
+    kernels::axpy(factor, x.vectorData.data(), vectorData.data(), vectorData.size());
+    return *this;
+}
+
+double RealVector::calculateNorm() const {
+    return kernels::reduce(Reduction::Norm, vectorData.data(), 1, vectorData.size(), vectorData.size());
+}
+
+double RealVector::calculateNorm1() const {
+    return kernels::reduce(Reduction::SumAbs, vectorData.data(), 1, vectorData.size(), vectorData.size());
+}
+
+double RealVector::calculateNormInf() const {
+    return kernels::reduce(Reduction::MaxAbs, vectorData.data(), 1, vectorData.size(), vectorData.size());
+}
+
+// Арифметические операторы
+RealVector RealVector::operator+(const RealVector& other) const {
+    RealVector result(*this);
+    return result += other;
+}
+
+RealVector RealVector::operator-(const RealVector& other) const {
+    RealVector result(*this);
+    return result -= other;
+}
+
+RealVector RealVector::operator*(double scalar) const {
+    RealVector result(*this);
+    return result *= scalar;
+}
+
+RealVector RealVector::operator/(double scalar) const {
+    RealVector result(*this);
+    return result /= scalar;
+}
+
+RealVector& RealVector::operator+=(const RealVector& other) {
+    checkSameSize(other);
+    kernels::add(vectorData.data(), other.vectorData.data(), vectorData.data(), vectorData.size());
+    return *this;
+}
+
+RealVector& RealVector::operator-=(const RealVector& other) {
+    checkSameSize(other);
+    kernels::subtract(vectorData.data(), other.vectorData.data(), vectorData.data(), vectorData.size());
+    return *this;
+}
+
+RealVector& RealVector::operator*=(double scalar) {
+    kernels::scale(vectorData.data(), scalar, vectorData.data(), vectorData.size());
+    return *this;
+}
+
+RealVector& RealVector::operator/=(double scalar) {
+    if (std::abs(scalar) < MATRIX_EPSILON) {
+        throw std::invalid_argument("Division by zero");
+    }
+    return *this *= (1.0 / scalar);
+}
+
+RealVector operator*(double scalar, const RealVector& vector) {
+    return vector * scalar;
+}
+
+// Операторы сравнения
+bool RealVector::operator==(const RealVector& other) const {
+    return vectorData.size() == other.vectorData.size() &&
+           kernels::allClose(vectorData.data(), other.vectorData.data(), MATRIX_EPSILON, vectorData.size());
+}
+
+bool RealVector::operator!=(const RealVector& other) const {
+    return !(*this == other);
+}
+
+std::ostream& operator<<(std::ostream& os, const RealVector& vector) {
+    for (std::size_t i = 0; i < vector.vectorData.size(); ++i) {
+        os << vector.vectorData[i];
+        if (i + 1 < vector.vectorData.size()) os << " ";
+    }
+    return os;
+}
+
+// Произведения матрицы на вектор
+void RealVector::multiply(const ConstMatrixView& matrix, const RealVector& x, RealVector& y,
+                          double alpha, double beta) {
+    if (matrix.getCols() != x.getSize()) {
+        throw std::invalid_argument("Matrix column count must match vector size");
+    }
+    if (matrix.getRows() != y.getSize()) {
+        throw std::invalid_argument("Matrix row count must match result vector size");
+    }
+    if (&x == &y) {
+        throw std::invalid_argument("Result vector must not alias the multiplied vector");
+    }
+
+    // Транспонированное представление хранит исходную матрицу cols x rows
+    if (matrix.isTransposed()) {
+        kernels::gemvTransposed(matrix.getCols(), matrix.getRows(), alpha, matrix.getData(),
+                                matrix.getRowStride(), x.getData(), beta, y.getData());
+    } else {
+        kernels::gemv(matrix.getRows(), matrix.getCols(), alpha, matrix.getData(),
+                      matrix.getRowStride(), x.getData(), beta, y.getData());
+    }
+}
+
+RealVector operator*(const ConstMatrixView& matrix, const RealVector& x) {
+    RealVector result(matrix.getRows());
+    RealVector::multiply(matrix, x, result);
+    return result;
+}
+
+RealVector operator*(const RealMatrix& matrix, const RealVector& x) {
+    return matrix.view() * x;
+}
+
+void RealVector::checkSameSize(const RealVector& other) const {
+    if (vectorData.size() != other.vectorData.size()) {
+        throw std::invalid_argument("Vectors must have the same size");
+    }
+}
@@ -0,0 +1,86 @@
+/**
+ * @file RealVector.h
+ * @brief Dense contiguous vector with BLAS-1 operations and matrix-vector products
+ * @author Shchurko
+ * @date 2025
+ */
+
+#ifndef MATRIXLAB_REALVECTOR_H
+#define MATRIXLAB_REALVECTOR_H
+
+#include <cstddef>
+#include <iostream>
+#include <vector>
+#include "Matrix.h"
+
+/**
+ * @brief Плотный вектор в одном выровненном буфере
+ *
+ * Поэлементные операции, dot и axpy идут через SIMD-ядра (SimdKernels.h),
+ * произведения с матрицей - через kernels::gemv (Gemv.h) без промежуточной
+ * матрицы n x 1. Для итерационных методов есть multiply, которое пишет
+ * результат в уже выделенный вектор.
+ */
+class RealVector {
+public:
+    // Конструкторы
+    RealVector();
+    explicit RealVector(std::size_t size, double initValue = 0.0);
+    RealVector(const std::vector<double>& values);
+
+    // Геттеры
+    std::size_t getSize() const;
+    double getValue(std::size_t index) const;
+    void setValue(std::size_t index, double value);
+    const double* getData() const;
+    double* getData();
+    std::vector<double> toStdVector() const;
+
+    // Скалярное произведение и this += factor * x
+    double dot(const RealVector& other) const;
+    RealVector& axpy(double factor, const RealVector& x);
+
+    // Нормы: евклидова, сумма модулей и наибольший модуль
+    double calculateNorm() const;
+    double calculateNorm1() const;
+    double calculateNormInf() const;
+
+    // Арифметические операторы
+    RealVector operator+(const RealVector& other) const;
+    RealVector operator-(const RealVector& other) const;
+    RealVector operator*(double scalar) const;
+    RealVector operator/(double scalar) const;
+    RealVector& operator+=(const RealVector& other);
+    RealVector& operator-=(const RealVector& other);
+    RealVector& operator*=(double scalar);
+    RealVector& operator/=(double scalar);
+
+    // Операторы сравнения (с допуском MATRIX_EPSILON)
+    bool operator==(const RealVector& other) const;
+    bool operator!=(const RealVector& other) const;
+
+    friend std::ostream& operator<<(std::ostream& os, const RealVector& vector);
+
+    /**
+     * @brief y = alpha * A * x + beta * y без выделения памяти
+     *
+     * A - матрица или представление; транспонированное представление
+     * (A.transposedView()) считается ядром A^T x, которое читает строки
+     * исходной матрицы подряд. y должен иметь длину A.getRows().
+     */
+    static void multiply(const ConstMatrixView& matrix, const RealVector& x, RealVector& y,
+                         double alpha = 1.0, double beta = 0.0);
+
+private:
+    std::vector<double, AlignedAllocator<double>> vectorData;
+
+    void checkSameSize(const RealVector& other) const;
+};
+
+RealVector operator*(double scalar, const RealVector& vector);
+
+// Произведение матрицы (или представления, в том числе транспонированного) на вектор
+RealVector operator*(const ConstMatrixView& matrix, const RealVector& x);
+RealVector operator*(const RealMatrix& matrix, const RealVector& x);
+
+#endif // MATRIXLAB_REALVECTOR_H
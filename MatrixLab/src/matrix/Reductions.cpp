@@ -0,0 +1,581 @@
+/**
+ * @file Reductions.cpp
+ * @brief Span kernels (scalar, AVX2, AVX-512), pairwise cascades and threading for reductions
+ * @author Shchurko
+ * @date 2025
+ */
+
+#include "Reductions.h"
+#include "SimdKernels.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define MATRIX_REDUCTION_X86 1
+#include <immintrin.h>
+#else
+#define MATRIX_REDUCTION_X86 0
+#endif
+
+namespace kernels {
+
+namespace {
+
+// Элементов в блоке, который ядро суммирует напрямую
+constexpr std::size_t REDUCTION_BLOCK = 512;
+// Блоков в одной задаче; разбиение зависит только от размеров
+constexpr std::size_t CHUNK_BLOCKS = 64;
+// reduceColumns: строк в группе, которая суммируется напрямую, и
+// наименьший участок столбцов на поток
+constexpr std::size_t COLUMN_GROUP_ROWS = 32;
+constexpr std::size_t MIN_COLS_PER_TASK = 256;
+// sumStrided: значения с шагом не ложатся в SIMD-регистры, поэтому
+// напрямую складываются лишь короткие группы
+constexpr std::size_t STRIDED_BLOCK = 8;
+
+constexpr double INFINITY_VALUE = std::numeric_limits<double>::infinity();
+// Сумма квадратов меньше count * NORM_UNDERFLOW могла потерять точность
+// на исчезновении порядка: квадраты элементов меньше 1e-154 денормальны
+constexpr double NORM_UNDERFLOW = std::numeric_limits<double>::min() / std::numeric_limits<double>::epsilon();
+
+using SpanFunction = double (*)(const double* a, std::size_t n);
+
+struct SpanKernel {
+    SpanFunction sum;
+    SpanFunction sumAbs;
+    SpanFunction maxAbs;
+    SpanFunction min;
+    SpanFunction max;
+};
+
+// ==================== Ядра участков ====================
+double sumGeneric(const double* a, std::size_t n) {
+    double sum0 = 0.0, sum1 = 0.0, sum2 = 0.0, sum3 = 0.0;
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        sum0 += a[i];
+        sum1 += a[i + 1];
+        sum2 += a[i + 2];
+        sum3 += a[i + 3];
+    }
+    for (; i < n; ++i) sum0 += a[i];
+    return (sum0 + sum1) + (sum2 + sum3);
+}
+
+double sumAbsGeneric(const double* a, std::size_t n) {
+    double sum0 = 0.0, sum1 = 0.0, sum2 = 0.0, sum3 = 0.0;
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        sum0 += std::abs(a[i]);
+        sum1 += std::abs(a[i + 1]);
+        sum2 += std::abs(a[i + 2]);
+        sum3 += std::abs(a[i + 3]);
+    }
+    for (; i < n; ++i) sum0 += std::abs(a[i]);
+    return (sum0 + sum1) + (sum2 + sum3);
+}
+
+double maxAbsGeneric(const double* a, std::size_t n) {
+    double result = 0.0;
+    for (std::size_t i = 0; i < n; ++i) result = std::max(result, std::abs(a[i]));
+    return result;
+}
+
+double minGeneric(const double* a, std::size_t n) {
+    double result = INFINITY_VALUE;
+    for (std::size_t i = 0; i < n; ++i) result = std::min(result, a[i]);
+    return result;
+}
+
+double maxGeneric(const double* a, std::size_t n) {
+    double result = -INFINITY_VALUE;
+    for (std::size_t i = 0; i < n; ++i) result = std::max(result, a[i]);
+    return result;
+}
+
+#if MATRIX_REDUCTION_X86
+
+__attribute__((target("avx2,fma")))
+double horizontalSumAvx2(__m256d value) {
+    __m128d pair = _mm_add_pd(_mm256_castpd256_pd128(value), _mm256_extractf128_pd(value, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(pair, _mm_unpackhi_pd(pair, pair)));
+}
+
+__attribute__((target("avx2,fma")))
+double sumAvx2(const double* a, std::size_t n) {
+    __m256d sum0 = _mm256_setzero_pd();
+    __m256d sum1 = _mm256_setzero_pd();
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        sum0 = _mm256_add_pd(sum0, _mm256_loadu_pd(a + i));
+        sum1 = _mm256_add_pd(sum1, _mm256_loadu_pd(a + i + 4));
+    }
+    double sum = horizontalSumAvx2(_mm256_add_pd(sum0, sum1));
+    for (; i < n; ++i) sum += a[i];
+    return sum;
+}
+
+__attribute__((target("avx2,fma")))
+double sumAbsAvx2(const double* a, std::size_t n) {
+    const __m256d absMask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7fffffffffffffffLL));
+    __m256d sum0 = _mm256_setzero_pd();
+    __m256d sum1 = _mm256_setzero_pd();
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        sum0 = _mm256_add_pd(sum0, _mm256_and_pd(_mm256_loadu_pd(a + i), absMask));
+        sum1 = _mm256_add_pd(sum1, _mm256_and_pd(_mm256_loadu_pd(a + i + 4), absMask));
+    }
+    double sum = horizontalSumAvx2(_mm256_add_pd(sum0, sum1));
+    for (; i < n; ++i) sum += std::abs(a[i]);
+    return sum;
+}
+
+__attribute__((target("avx2,fma")))
+double maxAbsAvx2(const double* a, std::size_t n) {
+    const __m256d absMask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7fffffffffffffffLL));
+    __m256d result = _mm256_setzero_pd();
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        result = _mm256_max_pd(result, _mm256_and_pd(_mm256_loadu_pd(a + i), absMask));
+    }
+    double lanes[4];
+    _mm256_storeu_pd(lanes, result);
+    return std::max(std::max(lanes[0], lanes[1]), std::max(std::max(lanes[2], lanes[3]), maxAbsGeneric(a + i, n - i)));
+}
+
+__attribute__((target("avx2,fma")))
+double minAvx2(const double* a, std::size_t n) {
+    __m256d result = _mm256_set1_pd(INFINITY_VALUE);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) result = _mm256_min_pd(result, _mm256_loadu_pd(a + i));
+    double lanes[4];
+    _mm256_storeu_pd(lanes, result);
+    return std::min(std::min(lanes[0], lanes[1]), std::min(std::min(lanes[2], lanes[3]), minGeneric(a + i, n - i)));
+}
+
+__attribute__((target("avx2,fma")))
+double maxAvx2(const double* a, std::size_t n) {
+    __m256d result = _mm256_set1_pd(-INFINITY_VALUE);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) result = _mm256_max_pd(result, _mm256_loadu_pd(a + i));
+    double lanes[4];
+    _mm256_storeu_pd(lanes, result);
+    return std::max(std::max(lanes[0], lanes[1]), std::max(std::max(lanes[2], lanes[3]), maxGeneric(a + i, n - i)));
+}
+
+// Хвост короче 8 элементов читается маской, недостающие дорожки
+// заполняются нейтральным значением
+__attribute__((target("avx512f")))
+__mmask8 tailMaskAvx512(std::size_t remaining) {
+    return static_cast<__mmask8>((1u << remaining) - 1u);
+}
+
+__attribute__((target("avx512f")))
+double sumAvx512(const double* a, std::size_t n) {
+    __m512d sum0 = _mm512_setzero_pd();
+    __m512d sum1 = _mm512_setzero_pd();
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        sum0 = _mm512_add_pd(sum0, _mm512_loadu_pd(a + i));
+        sum1 = _mm512_add_pd(sum1, _mm512_loadu_pd(a + i + 8));
+    }
+    for (; i < n; i += 8) {
+        sum0 = _mm512_add_pd(sum0, _mm512_maskz_loadu_pd(tailMaskAvx512(std::min<std::size_t>(n - i, 8)), a + i));
+    }
+    return _mm512_reduce_add_pd(_mm512_add_pd(sum0, sum1));
+}
+
+__attribute__((target("avx512f")))
+double sumAbsAvx512(const double* a, std::size_t n) {
+    __m512d sum0 = _mm512_setzero_pd();
+    __m512d sum1 = _mm512_setzero_pd();
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        sum0 = _mm512_add_pd(sum0, _mm512_abs_pd(_mm512_loadu_pd(a + i)));
+        sum1 = _mm512_add_pd(sum1, _mm512_abs_pd(_mm512_loadu_pd(a + i + 8)));
+    }
+    for (; i < n; i += 8) {
+        const __mmask8 mask = tailMaskAvx512(std::min<std::size_t>(n - i, 8));
+        sum0 = _mm512_add_pd(sum0, _mm512_abs_pd(_mm512_maskz_loadu_pd(mask, a + i)));
+    }
+    return _mm512_reduce_add_pd(_mm512_add_pd(sum0, sum1));
+}
+
+__attribute__((target("avx512f")))
+double maxAbsAvx512(const double* a, std::size_t n) {
+    __m512d result = _mm512_setzero_pd();
+    for (std::size_t i = 0; i < n; i += 8) {
+        const __mmask8 mask = tailMaskAvx512(std::min<std::size_t>(n - i, 8));
+        result = _mm512_max_pd(result, _mm512_abs_pd(_mm512_maskz_loadu_pd(mask, a + i)));
+    }
+    return _mm512_reduce_max_pd(result);
+}
+
+__attribute__((target("avx512f")))
+double minAvx512(const double* a, std::size_t n) {
+    const __m512d neutral = _mm512_set1_pd(INFINITY_VALUE);
+    __m512d result = neutral;
+    for (std::size_t i = 0; i < n; i += 8) {
+        const __mmask8 mask = tailMaskAvx512(std::min<std::size_t>(n - i, 8));
+        result = _mm512_min_pd(result, _mm512_mask_loadu_pd(neutral, mask, a + i));
+    }
+    return _mm512_reduce_min_pd(result);
+}
+
+__attribute__((target("avx512f")))
+double maxAvx512(const double* a, std::size_t n) {
+    const __m512d neutral = _mm512_set1_pd(-INFINITY_VALUE);
+    __m512d result = neutral;
+    for (std::size_t i = 0; i < n; i += 8) {
+        const __mmask8 mask = tailMaskAvx512(std::min<std::size_t>(n - i, 8));
+        result = _mm512_max_pd(result, _mm512_mask_loadu_pd(neutral, mask, a + i));
+    }
+    return _mm512_reduce_max_pd(result);
+}
+
+#endif // MATRIX_REDUCTION_X86
+
+SpanKernel selectSpanKernel() {
+#if MATRIX_REDUCTION_X86
+    switch (getSimdLevel()) {
+        case SimdLevel::AVX512: return {sumAvx512, sumAbsAvx512, maxAbsAvx512, minAvx512, maxAvx512};
+        case SimdLevel::AVX2: return {sumAvx2, sumAbsAvx2, maxAbsAvx2, minAvx2, maxAvx2};
+        default: break;
+    }
+#endif
+    return {sumGeneric, sumAbsGeneric, maxAbsGeneric, minGeneric, maxGeneric};
+}
+
+// ==================== Накопители ====================
+
+// Попарная сумма значений, поступающих по порядку: в стеке лежат суммы
+// 1, 2, 4, ... слагаемых, и равные по весу сливаются, как разряды
+// двоичного счётчика. Каждое слагаемое участвует в O(log n) сложениях
+class PairwiseSum {
+public:
+    void add(double value) {
+        std::size_t weight = 1;
+        while (depth > 0 && weights[depth - 1] == weight) {
+            value = partials[--depth] + value;
+            weight *= 2;
+        }
+        partials[depth] = value;
+        weights[depth] = weight;
+        ++depth;
+    }
+
+    // Остаток стека складывается от меньших сумм к большим
+    double result() const {
+        double total = 0.0;
+        for (std::size_t i = depth; i-- > 0;) total += partials[i];
+        return total;
+    }
+
+private:
+    // Веса в стеке - различные степени двойки, 64 уровней хватает всегда
+    double partials[64];
+    std::size_t weights[64];
+    std::size_t depth = 0;
+};
+
+class MaxOf {
+public:
+    explicit MaxOf(double initial = -INFINITY_VALUE) : value(initial) {}
+    void add(double x) { value = std::max(value, x); }
+    double result() const { return value; }
+
+private:
+    double value;
+};
+
+class MinOf {
+public:
+    void add(double x) { value = std::min(value, x); }
+    double result() const { return value; }
+
+private:
+    double value = INFINITY_VALUE;
+};
+
+// Попарная сумма векторов длины width (частичные суммы групп строк)
+class PairwiseVectorSum {
+public:
+    explicit PairwiseVectorSum(std::size_t width) : width(width) {}
+
+    void add(std::vector<double> values) {
+        std::size_t weight = 1;
+        while (!weights.empty() && weights.back() == weight) {
+            kernels::add(partials.back().data(), values.data(), values.data(), width);
+            partials.pop_back();
+            weights.pop_back();
+            weight *= 2;
+        }
+        partials.push_back(std::move(values));
+        weights.push_back(weight);
+    }
+
+    void result(double* out) const {
+        std::fill(out, out + width, 0.0);
+        for (std::size_t i = partials.size(); i-- > 0;) {
+            kernels::add(out, partials[i].data(), out, width);
+        }
+    }
+
+private:
+    std::size_t width;
+    std::vector<std::vector<double>> partials;
+    std::vector<std::size_t> weights;
+};
+
+// ==================== Свёртка блоков ====================
+
+// Делит элементы на блоки не длиннее REDUCTION_BLOCK (внутри строк;
+// без выравнивающего хвоста весь буфер - одна строка), блоки - на
+// задачи по CHUNK_BLOCKS. Каждая задача сводит свои блоки накопителем
+// Accumulator, итоги задач сводятся тем же накопителем по порядку
+template <typename Accumulator, typename BlockFunction>
+double reduceBlocks(const double* a, std::size_t rows, std::size_t cols, std::size_t rowStride,
+                    BlockFunction block) {
+    if (rowStride == cols) {
+        cols *= rows;
+        rows = 1;
+    }
+    const std::size_t blocksPerRow = (cols + REDUCTION_BLOCK - 1) / REDUCTION_BLOCK;
+    const std::size_t blocks = rows * blocksPerRow;
+    const std::size_t chunks = (blocks + CHUNK_BLOCKS - 1) / CHUNK_BLOCKS;
+
+    auto reduceChunk = [&](std::size_t chunk) {
+        Accumulator accumulator;
+        const std::size_t end = std::min(blocks, (chunk + 1) * CHUNK_BLOCKS);
+        for (std::size_t b = chunk * CHUNK_BLOCKS; b < end; ++b) {
+            const std::size_t offset = (b % blocksPerRow) * REDUCTION_BLOCK;
+            accumulator.add(block(a + (b / blocksPerRow) * rowStride + offset,
+                                  std::min(REDUCTION_BLOCK, cols - offset)));
+        }
+        return accumulator.result();
+    };
+    if (chunks == 1) {
+        return reduceChunk(0);
+    }
+
+    std::vector<double> partials(chunks);
+    std::size_t tasks = 1;
+    if (rows * cols >= REDUCTION_PARALLEL_WORK) {
+        tasks = std::min(ThreadPool::getGlobalThreadCount(), chunks);
+    }
+    if (tasks > 1) {
+        ThreadPool::global()->parallelFor(tasks, [&](std::size_t t) {
+            for (std::size_t chunk = chunks * t / tasks; chunk < chunks * (t + 1) / tasks; ++chunk) {
+                partials[chunk] = reduceChunk(chunk);
+            }
+        });
+    } else {
+        for (std::size_t chunk = 0; chunk < chunks; ++chunk) partials[chunk] = reduceChunk(chunk);
+    }
+
+    Accumulator total;
+    for (double partial : partials) total.add(partial);
+    return total.result();
+}
+
+// Евклидова норма: быстрый проход без масштабирования, а при
+// переполнении или исчезновении порядка - второй проход, в котором
+// элементы делятся на степень двойки, близкую к наибольшему модулю
+double norm(const SpanKernel& kernel, const double* a, std::size_t rows, std::size_t cols,
+            std::size_t rowStride) {
+    const SpanFunction sumSquaresSpan = kernels::sumSquares;
+    const double sumSquares = reduceBlocks<PairwiseSum>(a, rows, cols, rowStride, sumSquaresSpan);
+    if (std::isnan(sumSquares)) return sumSquares;
+    const double count = static_cast<double>(rows) * static_cast<double>(cols);
+    if (sumSquares <= std::numeric_limits<double>::max() && sumSquares >= NORM_UNDERFLOW * count) {
+        return std::sqrt(sumSquares);
+    }
+
+    const double largest = reduceBlocks<MaxOf>(a, rows, cols, rowStride, kernel.maxAbs);
+    if (largest == 0.0 || std::isinf(largest)) return largest;
+    // scalbn точен, в том числе для денормальных чисел
+    const int exponent = std::ilogb(largest);
+    const double scaledSum = reduceBlocks<PairwiseSum>(a, rows, cols, rowStride,
+                                                       [exponent](const double* span, std::size_t n) {
+        double sum = 0.0;
+        for (std::size_t k = 0; k < n; ++k) {
+            const double x = std::scalbn(span[k], -exponent);
+            sum += x * x;
+        }
+        return sum;
+    });
+    return std::scalbn(std::sqrt(scaledSum), exponent);
+}
+
+// Свёртка пустого набора: суммы и нормы равны 0, а среднего, минимума и
+// максимума у него нет
+double reduceEmpty(Reduction kind) {
+    if (kind == Reduction::Mean || kind == Reduction::Min || kind == Reduction::Max) {
+        throw std::invalid_argument("Mean, Min and Max of an empty set are undefined");
+    }
+    return 0.0;
+}
+
+double reduceWith(const SpanKernel& kernel, Reduction kind, const double* a, std::size_t rows,
+                  std::size_t cols, std::size_t rowStride) {
+    if (rows == 0 || cols == 0) return reduceEmpty(kind);
+    switch (kind) {
+        case Reduction::Sum:
+            return reduceBlocks<PairwiseSum>(a, rows, cols, rowStride, kernel.sum);
+        case Reduction::Mean:
+            return reduceBlocks<PairwiseSum>(a, rows, cols, rowStride, kernel.sum) /
+                   (static_cast<double>(rows) * static_cast<double>(cols));
+        case Reduction::SumAbs:
+            return reduceBlocks<PairwiseSum>(a, rows, cols, rowStride, kernel.sumAbs);
+        case Reduction::Norm:
+            return norm(kernel, a, rows, cols, rowStride);
+        case Reduction::MaxAbs:
+            return reduceBlocks<MaxOf>(a, rows, cols, rowStride, kernel.maxAbs);
+        case Reduction::Min:
+            return reduceBlocks<MinOf>(a, rows, cols, rowStride, kernel.min);
+        case Reduction::Max:
+            return reduceBlocks<MaxOf>(a, rows, cols, rowStride, kernel.max);
+    }
+    return 0.0;
+}
+
+// ==================== Свёртка по столбцам ====================
+
+// acc[j] = f(acc[j], row[j]) для участка столбцов
+void accumulateRow(Reduction kind, const double* row, double* acc, std::size_t n) {
+    switch (kind) {
+        case Reduction::Sum:
+        case Reduction::Mean:
+            kernels::add(acc, row, acc, n);
+            break;
+        case Reduction::SumAbs:
+            for (std::size_t j = 0; j < n; ++j) acc[j] += std::abs(row[j]);
+            break;
+        case Reduction::Norm:
+            for (std::size_t j = 0; j < n; ++j) acc[j] += row[j] * row[j];
+            break;
+        case Reduction::MaxAbs:
+            for (std::size_t j = 0; j < n; ++j) acc[j] = std::max(acc[j], std::abs(row[j]));
+            break;
+        case Reduction::Min:
+            for (std::size_t j = 0; j < n; ++j) acc[j] = std::min(acc[j], row[j]);
+            break;
+        case Reduction::Max:
+            for (std::size_t j = 0; j < n; ++j) acc[j] = std::max(acc[j], row[j]);
+            break;
+    }
+}
+
+double initialValue(Reduction kind) {
+    switch (kind) {
+        case Reduction::Min: return INFINITY_VALUE;
+        case Reduction::Max: return -INFINITY_VALUE;
+        default: return 0.0;
+    }
+}
+
+bool isSum(Reduction kind) {
+    return kind == Reduction::Sum || kind == Reduction::Mean || kind == Reduction::SumAbs ||
+           kind == Reduction::Norm;
+}
+
+// Столбцы [begin, end): суммы - группами по COLUMN_GROUP_ROWS строк и
+// попарно между группами, минимумы и максимумы - напрямую
+void reduceColumnRange(const SpanKernel& kernel, Reduction kind, const double* a, std::size_t rows,
+                       std::size_t rowStride, std::size_t begin, std::size_t end, double* out) {
+    const std::size_t width = end - begin;
+    if (!isSum(kind)) {
+        std::fill(out + begin, out + end, initialValue(kind));
+        for (std::size_t i = 0; i < rows; ++i) accumulateRow(kind, a + i * rowStride + begin, out + begin, width);
+        return;
+    }
+
+    PairwiseVectorSum total(width);
+    for (std::size_t first = 0; first < rows; first += COLUMN_GROUP_ROWS) {
+        std::vector<double> group(width, 0.0);
+        const std::size_t last = std::min(rows, first + COLUMN_GROUP_ROWS);
+        for (std::size_t i = first; i < last; ++i) accumulateRow(kind, a + i * rowStride + begin, group.data(), width);
+        total.add(std::move(group));
+    }
+    total.result(out + begin);
+
+    if (kind == Reduction::Mean) {
+        for (std::size_t j = begin; j < end; ++j) out[j] /= static_cast<double>(rows);
+    } else if (kind == Reduction::Norm) {
+        for (std::size_t j = begin; j < end; ++j) {
+            const double sumSquares = out[j];
+            if (std::isnan(sumSquares)) continue;
+            if (sumSquares <= std::numeric_limits<double>::max() &&
+                sumSquares >= NORM_UNDERFLOW * static_cast<double>(rows)) {
+                out[j] = std::sqrt(sumSquares);
+            } else {
+                // Редкий случай: столбец пересчитывается с масштабированием
+                out[j] = norm(kernel, a + j, rows, 1, rowStride);
+            }
+        }
+    }
+}
+
+} // namespace
+
+double reduce(Reduction kind, const double* a, std::size_t rows, std::size_t cols, std::size_t rowStride) {
+    return reduceWith(selectSpanKernel(), kind, a, rows, cols, rowStride);
+}
+
+void reduceRows(Reduction kind, const double* a, std::size_t rows, std::size_t cols, std::size_t rowStride,
+                double* out) {
+    const SpanKernel kernel = selectSpanKernel();
+    const std::size_t threads = ThreadPool::getGlobalThreadCount();
+    // Мало длинных строк - каждая делится между потоками внутри reduce
+    if (rows * cols < REDUCTION_PARALLEL_WORK || threads <= 1 || rows < threads) {
+        for (std::size_t i = 0; i < rows; ++i) out[i] = reduceWith(kernel, kind, a + i * rowStride, 1, cols, cols);
+        return;
+    }
+    const std::size_t tasks = threads;
+    ThreadPool::global()->parallelFor(tasks, [&](std::size_t t) {
+        for (std::size_t i = rows * t / tasks; i < rows * (t + 1) / tasks; ++i) {
+            out[i] = reduceWith(kernel, kind, a + i * rowStride, 1, cols, cols);
+        }
+    });
+}
+
+void reduceColumns(Reduction kind, const double* a, std::size_t rows, std::size_t cols, std::size_t rowStride,
+                   double* out) {
+    if (rows == 0) {
+        if (cols > 0) std::fill(out, out + cols, reduceEmpty(kind));
+        return;
+    }
+    const SpanKernel kernel = selectSpanKernel();
+    std::size_t tasks = 1;
+    if (rows * cols >= REDUCTION_PARALLEL_WORK) {
+        tasks = std::min(ThreadPool::getGlobalThreadCount(), std::max<std::size_t>(1, cols / MIN_COLS_PER_TASK));
+    }
+    if (tasks <= 1) {
+        reduceColumnRange(kernel, kind, a, rows, rowStride, 0, cols, out);
+        return;
+    }
+    // Участки кратны 8 столбцам, чтобы не делить строки кэша между потоками
+    const std::size_t units = (cols + 7) / 8;
+    ThreadPool::global()->parallelFor(tasks, [&](std::size_t t) {
+        const std::size_t begin = std::min(cols, units * t / tasks * 8);
+        const std::size_t end = std::min(cols, units * (t + 1) / tasks * 8);
+        if (begin < end) reduceColumnRange(kernel, kind, a, rows, rowStride, begin, end, out);
+    });
+}
+
+double sumStrided(const double* a, std::size_t count, std::size_t stride) {
+    PairwiseSum total;
+    for (std::size_t first = 0; first < count; first += STRIDED_BLOCK) {
+        const std::size_t last = std::min(count, first + STRIDED_BLOCK);
+        double sum = 0.0;
+        for (std::size_t k = first; k < last; ++k) sum += a[k * stride];
+        total.add(sum);
+    }
+    return total.result();
+}
+
+} // namespace kernels
@@ -0,0 +1,66 @@
+/**
+ * @file Reductions.h
+ * @brief Pairwise, overflow-safe and threaded reductions over matrix blocks
+ * @author Shchurko
+ * @date 2025
+ */
+
+#ifndef MATRIXLAB_REDUCTIONS_H
+#define MATRIXLAB_REDUCTIONS_H
+
+#include <cstddef>
+
+// Вид свёртки набора значений
+enum class Reduction {
+    Sum,     // сумма
+    Mean,    // среднее
+    SumAbs,  // сумма модулей
+    Norm,    // евклидова норма sqrt(sum x^2)
+    MaxAbs,  // наибольший модуль
+    Min,
+    Max
+};
+
+namespace kernels {
+
+// Начиная с этого числа элементов свёртка делится между потоками общего пула
+constexpr std::size_t REDUCTION_PARALLEL_WORK = 1 << 18;
+
+/**
+ * @brief Свёртка всех элементов блока rows x cols, хранимого по строкам с
+ * шагом rowStride
+ *
+ * Суммы считаются попарно: блоки по несколько сотен элементов
+ * складываются SIMD-ядром в независимые дорожки, а суммы блоков -
+ * каскадом, как разряды двоичного счётчика. Погрешность растёт как
+ * O(eps log n), а не O(eps n), при той же скорости, что и простой цикл.
+ * Разбиение на блоки и порядок сложения зависят только от размеров,
+ * поэтому результат не зависит от числа потоков.
+ *
+ * Norm считается без масштабирования и пересчитывается с
+ * масштабированием на степень двойки (как dnrm2 в LAPACK) только при
+ * переполнении или исчезновении порядка суммы квадратов: норма матрицы
+ * из элементов 1e200 или 1e-200 вычисляется без потери точности.
+ *
+ * Суммы и нормы пустого блока (rows или cols равно 0) равны 0; Mean, Min
+ * и Max для него не определены и бросают std::invalid_argument. То же
+ * относится к каждой строке в reduceRows и каждому столбцу в reduceColumns.
+ */
+double reduce(Reduction kind, const double* a, std::size_t rows, std::size_t cols, std::size_t rowStride);
+
+// out[i] - свёртка строки i (cols значений), out длины rows
+void reduceRows(Reduction kind, const double* a, std::size_t rows, std::size_t cols, std::size_t rowStride,
+                double* out);
+
+// out[j] - свёртка столбца j (rows значений), out длины cols. Строки
+// читаются подряд: частичные суммы по группам строк складываются
+// каскадом так же, как в reduce
+void reduceColumns(Reduction kind, const double* a, std::size_t rows, std::size_t cols, std::size_t rowStride,
+                   double* out);
+
+// Попарная сумма count значений, отстоящих на stride (диагональ для следа)
+double sumStrided(const double* a, std::size_t count, std::size_t stride);
+
+} // namespace kernels
+
+#endif // MATRIXLAB_REDUCTIONS_H
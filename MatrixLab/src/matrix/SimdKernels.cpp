@@ -0,0 +1,534 @@
+/**
+ * @file SimdKernels.cpp
+ * @brief Scalar, SSE2, AVX2 and AVX-512 elementwise kernels and dispatch
+ * @author Shchurko
+ * @date 2025
+ */
+
+#include "SimdKernels.h"
+#include <atomic>
+#include <cmath>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define MATRIX_SIMD_X86 1
+#include <immintrin.h>
+#define MATRIX_TARGET_SSE2 __attribute__((target("sse2")))
+#define MATRIX_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define MATRIX_TARGET_AVX512 __attribute__((target("avx512f")))
+#else
+#define MATRIX_SIMD_X86 0
+#endif
+
+namespace kernels {
+
+namespace {
+
+struct SimdTable {
+    void (*add)(const double*, const double*, double*, std::size_t);
+    void (*subtract)(const double*, const double*, double*, std::size_t);
+    void (*scale)(const double*, double, double*, std::size_t);
+    void (*addScalar)(const double*, double, double*, std::size_t);
+    double (*sumSquares)(const double*, std::size_t);
+    bool (*allWithin)(const double*, double, std::size_t);
+    bool (*allClose)(const double*, const double*, double, std::size_t);
+    double (*dot)(const double*, const double*, std::size_t);
+    void (*axpy)(double, const double*, double*, std::size_t);
+};
+
+// ==================== Скалярная реализация ====================
+void addScalarImpl(const double* a, const double* b, double* out, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) out[i] = a[i] + b[i];
+}
+
+void subtractScalarImpl(const double* a, const double* b, double* out, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) out[i] = a[i] - b[i];
+}
+
+void scaleScalarImpl(const double* a, double factor, double* out, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) out[i] = a[i] * factor;
+}
+
+void shiftScalarImpl(const double* a, double value, double* out, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) out[i] = a[i] + value;
+}
+
+double sumSquaresScalarImpl(const double* a, std::size_t count) {
+    double sum = 0.0;
+    for (std::size_t i = 0; i < count; ++i) sum += a[i] * a[i];
+    return sum;
+}
+
+bool allWithinScalarImpl(const double* a, double tolerance, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        if (std::abs(a[i]) > tolerance) return false;
+    }
+    return true;
+}
+
+bool allCloseScalarImpl(const double* a, const double* b, double tolerance, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        if (std::abs(a[i] - b[i]) > tolerance) return false;
+    }
+    return true;
+}
+
+double dotScalarImpl(const double* a, const double* b, std::size_t count) {
+    double sum = 0.0;
+    for (std::size_t i = 0; i < count; ++i) sum += a[i] * b[i];
+    return sum;
+}
+
+void axpyScalarImpl(double factor, const double* a, double* out, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) out[i] += factor * a[i];
+}
+
+const SimdTable SCALAR_TABLE = {
+        addScalarImpl, subtractScalarImpl, scaleScalarImpl, shiftScalarImpl,
+        sumSquaresScalarImpl, allWithinScalarImpl, allCloseScalarImpl,
+        dotScalarImpl, axpyScalarImpl
+};
+
+#if MATRIX_SIMD_X86
+
+// ==================== SSE2: 2 double на регистр ====================
+MATRIX_TARGET_SSE2 void addSse2(const double* a, const double* b, double* out, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        _mm_storeu_pd(out + i, _mm_add_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+    }
+    for (; i < count; ++i) out[i] = a[i] + b[i];
+}
+
+MATRIX_TARGET_SSE2 void subtractSse2(const double* a, const double* b, double* out, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        _mm_storeu_pd(out + i, _mm_sub_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+    }
+    for (; i < count; ++i) out[i] = a[i] - b[i];
+}
+
+MATRIX_TARGET_SSE2 void scaleSse2(const double* a, double factor, double* out, std::size_t count) {
+    __m128d vFactor = _mm_set1_pd(factor);
+    std::size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        _mm_storeu_pd(out + i, _mm_mul_pd(_mm_loadu_pd(a + i), vFactor));
+    }
+    for (; i < count; ++i) out[i] = a[i] * factor;
+}
+
+MATRIX_TARGET_SSE2 void shiftSse2(const double* a, double value, double* out, std::size_t count) {
+    __m128d vValue = _mm_set1_pd(value);
+    std::size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        _mm_storeu_pd(out + i, _mm_add_pd(_mm_loadu_pd(a + i), vValue));
+    }
+    for (; i < count; ++i) out[i] = a[i] + value;
+}
+
+MATRIX_TARGET_SSE2 double sumSquaresSse2(const double* a, std::size_t count) {
+    __m128d sum0 = _mm_setzero_pd();
+    __m128d sum1 = _mm_setzero_pd();
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128d x0 = _mm_loadu_pd(a + i);
+        __m128d x1 = _mm_loadu_pd(a + i + 2);
+        sum0 = _mm_add_pd(sum0, _mm_mul_pd(x0, x0));
+        sum1 = _mm_add_pd(sum1, _mm_mul_pd(x1, x1));
+    }
+    double lanes[2];
+    _mm_storeu_pd(lanes, _mm_add_pd(sum0, sum1));
+    double sum = lanes[0] + lanes[1];
+    for (; i < count; ++i) sum += a[i] * a[i];
+    return sum;
+}
+
+MATRIX_TARGET_SSE2 bool allWithinSse2(const double* a, double tolerance, std::size_t count) {
+    const __m128d absMask = _mm_castsi128_pd(_mm_set1_epi64x(0x7fffffffffffffffLL));
+    __m128d vTolerance = _mm_set1_pd(tolerance);
+    std::size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        __m128d magnitude = _mm_and_pd(_mm_loadu_pd(a + i), absMask);
+        if (_mm_movemask_pd(_mm_cmpgt_pd(magnitude, vTolerance)) != 0) return false;
+    }
+    return allWithinScalarImpl(a + i, tolerance, count - i);
+}
+
+MATRIX_TARGET_SSE2 bool allCloseSse2(const double* a, const double* b, double tolerance, std::size_t count) {
+    const __m128d absMask = _mm_castsi128_pd(_mm_set1_epi64x(0x7fffffffffffffffLL));
+    __m128d vTolerance = _mm_set1_pd(tolerance);
+    std::size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        __m128d difference = _mm_sub_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i));
+        __m128d magnitude = _mm_and_pd(difference, absMask);
+        if (_mm_movemask_pd(_mm_cmpgt_pd(magnitude, vTolerance)) != 0) return false;
+    }
+    return allCloseScalarImpl(a + i, b + i, tolerance, count - i);
+}
+
+MATRIX_TARGET_SSE2 double dotSse2(const double* a, const double* b, std::size_t count) {
+    __m128d sum0 = _mm_setzero_pd();
+    __m128d sum1 = _mm_setzero_pd();
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        sum0 = _mm_add_pd(sum0, _mm_mul_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+        sum1 = _mm_add_pd(sum1, _mm_mul_pd(_mm_loadu_pd(a + i + 2), _mm_loadu_pd(b + i + 2)));
+    }
+    double lanes[2];
+    _mm_storeu_pd(lanes, _mm_add_pd(sum0, sum1));
+    double sum = lanes[0] + lanes[1];
+    for (; i < count; ++i) sum += a[i] * b[i];
+    return sum;
+}
+
+MATRIX_TARGET_SSE2 void axpySse2(double factor, const double* a, double* out, std::size_t count) {
+    __m128d vFactor = _mm_set1_pd(factor);
+    std::size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        _mm_storeu_pd(out + i, _mm_add_pd(_mm_loadu_pd(out + i), _mm_mul_pd(_mm_loadu_pd(a + i), vFactor)));
+    }
+    for (; i < count; ++i) out[i] += factor * a[i];
+}
+
+const SimdTable SSE2_TABLE = {
+        addSse2, subtractSse2, scaleSse2, shiftSse2,
+        sumSquaresSse2, allWithinSse2, allCloseSse2,
+        dotSse2, axpySse2
+};
+
+// ==================== AVX2: 4 double на регистр ====================
+MATRIX_TARGET_AVX2 void addAvx2(const double* a, const double* b, double* out, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm256_storeu_pd(out + i, _mm256_add_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+    }
+    for (; i < count; ++i) out[i] = a[i] + b[i];
+}
+
+MATRIX_TARGET_AVX2 void subtractAvx2(const double* a, const double* b, double* out, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm256_storeu_pd(out + i, _mm256_sub_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+    }
+    for (; i < count; ++i) out[i] = a[i] - b[i];
+}
+
+MATRIX_TARGET_AVX2 void scaleAvx2(const double* a, double factor, double* out, std::size_t count) {
+    __m256d vFactor = _mm256_set1_pd(factor);
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm256_storeu_pd(out + i, _mm256_mul_pd(_mm256_loadu_pd(a + i), vFactor));
+    }
+    for (; i < count; ++i) out[i] = a[i] * factor;
+}
+
+MATRIX_TARGET_AVX2 void shiftAvx2(const double* a, double value, double* out, std::size_t count) {
+    __m256d vValue = _mm256_set1_pd(value);
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm256_storeu_pd(out + i, _mm256_add_pd(_mm256_loadu_pd(a + i), vValue));
+    }
+    for (; i < count; ++i) out[i] = a[i] + value;
+}
+
+MATRIX_TARGET_AVX2 double sumSquaresAvx2(const double* a, std::size_t count) {
+    __m256d sum0 = _mm256_setzero_pd();
+    __m256d sum1 = _mm256_setzero_pd();
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256d x0 = _mm256_loadu_pd(a + i);
+        __m256d x1 = _mm256_loadu_pd(a + i + 4);
+        sum0 = _mm256_fmadd_pd(x0, x0, sum0);
+        sum1 = _mm256_fmadd_pd(x1, x1, sum1);
+    }
+    double lanes[4];
+    _mm256_storeu_pd(lanes, _mm256_add_pd(sum0, sum1));
+    double sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    for (; i < count; ++i) sum += a[i] * a[i];
+    return sum;
+}
+
+MATRIX_TARGET_AVX2 bool allWithinAvx2(const double* a, double tolerance, std::size_t count) {
+    const __m256d absMask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7fffffffffffffffLL));
+    __m256d vTolerance = _mm256_set1_pd(tolerance);
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256d magnitude = _mm256_and_pd(_mm256_loadu_pd(a + i), absMask);
+        if (_mm256_movemask_pd(_mm256_cmp_pd(magnitude, vTolerance, _CMP_GT_OQ)) != 0) return false;
+    }
+    return allWithinScalarImpl(a + i, tolerance, count - i);
+}
+
+MATRIX_TARGET_AVX2 bool allCloseAvx2(const double* a, const double* b, double tolerance, std::size_t count) {
+    const __m256d absMask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7fffffffffffffffLL));
+    __m256d vTolerance = _mm256_set1_pd(tolerance);
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256d difference = _mm256_sub_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i));
+        __m256d magnitude = _mm256_and_pd(difference, absMask);
+        if (_mm256_movemask_pd(_mm256_cmp_pd(magnitude, vTolerance, _CMP_GT_OQ)) != 0) return false;
+    }
+    return allCloseScalarImpl(a + i, b + i, tolerance, count - i);
+}
+
+MATRIX_TARGET_AVX2 double dotAvx2(const double* a, const double* b, std::size_t count) {
+    __m256d sum0 = _mm256_setzero_pd();
+    __m256d sum1 = _mm256_setzero_pd();
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        sum0 = _mm256_fmadd_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i), sum0);
+        sum1 = _mm256_fmadd_pd(_mm256_loadu_pd(a + i + 4), _mm256_loadu_pd(b + i + 4), sum1);
+    }
+    double lanes[4];
+    _mm256_storeu_pd(lanes, _mm256_add_pd(sum0, sum1));
+    double sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    for (; i < count; ++i) sum += a[i] * b[i];
+    return sum;
+}
+
+MATRIX_TARGET_AVX2 void axpyAvx2(double factor, const double* a, double* out, std::size_t count) {
+    __m256d vFactor = _mm256_set1_pd(factor);
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm256_storeu_pd(out + i, _mm256_fmadd_pd(_mm256_loadu_pd(a + i), vFactor, _mm256_loadu_pd(out + i)));
+    }
+    for (; i < count; ++i) out[i] += factor * a[i];
+}
+
+const SimdTable AVX2_TABLE = {
+        addAvx2, subtractAvx2, scaleAvx2, shiftAvx2,
+        sumSquaresAvx2, allWithinAvx2, allCloseAvx2,
+        dotAvx2, axpyAvx2
+};
+
+// ==================== AVX-512: 8 double на регистр, хвост по маске ====================
+MATRIX_TARGET_AVX512 __mmask8 tailMask(std::size_t remaining) {
+    return static_cast<__mmask8>((1u << remaining) - 1u);
+}
+
+MATRIX_TARGET_AVX512 void addAvx512(const double* a, const double* b, double* out, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm512_storeu_pd(out + i, _mm512_add_pd(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i)));
+    }
+    if (i < count) {
+        __mmask8 mask = tailMask(count - i);
+        __m512d sum = _mm512_add_pd(_mm512_maskz_loadu_pd(mask, a + i), _mm512_maskz_loadu_pd(mask, b + i));
+        _mm512_mask_storeu_pd(out + i, mask, sum);
+    }
+}
+
+MATRIX_TARGET_AVX512 void subtractAvx512(const double* a, const double* b, double* out, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm512_storeu_pd(out + i, _mm512_sub_pd(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i)));
+    }
+    if (i < count) {
+        __mmask8 mask = tailMask(count - i);
+        __m512d difference = _mm512_sub_pd(_mm512_maskz_loadu_pd(mask, a + i), _mm512_maskz_loadu_pd(mask, b + i));
+        _mm512_mask_storeu_pd(out + i, mask, difference);
+    }
+}
+
+MATRIX_TARGET_AVX512 void scaleAvx512(const double* a, double factor, double* out, std::size_t count) {
+    __m512d vFactor = _mm512_set1_pd(factor);
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm512_storeu_pd(out + i, _mm512_mul_pd(_mm512_loadu_pd(a + i), vFactor));
+    }
+    if (i < count) {
+        __mmask8 mask = tailMask(count - i);
+        _mm512_mask_storeu_pd(out + i, mask, _mm512_mul_pd(_mm512_maskz_loadu_pd(mask, a + i), vFactor));
+    }
+}
+
+MATRIX_TARGET_AVX512 void shiftAvx512(const double* a, double value, double* out, std::size_t count) {
+    __m512d vValue = _mm512_set1_pd(value);
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm512_storeu_pd(out + i, _mm512_add_pd(_mm512_loadu_pd(a + i), vValue));
+    }
+    if (i < count) {
+        __mmask8 mask = tailMask(count - i);
+        _mm512_mask_storeu_pd(out + i, mask, _mm512_add_pd(_mm512_maskz_loadu_pd(mask, a + i), vValue));
+    }
+}
+
+MATRIX_TARGET_AVX512 double sumSquaresAvx512(const double* a, std::size_t count) {
+    __m512d sum0 = _mm512_setzero_pd();
+    __m512d sum1 = _mm512_setzero_pd();
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m512d x0 = _mm512_loadu_pd(a + i);
+        __m512d x1 = _mm512_loadu_pd(a + i + 8);
+        sum0 = _mm512_fmadd_pd(x0, x0, sum0);
+        sum1 = _mm512_fmadd_pd(x1, x1, sum1);
+    }
+    for (; i < count; i += 8) {
+        __mmask8 mask = tailMask(count - i < 8 ? count - i : 8);
+        __m512d x = _mm512_maskz_loadu_pd(mask, a + i);
+        sum0 = _mm512_fmadd_pd(x, x, sum0);
+    }
+    return _mm512_reduce_add_pd(_mm512_add_pd(sum0, sum1));
+}
+
+MATRIX_TARGET_AVX512 bool allWithinAvx512(const double* a, double tolerance, std::size_t count) {
+    __m512d vTolerance = _mm512_set1_pd(tolerance);
+    for (std::size_t i = 0; i < count; i += 8) {
+        __mmask8 mask = tailMask(count - i < 8 ? count - i : 8);
+        __m512d magnitude = _mm512_abs_pd(_mm512_maskz_loadu_pd(mask, a + i));
+        if (_mm512_mask_cmp_pd_mask(mask, magnitude, vTolerance, _CMP_GT_OQ) != 0) return false;
+    }
+    return true;
+}
+
+MATRIX_TARGET_AVX512 bool allCloseAvx512(const double* a, const double* b, double tolerance, std::size_t count) {
+    __m512d vTolerance = _mm512_set1_pd(tolerance);
+    for (std::size_t i = 0; i < count; i += 8) {
+        __mmask8 mask = tailMask(count - i < 8 ? count - i : 8);
+        __m512d difference = _mm512_sub_pd(_mm512_maskz_loadu_pd(mask, a + i), _mm512_maskz_loadu_pd(mask, b + i));
+        if (_mm512_mask_cmp_pd_mask(mask, _mm512_abs_pd(difference), vTolerance, _CMP_GT_OQ) != 0) return false;
+    }
+    return true;
+}
+
+MATRIX_TARGET_AVX512 double dotAvx512(const double* a, const double* b, std::size_t count) {
+    __m512d sum0 = _mm512_setzero_pd();
+    __m512d sum1 = _mm512_setzero_pd();
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        sum0 = _mm512_fmadd_pd(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i), sum0);
+        sum1 = _mm512_fmadd_pd(_mm512_loadu_pd(a + i + 8), _mm512_loadu_pd(b + i + 8), sum1);
+    }
+    for (; i < count; i += 8) {
+        __mmask8 mask = tailMask(count - i < 8 ? count - i : 8);
+        sum0 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, a + i), _mm512_maskz_loadu_pd(mask, b + i), sum0);
+    }
+    return _mm512_reduce_add_pd(_mm512_add_pd(sum0, sum1));
+}
+
+MATRIX_TARGET_AVX512 void axpyAvx512(double factor, const double* a, double* out, std::size_t count) {
+    __m512d vFactor = _mm512_set1_pd(factor);
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm512_storeu_pd(out + i, _mm512_fmadd_pd(_mm512_loadu_pd(a + i), vFactor, _mm512_loadu_pd(out + i)));
+    }
+    if (i < count) {
+        __mmask8 mask = tailMask(count - i);
+        __m512d result = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, a + i), vFactor,
+                                         _mm512_maskz_loadu_pd(mask, out + i));
+        _mm512_mask_storeu_pd(out + i, mask, result);
+    }
+}
+
+const SimdTable AVX512_TABLE = {
+        addAvx512, subtractAvx512, scaleAvx512, shiftAvx512,
+        sumSquaresAvx512, allWithinAvx512, allCloseAvx512,
+        dotAvx512, axpyAvx512
+};
+
+#endif // MATRIX_SIMD_X86
+
+const SimdTable* tableFor(SimdLevel level) {
+#if MATRIX_SIMD_X86
+    switch (level) {
+        case SimdLevel::AVX512: return &AVX512_TABLE;
+        case SimdLevel::AVX2: return &AVX2_TABLE;
+        case SimdLevel::SSE2: return &SSE2_TABLE;
+        case SimdLevel::Scalar: break;
+    }
+#else
+    (void)level;
+#endif
+    return &SCALAR_TABLE;
+}
+
+struct ActiveDispatch {
+    std::atomic<SimdLevel> level;
+    std::atomic<const SimdTable*> table;
+
+    ActiveDispatch() : level(detectSimdLevel()), table(tableFor(level.load())) {}
+};
+
+ActiveDispatch& active() {
+    static ActiveDispatch dispatch;
+    return dispatch;
+}
+
+const SimdTable& table() {
+    return *active().table.load(std::memory_order_relaxed);
+}
+
+} // namespace
+
+SimdLevel detectSimdLevel() {
+#if MATRIX_SIMD_X86
+    // __builtin_cpu_supports читает CPUID и учитывает, сохраняет ли ОС
+    // расширенные регистры (XGETBV)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return SimdLevel::AVX512;
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return SimdLevel::AVX2;
+    if (__builtin_cpu_supports("sse2")) return SimdLevel::SSE2;
+#endif
+    return SimdLevel::Scalar;
+}
+
+SimdLevel getSimdLevel() {
+    return active().level.load(std::memory_order_relaxed);
+}
+
+void setSimdLevel(SimdLevel level) {
+    SimdLevel supported = detectSimdLevel();
+    if (static_cast<int>(level) > static_cast<int>(supported)) {
+        level = supported;
+    }
+    active().level.store(level, std::memory_order_relaxed);
+    active().table.store(tableFor(level), std::memory_order_relaxed);
+}
+
+const char* simdLevelName(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::Scalar: return "scalar";
+        case SimdLevel::SSE2: return "sse2";
+        case SimdLevel::AVX2: return "avx2";
+        case SimdLevel::AVX512: return "avx512";
+    }
+    return "unknown";
+}
+
+void add(const double* a, const double* b, double* out, std::size_t count) {
+    table().add(a, b, out, count);
+}
+
+void subtract(const double* a, const double* b, double* out, std::size_t count) {
+    table().subtract(a, b, out, count);
+}
+
+void scale(const double* a, double factor, double* out, std::size_t count) {
+    table().scale(a, factor, out, count);
+}
+
+void addScalar(const double* a, double value, double* out, std::size_t count) {
+    table().addScalar(a, value, out, count);
+}
+
+double sumSquares(const double* a, std::size_t count) {
+    return table().sumSquares(a, count);
+}
+
+bool allWithin(const double* a, double tolerance, std::size_t count) {
+    return table().allWithin(a, tolerance, count);
+}
+
+bool allClose(const double* a, const double* b, double tolerance, std::size_t count) {
+    return table().allClose(a, b, tolerance, count);
+}
+
+double dot(const double* a, const double* b, std::size_t count) {
+    return table().dot(a, b, count);
+}
+
+void axpy(double factor, const double* a, double* out, std::size_t count) {
+    table().axpy(factor, a, out, count);
+}
+
+} // namespace kernels
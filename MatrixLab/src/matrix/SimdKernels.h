@@ -0,0 +1,77 @@
+/**
+ * @file SimdKernels.h
+ * @brief Elementwise vector kernels with runtime SIMD dispatch
+ * @author Shchurko
+ * @date 2025
+ */
+
+#ifndef MATRIXLAB_SIMDKERNELS_H
+#define MATRIXLAB_SIMDKERNELS_H
+
+#include <cstddef>
+
+namespace kernels {
+
+// Набор инструкций, которым пользуются ядра. Уровни упорядочены по ширине
+enum class SimdLevel {
+    Scalar,
+    SSE2,
+    AVX2,
+    AVX512
+};
+
+// Лучший уровень, поддерживаемый процессором и ОС (по CPUID)
+SimdLevel detectSimdLevel();
+
+// Активный уровень; по умолчанию равен detectSimdLevel()
+SimdLevel getSimdLevel();
+
+// Принудительный выбор уровня (для тестов и сравнения); уровень выше
+// поддерживаемого понижается до detectSimdLevel()
+void setSimdLevel(SimdLevel level);
+
+const char* simdLevelName(SimdLevel level);
+
+// out[i] = a[i] + b[i]
+void add(const double* a, const double* b, double* out, std::size_t count);
+
+// out[i] = a[i] - b[i]
+void subtract(const double* a, const double* b, double* out, std::size_t count);
+
+// out[i] = a[i] * factor
+void scale(const double* a, double factor, double* out, std::size_t count);
+
+// out[i] = a[i] + value
+void addScalar(const double* a, double value, double* out, std::size_t count);
+
+// Сумма квадратов элементов
+double sumSquares(const double* a, std::size_t count);
+
+// true, если |a[i]| <= tolerance для всех i; выходит на первом нарушении
+bool allWithin(const double* a, double tolerance, std::size_t count);
+
+// true, если |a[i] - b[i]| <= tolerance для всех i; выходит на первом нарушении
+bool allClose(const double* a, const double* b, double tolerance, std::size_t count);
+
+// Скалярное произведение a и b
+double dot(const double* a, const double* b, std::size_t count);
+
+// out[i] += factor * a[i]
+void axpy(double factor, const double* a, double* out, std::size_t count);
+
+// Те же ядра для float (SimdKernelsFloat.cpp): вдвое больше элементов на регистр
+void add(const float* a, const float* b, float* out, std::size_t count);
+void subtract(const float* a, const float* b, float* out, std::size_t count);
+void scale(const float* a, float factor, float* out, std::size_t count);
+void addScalar(const float* a, float value, float* out, std::size_t count);
+// Сумма квадратов накапливается в double
+double sumSquares(const float* a, std::size_t count);
+bool allWithin(const float* a, float tolerance, std::size_t count);
+bool allClose(const float* a, const float* b, float tolerance, std::size_t count);
+
+// out[i] += factor * a[i]
+void axpy(float factor, const float* a, float* out, std::size_t count);
+
+} // namespace kernels
+
+#endif // MATRIXLAB_SIMDKERNELS_H
@@ -0,0 +1,412 @@
+/**
+ * @file SimdKernelsFloat.cpp
+ * @brief Scalar, SSE2, AVX2 and AVX-512 single-precision elementwise kernels
+ * @author Shchurko
+ * @date 2025
+ */
+
+#include "SimdKernels.h"
+#include <cmath>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define MATRIX_SIMD_X86 1
+#include <immintrin.h>
+#define MATRIX_TARGET_SSE2 __attribute__((target("sse2")))
+#define MATRIX_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define MATRIX_TARGET_AVX512 __attribute__((target("avx512f")))
+#else
+#define MATRIX_SIMD_X86 0
+#endif
+
+namespace kernels {
+
+namespace {
+
+struct FloatSimdTable {
+    void (*add)(const float*, const float*, float*, std::size_t);
+    void (*subtract)(const float*, const float*, float*, std::size_t);
+    void (*scale)(const float*, float, float*, std::size_t);
+    void (*addScalar)(const float*, float, float*, std::size_t);
+    void (*axpy)(float, const float*, float*, std::size_t);
+    double (*sumSquares)(const float*, std::size_t);
+    bool (*allWithin)(const float*, float, std::size_t);
+    bool (*allClose)(const float*, const float*, float, std::size_t);
+};
+
+// ==================== Скалярная реализация ====================
+void addScalarImpl(const float* a, const float* b, float* out, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) out[i] = a[i] + b[i];
+}
+
+void subtractScalarImpl(const float* a, const float* b, float* out, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) out[i] = a[i] - b[i];
+}
+
+void scaleScalarImpl(const float* a, float factor, float* out, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) out[i] = a[i] * factor;
+}
+
+void shiftScalarImpl(const float* a, float value, float* out, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) out[i] = a[i] + value;
+}
+
+void axpyScalarImpl(float factor, const float* a, float* out, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) out[i] += factor * a[i];
+}
+
+double sumSquaresScalarImpl(const float* a, std::size_t count) {
+    double sum = 0.0;
+    for (std::size_t i = 0; i < count; ++i) sum += static_cast<double>(a[i]) * a[i];
+    return sum;
+}
+
+bool allWithinScalarImpl(const float* a, float tolerance, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        if (std::abs(a[i]) > tolerance) return false;
+    }
+    return true;
+}
+
+bool allCloseScalarImpl(const float* a, const float* b, float tolerance, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        if (std::abs(a[i] - b[i]) > tolerance) return false;
+    }
+    return true;
+}
+
+const FloatSimdTable SCALAR_TABLE = {
+        addScalarImpl, subtractScalarImpl, scaleScalarImpl, shiftScalarImpl,
+        axpyScalarImpl, sumSquaresScalarImpl, allWithinScalarImpl, allCloseScalarImpl
+};
+
+#if MATRIX_SIMD_X86
+
+// ==================== SSE2: 4 float на регистр ====================
+MATRIX_TARGET_SSE2 void addSse2(const float* a, const float* b, float* out, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(out + i, _mm_add_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+    }
+    for (; i < count; ++i) out[i] = a[i] + b[i];
+}
+
+MATRIX_TARGET_SSE2 void subtractSse2(const float* a, const float* b, float* out, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(out + i, _mm_sub_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+    }
+    for (; i < count; ++i) out[i] = a[i] - b[i];
+}
+
+MATRIX_TARGET_SSE2 void scaleSse2(const float* a, float factor, float* out, std::size_t count) {
+    __m128 vFactor = _mm_set1_ps(factor);
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(out + i, _mm_mul_ps(_mm_loadu_ps(a + i), vFactor));
+    }
+    for (; i < count; ++i) out[i] = a[i] * factor;
+}
+
+MATRIX_TARGET_SSE2 void shiftSse2(const float* a, float value, float* out, std::size_t count) {
+    __m128 vValue = _mm_set1_ps(value);
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(out + i, _mm_add_ps(_mm_loadu_ps(a + i), vValue));
+    }
+    for (; i < count; ++i) out[i] = a[i] + value;
+}
+
+MATRIX_TARGET_SSE2 void axpySse2(float factor, const float* a, float* out, std::size_t count) {
+    __m128 vFactor = _mm_set1_ps(factor);
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(out + i, _mm_add_ps(_mm_loadu_ps(out + i), _mm_mul_ps(_mm_loadu_ps(a + i), vFactor)));
+    }
+    for (; i < count; ++i) out[i] += factor * a[i];
+}
+
+// Квадраты накапливаются в double: сумма по большой матрице не теряет точность
+MATRIX_TARGET_SSE2 double sumSquaresSse2(const float* a, std::size_t count) {
+    __m128d sum0 = _mm_setzero_pd();
+    __m128d sum1 = _mm_setzero_pd();
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 x = _mm_loadu_ps(a + i);
+        __m128d low = _mm_cvtps_pd(x);
+        __m128d high = _mm_cvtps_pd(_mm_movehl_ps(x, x));
+        sum0 = _mm_add_pd(sum0, _mm_mul_pd(low, low));
+        sum1 = _mm_add_pd(sum1, _mm_mul_pd(high, high));
+    }
+    double lanes[2];
+    _mm_storeu_pd(lanes, _mm_add_pd(sum0, sum1));
+    return lanes[0] + lanes[1] + sumSquaresScalarImpl(a + i, count - i);
+}
+
+MATRIX_TARGET_SSE2 bool allWithinSse2(const float* a, float tolerance, std::size_t count) {
+    const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+    __m128 vTolerance = _mm_set1_ps(tolerance);
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 magnitude = _mm_and_ps(_mm_loadu_ps(a + i), absMask);
+        if (_mm_movemask_ps(_mm_cmpgt_ps(magnitude, vTolerance)) != 0) return false;
+    }
+    return allWithinScalarImpl(a + i, tolerance, count - i);
+}
+
+MATRIX_TARGET_SSE2 bool allCloseSse2(const float* a, const float* b, float tolerance, std::size_t count) {
+    const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+    __m128 vTolerance = _mm_set1_ps(tolerance);
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 magnitude = _mm_and_ps(_mm_sub_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)), absMask);
+        if (_mm_movemask_ps(_mm_cmpgt_ps(magnitude, vTolerance)) != 0) return false;
+    }
+    return allCloseScalarImpl(a + i, b + i, tolerance, count - i);
+}
+
+const FloatSimdTable SSE2_TABLE = {
+        addSse2, subtractSse2, scaleSse2, shiftSse2,
+        axpySse2, sumSquaresSse2, allWithinSse2, allCloseSse2
+};
+
+// ==================== AVX2: 8 float на регистр ====================
+MATRIX_TARGET_AVX2 void addAvx2(const float* a, const float* b, float* out, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+    }
+    for (; i < count; ++i) out[i] = a[i] + b[i];
+}
+
+MATRIX_TARGET_AVX2 void subtractAvx2(const float* a, const float* b, float* out, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_ps(out + i, _mm256_sub_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+    }
+    for (; i < count; ++i) out[i] = a[i] - b[i];
+}
+
+MATRIX_TARGET_AVX2 void scaleAvx2(const float* a, float factor, float* out, std::size_t count) {
+    __m256 vFactor = _mm256_set1_ps(factor);
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_loadu_ps(a + i), vFactor));
+    }
+    for (; i < count; ++i) out[i] = a[i] * factor;
+}
+
+MATRIX_TARGET_AVX2 void shiftAvx2(const float* a, float value, float* out, std::size_t count) {
+    __m256 vValue = _mm256_set1_ps(value);
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_loadu_ps(a + i), vValue));
+    }
+    for (; i < count; ++i) out[i] = a[i] + value;
+}
+
+MATRIX_TARGET_AVX2 void axpyAvx2(float factor, const float* a, float* out, std::size_t count) {
+    __m256 vFactor = _mm256_set1_ps(factor);
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_ps(out + i, _mm256_fmadd_ps(_mm256_loadu_ps(a + i), vFactor, _mm256_loadu_ps(out + i)));
+    }
+    for (; i < count; ++i) out[i] += factor * a[i];
+}
+
+MATRIX_TARGET_AVX2 double sumSquaresAvx2(const float* a, std::size_t count) {
+    __m256d sum0 = _mm256_setzero_pd();
+    __m256d sum1 = _mm256_setzero_pd();
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256d x0 = _mm256_cvtps_pd(_mm_loadu_ps(a + i));
+        __m256d x1 = _mm256_cvtps_pd(_mm_loadu_ps(a + i + 4));
+        sum0 = _mm256_fmadd_pd(x0, x0, sum0);
+        sum1 = _mm256_fmadd_pd(x1, x1, sum1);
+    }
+    double lanes[4];
+    _mm256_storeu_pd(lanes, _mm256_add_pd(sum0, sum1));
+    return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]) + sumSquaresScalarImpl(a + i, count - i);
+}
+
+MATRIX_TARGET_AVX2 bool allWithinAvx2(const float* a, float tolerance, std::size_t count) {
+    const __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+    __m256 vTolerance = _mm256_set1_ps(tolerance);
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 magnitude = _mm256_and_ps(_mm256_loadu_ps(a + i), absMask);
+        if (_mm256_movemask_ps(_mm256_cmp_ps(magnitude, vTolerance, _CMP_GT_OQ)) != 0) return false;
+    }
+    return allWithinScalarImpl(a + i, tolerance, count - i);
+}
+
+MATRIX_TARGET_AVX2 bool allCloseAvx2(const float* a, const float* b, float tolerance, std::size_t count) {
+    const __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+    __m256 vTolerance = _mm256_set1_ps(tolerance);
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 magnitude = _mm256_and_ps(_mm256_sub_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)), absMask);
+        if (_mm256_movemask_ps(_mm256_cmp_ps(magnitude, vTolerance, _CMP_GT_OQ)) != 0) return false;
+    }
+    return allCloseScalarImpl(a + i, b + i, tolerance, count - i);
+}
+
+const FloatSimdTable AVX2_TABLE = {
+        addAvx2, subtractAvx2, scaleAvx2, shiftAvx2,
+        axpyAvx2, sumSquaresAvx2, allWithinAvx2, allCloseAvx2
+};
+
+// ==================== AVX-512: 16 float на регистр, хвост по маске ====================
+MATRIX_TARGET_AVX512 __mmask16 tailMask(std::size_t remaining) {
+    return static_cast<__mmask16>((1u << remaining) - 1u);
+}
+
+MATRIX_TARGET_AVX512 void addAvx512(const float* a, const float* b, float* out, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        _mm512_storeu_ps(out + i, _mm512_add_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i)));
+    }
+    if (i < count) {
+        __mmask16 mask = tailMask(count - i);
+        __m512 sum = _mm512_add_ps(_mm512_maskz_loadu_ps(mask, a + i), _mm512_maskz_loadu_ps(mask, b + i));
+        _mm512_mask_storeu_ps(out + i, mask, sum);
+    }
+}
+
+MATRIX_TARGET_AVX512 void subtractAvx512(const float* a, const float* b, float* out, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        _mm512_storeu_ps(out + i, _mm512_sub_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i)));
+    }
+    if (i < count) {
+        __mmask16 mask = tailMask(count - i);
+        __m512 difference = _mm512_sub_ps(_mm512_maskz_loadu_ps(mask, a + i), _mm512_maskz_loadu_ps(mask, b + i));
+        _mm512_mask_storeu_ps(out + i, mask, difference);
+    }
+}
+
+MATRIX_TARGET_AVX512 void scaleAvx512(const float* a, float factor, float* out, std::size_t count) {
+    __m512 vFactor = _mm512_set1_ps(factor);
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        _mm512_storeu_ps(out + i, _mm512_mul_ps(_mm512_loadu_ps(a + i), vFactor));
+    }
+    if (i < count) {
+        __mmask16 mask = tailMask(count - i);
+        _mm512_mask_storeu_ps(out + i, mask, _mm512_mul_ps(_mm512_maskz_loadu_ps(mask, a + i), vFactor));
+    }
+}
+
+MATRIX_TARGET_AVX512 void shiftAvx512(const float* a, float value, float* out, std::size_t count) {
+    __m512 vValue = _mm512_set1_ps(value);
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        _mm512_storeu_ps(out + i, _mm512_add_ps(_mm512_loadu_ps(a + i), vValue));
+    }
+    if (i < count) {
+        __mmask16 mask = tailMask(count - i);
+        _mm512_mask_storeu_ps(out + i, mask, _mm512_add_ps(_mm512_maskz_loadu_ps(mask, a + i), vValue));
+    }
+}
+
+MATRIX_TARGET_AVX512 void axpyAvx512(float factor, const float* a, float* out, std::size_t count) {
+    __m512 vFactor = _mm512_set1_ps(factor);
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        _mm512_storeu_ps(out + i, _mm512_fmadd_ps(_mm512_loadu_ps(a + i), vFactor, _mm512_loadu_ps(out + i)));
+    }
+    if (i < count) {
+        __mmask16 mask = tailMask(count - i);
+        __m512 updated = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, a + i), vFactor,
+                                         _mm512_maskz_loadu_ps(mask, out + i));
+        _mm512_mask_storeu_ps(out + i, mask, updated);
+    }
+}
+
+MATRIX_TARGET_AVX512 double sumSquaresAvx512(const float* a, std::size_t count) {
+    __m512d sum0 = _mm512_setzero_pd();
+    __m512d sum1 = _mm512_setzero_pd();
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m512d x0 = _mm512_cvtps_pd(_mm256_loadu_ps(a + i));
+        __m512d x1 = _mm512_cvtps_pd(_mm256_loadu_ps(a + i + 8));
+        sum0 = _mm512_fmadd_pd(x0, x0, sum0);
+        sum1 = _mm512_fmadd_pd(x1, x1, sum1);
+    }
+    return _mm512_reduce_add_pd(_mm512_add_pd(sum0, sum1)) + sumSquaresScalarImpl(a + i, count - i);
+}
+
+MATRIX_TARGET_AVX512 bool allWithinAvx512(const float* a, float tolerance, std::size_t count) {
+    __m512 vTolerance = _mm512_set1_ps(tolerance);
+    for (std::size_t i = 0; i < count; i += 16) {
+        __mmask16 mask = tailMask(count - i < 16 ? count - i : 16);
+        __m512 magnitude = _mm512_abs_ps(_mm512_maskz_loadu_ps(mask, a + i));
+        if (_mm512_mask_cmp_ps_mask(mask, magnitude, vTolerance, _CMP_GT_OQ) != 0) return false;
+    }
+    return true;
+}
+
+MATRIX_TARGET_AVX512 bool allCloseAvx512(const float* a, const float* b, float tolerance, std::size_t count) {
+    __m512 vTolerance = _mm512_set1_ps(tolerance);
+    for (std::size_t i = 0; i < count; i += 16) {
+        __mmask16 mask = tailMask(count - i < 16 ? count - i : 16);
+        __m512 difference = _mm512_sub_ps(_mm512_maskz_loadu_ps(mask, a + i), _mm512_maskz_loadu_ps(mask, b + i));
+        if (_mm512_mask_cmp_ps_mask(mask, _mm512_abs_ps(difference), vTolerance, _CMP_GT_OQ) != 0) return false;
+    }
+    return true;
+}
+
+const FloatSimdTable AVX512_TABLE = {
+        addAvx512, subtractAvx512, scaleAvx512, shiftAvx512,
+        axpyAvx512, sumSquaresAvx512, allWithinAvx512, allCloseAvx512
+};
+
+#endif // MATRIX_SIMD_X86
+
+// Уровень выбирается при каждом вызове: setSimdLevel действует сразу
+const FloatSimdTable& table() {
+#if MATRIX_SIMD_X86
+    switch (getSimdLevel()) {
+        case SimdLevel::AVX512: return AVX512_TABLE;
+        case SimdLevel::AVX2: return AVX2_TABLE;
+        case SimdLevel::SSE2: return SSE2_TABLE;
+        case SimdLevel::Scalar: break;
+    }
+#endif
+    return SCALAR_TABLE;
+}
+
+} // namespace
+
+void add(const float* a, const float* b, float* out, std::size_t count) {
+    table().add(a, b, out, count);
+}
+
+void subtract(const float* a, const float* b, float* out, std::size_t count) {
+    table().subtract(a, b, out, count);
+}
+
+void scale(const float* a, float factor, float* out, std::size_t count) {
+    table().scale(a, factor, out, count);
+}
+
+void addScalar(const float* a, float value, float* out, std::size_t count) {
+    table().addScalar(a, value, out, count);
+}
+
+void axpy(float factor, const float* a, float* out, std::size_t count) {
+    table().axpy(factor, a, out, count);
+}
+
+double sumSquares(const float* a, std::size_t count) {
+    return table().sumSquares(a, count);
+}
+
+bool allWithin(const float* a, float tolerance, std::size_t count) {
+    return table().allWithin(a, tolerance, count);
+}
+
+bool allClose(const float* a, const float* b, float tolerance, std::size_t count) {
+    return table().allClose(a, b, tolerance, count);
+}
+
+} // namespace kernels
@@ -0,0 +1,471 @@
+/**
+ * @file SparseMatrix.cpp
+ * @brief Implementation of the CSR/CSC sparse matrix
+ * @author Shchurko
+ * @date 2025
+ */
+
+#include "SparseMatrix.h"
+#include "Reductions.h"
+#include "SimdKernels.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+// Выполняет task(begin, end) над участками строк [0, rows). prefixWork(i) -
+// накопленная работа строк [0, i); участки получают примерно равную работу.
+// Работа меньше порога параллельного умножения выполняется в вызывающем потоке
+template <typename PrefixWork, typename Task>
+void forEachRowRange(std::size_t rows, PrefixWork prefixWork, Task task) {
+    const std::size_t total = prefixWork(rows);
+    std::size_t tasks = 1;
+    if (total >= RealMatrix::getParallelThreshold()) {
+        tasks = std::min(ThreadPool::getGlobalThreadCount(), rows);
+    }
+    if (tasks <= 1) {
+        task(std::size_t{0}, rows);
+        return;
+    }
+
+    std::vector<std::size_t> bounds(tasks + 1, rows);
+    bounds[0] = 0;
+    for (std::size_t t = 1; t < tasks; ++t) {
+        const std::size_t target = total / tasks * t;
+        std::size_t low = bounds[t - 1];
+        std::size_t high = rows;
+        while (low < high) {
+            const std::size_t middle = low + (high - low) / 2;
+            if (prefixWork(middle) < target) low = middle + 1; else high = middle;
+        }
+        bounds[t] = low;
+    }
+    ThreadPool::global()->parallelFor(tasks, [&](std::size_t t) {
+        task(bounds[t], bounds[t + 1]);
+    });
+}
+
+// out[j] += factor * source[j]
+void accumulate(double* out, double factor, const double* source, std::size_t count) {
+    for (std::size_t j = 0; j < count; ++j) {
+        out[j] += factor * source[j];
+    }
+}
+
+} // namespace
+
+// Конструкторы
+SparseMatrix::SparseMatrix()
+        : numRows(0), numCols(0), format(Format::CSR), offsets(1, 0), indices(), values()
+{}
+
+SparseMatrix::SparseMatrix(std::size_t rows, std::size_t cols, Format format)
+        : numRows(rows), numCols(cols), format(format), offsets(), indices(), values()
+{
+    if (rows == 0 || cols == 0) {
+        throw std::invalid_argument("Matrix dimensions must be positive");
+    }
+    offsets.assign(lineCount() + 1, 0);
+}
+
+SparseMatrix::SparseMatrix(std::size_t rows, std::size_t cols, const std::vector<Triplet>& triplets,
+                           Format format)
+        : SparseMatrix(rows, cols, format)
+{
+    const bool byRow = format == Format::CSR;
+    for (const Triplet& triplet : triplets) {
+        if (triplet.row >= rows || triplet.col >= cols) {
+            throw std::out_of_range("Matrix indices out of range");
+        }
+        ++offsets[(byRow ? triplet.row : triplet.col) + 1];
+    }
+    for (std::size_t k = 0; k < lineCount(); ++k) {
+        offsets[k + 1] += offsets[k];
+    }
+
+    // Раскладка по линиям в исходном порядке, затем сортировка внутри линии
+    std::vector<std::pair<std::size_t, double>> entries(triplets.size());
+    std::vector<std::size_t> cursor(offsets.begin(), offsets.end() - 1);
+    for (const Triplet& triplet : triplets) {
+        const std::size_t line = byRow ? triplet.row : triplet.col;
+        entries[cursor[line]++] = {byRow ? triplet.col : triplet.row, triplet.value};
+    }
+
+    // Повторы складываются в порядке появления, нули отбрасываются
+    indices.reserve(entries.size());
+    values.reserve(entries.size());
+    std::size_t begin = 0;
+    for (std::size_t k = 0; k < lineCount(); ++k) {
+        const std::size_t end = offsets[k + 1];
+        std::stable_sort(entries.begin() + static_cast<std::ptrdiff_t>(begin),
+                         entries.begin() + static_cast<std::ptrdiff_t>(end),
+                         [](const auto& a, const auto& b) { return a.first < b.first; });
+        std::size_t p = begin;
+        while (p < end) {
+            const std::size_t index = entries[p].first;
+            double sum = 0.0;
+            for (; p < end && entries[p].first == index; ++p) {
+                sum += entries[p].second;
+            }
+            if (sum != 0.0) {
+                indices.push_back(index);
+                values.push_back(sum);
+            }
+        }
+        begin = end;
+        offsets[k + 1] = indices.size();
+    }
+}
+
+SparseMatrix::SparseMatrix(const RealMatrix& dense, Format format)
+        : SparseMatrix(dense.getRows(), dense.getCols(), Format::CSR)
+{
+    for (std::size_t i = 0; i < numRows; ++i) {
+        const double* row = dense.getData() + i * dense.getRowStride();
+        for (std::size_t j = 0; j < numCols; ++j) {
+            if (row[j] != 0.0) {
+                indices.push_back(j);
+                values.push_back(row[j]);
+            }
+        }
+        offsets[i + 1] = indices.size();
+    }
+    if (format != Format::CSR) {
+        *this = toFormat(format);
+    }
+}
+
+SparseMatrix::SparseMatrix(std::size_t rows, std::size_t cols, Format format,
+                           std::vector<std::size_t> offsets, std::vector<std::size_t> indices,
+                           std::vector<double> values)
+        : numRows(rows), numCols(cols), format(format), offsets(std::move(offsets)),
+          indices(std::move(indices)), values(std::move(values))
+{}
+
+// Геттеры
+std::size_t SparseMatrix::getRows() const {
+    return numRows;
+}
+
+std::size_t SparseMatrix::getCols() const {
+    return numCols;
+}
+
+std::size_t SparseMatrix::getNonZeroCount() const {
+    return values.size();
+}
+
+SparseMatrix::Format SparseMatrix::getFormat() const {
+    return format;
+}
+
+double SparseMatrix::getValue(std::size_t row, std::size_t col) const {
+    if (row >= numRows || col >= numCols) {
+        throw std::out_of_range("Matrix indices out of range");
+    }
+    const std::size_t line = format == Format::CSR ? row : col;
+    const std::size_t index = format == Format::CSR ? col : row;
+    const auto first = indices.begin() + static_cast<std::ptrdiff_t>(offsets[line]);
+    const auto last = indices.begin() + static_cast<std::ptrdiff_t>(offsets[line + 1]);
+    const auto found = std::lower_bound(first, last, index);
+    return (found != last && *found == index) ? values[static_cast<std::size_t>(found - indices.begin())] : 0.0;
+}
+
+const std::vector<std::size_t>& SparseMatrix::getOffsets() const {
+    return offsets;
+}
+
+const std::vector<std::size_t>& SparseMatrix::getIndices() const {
+    return indices;
+}
+
+const std::vector<double>& SparseMatrix::getValues() const {
+    return values;
+}
+
+std::size_t SparseMatrix::lineCount() const {
+    return format == Format::CSR ? numRows : numCols;
+}
+
+std::size_t SparseMatrix::indexLimit() const {
+    return format == Format::CSR ? numCols : numRows;
+}
+
+// Преобразования
+SparseMatrix SparseMatrix::toFormat(Format target) const {
+    if (target == format) {
+        return *this;
+    }
+
+    // Транспонирование подсчётом: обход линий по порядку сразу даёт
+    // возрастающие индексы в новых линиях
+    const std::size_t newLines = indexLimit();
+    std::vector<std::size_t> newOffsets(newLines + 1, 0);
+    for (std::size_t index : indices) {
+        ++newOffsets[index + 1];
+    }
+    for (std::size_t k = 0; k < newLines; ++k) {
+        newOffsets[k + 1] += newOffsets[k];
+    }
+
+    std::vector<std::size_t> newIndices(indices.size());
+    std::vector<double> newValues(values.size());
+    std::vector<std::size_t> cursor(newOffsets.begin(), newOffsets.end() - 1);
+    for (std::size_t k = 0; k < lineCount(); ++k) {
+        for (std::size_t p = offsets[k]; p < offsets[k + 1]; ++p) {
+            const std::size_t position = cursor[indices[p]]++;
+            newIndices[position] = k;
+            newValues[position] = values[p];
+        }
+    }
+    return SparseMatrix(numRows, numCols, target, std::move(newOffsets),
+                        std::move(newIndices), std::move(newValues));
+}
+
+RealMatrix SparseMatrix::toDense() const {
+    RealMatrix dense(numRows, numCols);
+    double* data = dense.getData();
+    const std::size_t stride = dense.getRowStride();
+    for (std::size_t k = 0; k < lineCount(); ++k) {
+        for (std::size_t p = offsets[k]; p < offsets[k + 1]; ++p) {
+            if (format == Format::CSR) {
+                data[k * stride + indices[p]] = values[p];
+            } else {
+                data[indices[p] * stride + k] = values[p];
+            }
+        }
+    }
+    return dense;
+}
+
+std::vector<SparseMatrix::Triplet> SparseMatrix::toTriplets() const {
+    std::vector<Triplet> triplets;
+    triplets.reserve(values.size());
+    for (std::size_t k = 0; k < lineCount(); ++k) {
+        for (std::size_t p = offsets[k]; p < offsets[k + 1]; ++p) {
+            if (format == Format::CSR) {
+                triplets.push_back({k, indices[p], values[p]});
+            } else {
+                triplets.push_back({indices[p], k, values[p]});
+            }
+        }
+    }
+    return triplets;
+}
+
+SparseMatrix SparseMatrix::computeTranspose() const {
+    const Format transposedFormat = format == Format::CSR ? Format::CSC : Format::CSR;
+    return SparseMatrix(numCols, numRows, transposedFormat, offsets, indices, values);
+}
+
+double SparseMatrix::calculateNorm() const {
+    return kernels::reduce(Reduction::Norm, values.data(), 1, values.size(), values.size());
+}
+
+// Арифметические операторы
+SparseMatrix SparseMatrix::combine(const SparseMatrix& other, double factor,
+                                   const char* mismatchMessage) const {
+    if (numRows != other.numRows || numCols != other.numCols) {
+        throw std::invalid_argument(mismatchMessage);
+    }
+    SparseMatrix converted;
+    const SparseMatrix& right = other.format == format ? other : (converted = other.toFormat(format));
+
+    std::vector<std::size_t> newOffsets(lineCount() + 1, 0);
+    std::vector<std::size_t> newIndices;
+    std::vector<double> newValues;
+    newIndices.reserve(values.size() + right.values.size());
+    newValues.reserve(values.size() + right.values.size());
+
+    auto append = [&](std::size_t index, double value) {
+        if (value != 0.0) {
+            newIndices.push_back(index);
+            newValues.push_back(value);
+        }
+    };
+
+    // Слияние упорядоченных линий
+    for (std::size_t k = 0; k < lineCount(); ++k) {
+        std::size_t p = offsets[k];
+        std::size_t q = right.offsets[k];
+        const std::size_t pEnd = offsets[k + 1];
+        const std::size_t qEnd = right.offsets[k + 1];
+        while (p < pEnd && q < qEnd) {
+            if (indices[p] < right.indices[q]) {
+                append(indices[p], values[p]);
+                ++p;
+            } else if (right.indices[q] < indices[p]) {
+                append(right.indices[q], factor * right.values[q]);
+                ++q;
+            } else {
+                append(indices[p], values[p] + factor * right.values[q]);
+                ++p;
+                ++q;
+            }
+        }
+        for (; p < pEnd; ++p) append(indices[p], values[p]);
+        for (; q < qEnd; ++q) append(right.indices[q], factor * right.values[q]);
+        newOffsets[k + 1] = newIndices.size();
+    }
+    return SparseMatrix(numRows, numCols, format, std::move(newOffsets),
+                        std::move(newIndices), std::move(newValues));
+}
+
+SparseMatrix SparseMatrix::operator+(const SparseMatrix& other) const {
+    return combine(other, 1.0, "Matrices dimensions must match for addition");
+}
+
+SparseMatrix SparseMatrix::operator-(const SparseMatrix& other) const {
+    return combine(other, -1.0, "Matrices dimensions must match for subtraction");
+}
+
+SparseMatrix SparseMatrix::operator*(double scalar) const {
+    if (scalar == 0.0) {
+        return SparseMatrix(numRows, numCols, format);
+    }
+    std::vector<double> scaled(values.size());
+    kernels::scale(values.data(), scalar, scaled.data(), values.size());
+    return SparseMatrix(numRows, numCols, format, offsets, indices, std::move(scaled));
+}
+
+SparseMatrix SparseMatrix::operator*(const SparseMatrix& other) const {
+    if (numCols != other.numRows) {
+        throw std::invalid_argument("Incompatible dimensions for matrix multiplication");
+    }
+    SparseMatrix leftConverted;
+    SparseMatrix rightConverted;
+    const SparseMatrix& left = format == Format::CSR ? *this : (leftConverted = toFormat(Format::CSR));
+    const SparseMatrix& right = other.format == Format::CSR ? other
+                                                           : (rightConverted = other.toFormat(Format::CSR));
+
+    // Густавсон: строка результата накапливается в плотном буфере,
+    // marker отмечает столбцы, уже задетые в текущей строке
+    const std::size_t resultCols = right.numCols;
+    std::vector<double> accumulator(resultCols, 0.0);
+    std::vector<std::size_t> marker(resultCols, std::numeric_limits<std::size_t>::max());
+    std::vector<std::size_t> touched;
+
+    std::vector<std::size_t> newOffsets(numRows + 1, 0);
+    std::vector<std::size_t> newIndices;
+    std::vector<double> newValues;
+
+    for (std::size_t i = 0; i < numRows; ++i) {
+        touched.clear();
+        for (std::size_t p = left.offsets[i]; p < left.offsets[i + 1]; ++p) {
+            const std::size_t k = left.indices[p];
+            const double a = left.values[p];
+            for (std::size_t q = right.offsets[k]; q < right.offsets[k + 1]; ++q) {
+                const std::size_t j = right.indices[q];
+                if (marker[j] != i) {
+                    marker[j] = i;
+                    accumulator[j] = a * right.values[q];
+                    touched.push_back(j);
+                } else {
+                    accumulator[j] += a * right.values[q];
+                }
+            }
+        }
+        std::sort(touched.begin(), touched.end());
+        for (std::size_t j : touched) {
+            if (accumulator[j] != 0.0) {
+                newIndices.push_back(j);
+                newValues.push_back(accumulator[j]);
+            }
+        }
+        newOffsets[i + 1] = newIndices.size();
+    }
+    return SparseMatrix(numRows, resultCols, Format::CSR, std::move(newOffsets),
+                        std::move(newIndices), std::move(newValues));
+}
+
+RealMatrix SparseMatrix::operator*(const RealMatrix& other) const {
+    if (numCols != other.getRows()) {
+        throw std::invalid_argument("Incompatible dimensions for matrix multiplication");
+    }
+    // Перевод CSC в CSR стоит O(nnz), само умножение - O(nnz * cols)
+    SparseMatrix converted;
+    const SparseMatrix& left = format == Format::CSR ? *this : (converted = toFormat(Format::CSR));
+
+    const std::size_t cols = other.getCols();
+    RealMatrix result(numRows, cols);
+    const double* source = other.getData();
+    const std::size_t sourceStride = other.getRowStride();
+    double* out = result.getData();
+    const std::size_t outStride = result.getRowStride();
+
+    // Строка i результата - сумма строк other с весами из строки i
+    forEachRowRange(numRows, [&](std::size_t row) { return left.offsets[row] * cols; },
+                    [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            for (std::size_t p = left.offsets[i]; p < left.offsets[i + 1]; ++p) {
+                accumulate(out + i * outStride, left.values[p], source + left.indices[p] * sourceStride, cols);
+            }
+        }
+    });
+    return result;
+}
+
+RealMatrix operator*(const RealMatrix& dense, const SparseMatrix& sparse) {
+    if (dense.getCols() != sparse.getRows()) {
+        throw std::invalid_argument("Incompatible dimensions for matrix multiplication");
+    }
+    const SparseMatrix converted = sparse.toFormat(SparseMatrix::Format::CSR);
+    const std::vector<std::size_t>& offsets = converted.getOffsets();
+    const std::vector<std::size_t>& indices = converted.getIndices();
+    const std::vector<double>& values = converted.getValues();
+
+    const std::size_t rows = dense.getRows();
+    const std::size_t inner = dense.getCols();
+    RealMatrix result(rows, sparse.getCols());
+    const double* source = dense.getData();
+    const std::size_t sourceStride = dense.getRowStride();
+    double* out = result.getData();
+    const std::size_t outStride = result.getRowStride();
+
+    // Строка i результата - сумма строк sparse с весами из строки i dense
+    const std::size_t rowWork = values.size() + inner;
+    forEachRowRange(rows, [&](std::size_t row) { return row * rowWork; },
+                    [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            const double* weights = source + i * sourceStride;
+            double* target = out + i * outStride;
+            for (std::size_t k = 0; k < inner; ++k) {
+                if (weights[k] == 0.0) continue;
+                for (std::size_t p = offsets[k]; p < offsets[k + 1]; ++p) {
+                    target[indices[p]] += weights[k] * values[p];
+                }
+            }
+        }
+    });
+    return result;
+}
+
+SparseMatrix operator*(double scalar, const SparseMatrix& matrix) {
+    return matrix * scalar;
+}
+
+// Операторы сравнения: с тем же допуском, что и у плотных матриц
+bool SparseMatrix::operator==(const SparseMatrix& other) const {
+    if (numRows != other.numRows || numCols != other.numCols) {
+        return false;
+    }
+    const std::vector<double> difference = (*this - other).values;
+    return kernels::allWithin(difference.data(), MATRIX_EPSILON, difference.size());
+}
+
+bool SparseMatrix::operator!=(const SparseMatrix& other) const {
+    return !(*this == other);
+}
+
+// Потоковый вывод: размеры и ненулевые элементы в виде "строка столбец значение"
+std::ostream& operator<<(std::ostream& os, const SparseMatrix& matrix) {
+    os << matrix.numRows << " " << matrix.numCols << " " << matrix.getNonZeroCount();
+    for (const SparseMatrix::Triplet& triplet : matrix.toTriplets()) {
+        os << "\n" << triplet.row << " " << triplet.col << " " << triplet.value;
+    }
+    return os;
+}
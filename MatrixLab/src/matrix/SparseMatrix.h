@@ -0,0 +1,111 @@
+/**
+ * @file SparseMatrix.h
+ * @brief Compressed sparse row/column matrix interoperable with RealMatrix
+ * @author Shchurko
+ * @date 2025
+ */
+
+#ifndef MATRIXLAB_SPARSEMATRIX_H
+#define MATRIXLAB_SPARSEMATRIX_H
+
+#include <cstddef>
+#include <iostream>
+#include <vector>
+#include "Matrix.h"
+
+/**
+ * @brief Разреженная матрица в формате CSR или CSC
+ *
+ * Хранит только ненулевые элементы: для CSR - по строкам, для CSC - по
+ * столбцам. Линия (строка для CSR, столбец для CSC) k занимает позиции
+ * [offsets[k], offsets[k + 1]) массивов indices (номера столбцов для CSR,
+ * строк для CSC) и values. Индексы внутри линии строго возрастают,
+ * явных нулей нет. Память и стоимость операций пропорциональны числу
+ * ненулевых элементов nnz, а не rows * cols.
+ */
+class SparseMatrix {
+public:
+    enum class Format {
+        CSR,
+        CSC
+    };
+
+    // Элемент в координатном формате (COO)
+    struct Triplet {
+        std::size_t row;
+        std::size_t col;
+        double value;
+    };
+
+    // Конструкторы
+    SparseMatrix();
+    // Нулевая матрица rows x cols
+    SparseMatrix(std::size_t rows, std::size_t cols, Format format = Format::CSR);
+    // Из тройек COO: повторяющиеся позиции суммируются, нули отбрасываются
+    SparseMatrix(std::size_t rows, std::size_t cols, const std::vector<Triplet>& triplets,
+                 Format format = Format::CSR);
+    // Из плотной матрицы: сохраняются элементы, отличные от нуля
+    explicit SparseMatrix(const RealMatrix& dense, Format format = Format::CSR);
+
+    // Геттеры
+    std::size_t getRows() const;
+    std::size_t getCols() const;
+    std::size_t getNonZeroCount() const;
+    Format getFormat() const;
+    double getValue(std::size_t row, std::size_t col) const;
+
+    // Сжатое представление (см. описание класса)
+    const std::vector<std::size_t>& getOffsets() const;
+    const std::vector<std::size_t>& getIndices() const;
+    const std::vector<double>& getValues() const;
+
+    // Преобразования
+    SparseMatrix toFormat(Format format) const;
+    RealMatrix toDense() const;
+    std::vector<Triplet> toTriplets() const;
+    // CSR-матрица A^T совпадает по массивам с CSC-матрицей A: транспонирование
+    // меняет только формат и размеры, без перестановки элементов
+    SparseMatrix computeTranspose() const;
+
+    double calculateNorm() const;
+
+    // Арифметические операторы. Операнд в другом формате предварительно
+    // приводится к формату левого операнда
+    SparseMatrix operator+(const SparseMatrix& other) const;
+    SparseMatrix operator-(const SparseMatrix& other) const;
+    SparseMatrix operator*(double scalar) const;
+    // Произведение разреженных матриц (алгоритм Густавсона), результат в CSR
+    SparseMatrix operator*(const SparseMatrix& other) const;
+    // Разреженная на плотную: O(nnz * other.cols)
+    RealMatrix operator*(const RealMatrix& other) const;
+
+    bool operator==(const SparseMatrix& other) const;
+    bool operator!=(const SparseMatrix& other) const;
+
+    friend std::ostream& operator<<(std::ostream& os, const SparseMatrix& matrix);
+
+private:
+    SparseMatrix(std::size_t rows, std::size_t cols, Format format,
+                 std::vector<std::size_t> offsets, std::vector<std::size_t> indices,
+                 std::vector<double> values);
+
+    // Число линий: строк для CSR, столбцов для CSC
+    std::size_t lineCount() const;
+    std::size_t indexLimit() const;
+
+    // Поэлементное сложение с коэффициентом: this + factor * other
+    SparseMatrix combine(const SparseMatrix& other, double factor, const char* mismatchMessage) const;
+
+    std::size_t numRows;
+    std::size_t numCols;
+    Format format;
+    std::vector<std::size_t> offsets;
+    std::vector<std::size_t> indices;
+    std::vector<double> values;
+};
+
+// Плотная на разреженную: O(rows * nnz)
+RealMatrix operator*(const RealMatrix& dense, const SparseMatrix& sparse);
+SparseMatrix operator*(double scalar, const SparseMatrix& matrix);
+
+#endif // MATRIXLAB_SPARSEMATRIX_H
@@ -0,0 +1,391 @@
+/**
+ * @file StaticMatrix.h
+ * @brief Fixed-size stack matrix with compile-time dimensions
+ * @author Shchurko
+ * @date 2025
+ */
+
+#ifndef MATRIXLAB_STATICMATRIX_H
+#define MATRIXLAB_STATICMATRIX_H
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "Matrix.h"
+
+namespace static_detail {
+
+template <typename T>
+constexpr T absolute(T value) {
+    return value < T(0) ? -value : value;
+}
+
+// Делитель, на который делить нельзя: ноль или (для вещественных типов)
+// число меньше MatrixTraits<T>::epsilon по модулю. У целых epsilon = 0,
+// поэтому ноль проверяется отдельно
+template <typename T>
+constexpr bool isZeroDivisor(T value) {
+    return value == T(0) || absolute(value) < MatrixTraits<T>::epsilon;
+}
+
+// Массив {f(0), f(1), ..., f(N - 1)}: развёртывание цикла на этапе компиляции
+template <typename F, std::size_t... I>
+constexpr auto generate(F f, std::index_sequence<I...>) -> std::array<decltype(f(std::size_t{0})), sizeof...(I)> {
+    return {{f(I)...}};
+}
+
+// f(0) + f(1) + ... + f(N - 1)
+template <typename F, std::size_t... I>
+constexpr auto sum(F f, std::index_sequence<I...>) {
+    return (f(I) + ...);
+}
+
+} // namespace static_detail
+
+/**
+ * @brief Матрица R x C с размерами, известными при компиляции
+ *
+ * Значения хранятся по строкам в std::array прямо в объекте: ни
+ * выделения памяти, ни проверок размеров во время выполнения. Все
+ * операции constexpr; поэлементные операции, умножение и
+ * транспонирование разворачиваются через index_sequence, определитель и
+ * обратная матрица для размеров до 4 вычисляются по явным формулам.
+ * Несовместимые размеры - ошибка компиляции. Исключения бросают только
+ * проверяемый доступ getValue/setValue, деление на ноль, обращение
+ * вырожденной матрицы и преобразование из RealMatrix другого размера.
+ */
+template <typename T, std::size_t R, std::size_t C>
+class StaticMatrix {
+    static_assert(R > 0 && C > 0, "StaticMatrix dimensions must be positive");
+    static_assert(std::is_arithmetic<T>::value, "StaticMatrix element type must be arithmetic");
+
+public:
+    using value_type = T;
+    static constexpr std::size_t ROWS = R;
+    static constexpr std::size_t COLS = C;
+
+    // Конструкторы
+    constexpr StaticMatrix() : values{} {}
+
+    // Все R * C значений по строкам; другое число значений не компилируется
+    template <typename... Values,
+              typename = std::enable_if_t<sizeof...(Values) == R * C &&
+                                          std::conjunction<std::is_arithmetic<Values>...>::value>>
+    constexpr StaticMatrix(Values... elements) : values{{static_cast<T>(elements)...}} {}
+
+    explicit constexpr StaticMatrix(const std::array<T, R * C>& elements) : values(elements) {}
+
+    // Из RealMatrix того же размера
+    explicit StaticMatrix(const RealMatrix& matrix) : values{} {
+        if (matrix.getRows() != R || matrix.getCols() != C) {
+            throw std::invalid_argument("Matrix dimensions must match StaticMatrix dimensions");
+        }
+        const double* data = matrix.getData();
+        for (std::size_t i = 0; i < R; ++i) {
+            for (std::size_t j = 0; j < C; ++j) {
+                values[i * C + j] = static_cast<T>(data[i * matrix.getRowStride() + j]);
+            }
+        }
+    }
+
+    static constexpr StaticMatrix createFilled(T value) {
+        return StaticMatrix(static_detail::generate([value](std::size_t) { return value; },
+                                                    std::make_index_sequence<R * C>{}));
+    }
+
+    static constexpr StaticMatrix createIdentity() {
+        static_assert(R == C, "Identity matrix must be square");
+        return StaticMatrix(static_detail::generate([](std::size_t k) { return k / C == k % C ? T(1) : T(0); },
+                                                    std::make_index_sequence<R * C>{}));
+    }
+
+    RealMatrix toRealMatrix() const {
+        RealMatrix matrix(R, C);
+        double* data = matrix.getData();
+        for (std::size_t i = 0; i < R; ++i) {
+            for (std::size_t j = 0; j < C; ++j) {
+                data[i * matrix.getRowStride() + j] = static_cast<double>(values[i * C + j]);
+            }
+        }
+        return matrix;
+    }
+
+    // Доступ к элементам: operator() без проверки, getValue/setValue с проверкой
+    constexpr std::size_t getRows() const { return R; }
+    constexpr std::size_t getCols() const { return C; }
+    constexpr T& operator()(std::size_t row, std::size_t col) { return values[row * C + col]; }
+    constexpr const T& operator()(std::size_t row, std::size_t col) const { return values[row * C + col]; }
+    constexpr const std::array<T, R * C>& getValues() const { return values; }
+
+    T getValue(std::size_t row, std::size_t col) const {
+        if (row >= R || col >= C) {
+            throw std::out_of_range("Matrix indices out of range");
+        }
+        return values[row * C + col];
+    }
+
+    void setValue(std::size_t row, std::size_t col, T value) {
+        if (row >= R || col >= C) {
+            throw std::out_of_range("Matrix indices out of range");
+        }
+        values[row * C + col] = value;
+    }
+
+    // Арифметические операторы
+    constexpr StaticMatrix operator+(const StaticMatrix& other) const {
+        return map([&](std::size_t k) { return values[k] + other.values[k]; });
+    }
+
+    constexpr StaticMatrix operator-(const StaticMatrix& other) const {
+        return map([&](std::size_t k) { return values[k] - other.values[k]; });
+    }
+
+    constexpr StaticMatrix operator-() const {
+        return map([&](std::size_t k) { return -values[k]; });
+    }
+
+    constexpr StaticMatrix operator*(T scalar) const {
+        return map([&](std::size_t k) { return values[k] * scalar; });
+    }
+
+    constexpr StaticMatrix operator/(T scalar) const {
+        if (static_detail::isZeroDivisor(scalar)) {
+            throw std::invalid_argument("Division by zero");
+        }
+        return map([&](std::size_t k) { return values[k] / scalar; });
+    }
+
+    // (R x C) * (C x N): внутреннее измерение проверяется типом
+    template <std::size_t N>
+    constexpr StaticMatrix<T, R, N> operator*(const StaticMatrix<T, C, N>& other) const {
+        return StaticMatrix<T, R, N>(static_detail::generate([&](std::size_t k) {
+            const std::size_t i = k / N;
+            const std::size_t j = k % N;
+            return static_detail::sum([&](std::size_t p) { return (*this)(i, p) * other(p, j); },
+                                      std::make_index_sequence<C>{});
+        }, std::make_index_sequence<R * N>{}));
+    }
+
+    constexpr StaticMatrix& operator+=(const StaticMatrix& other) { return *this = *this + other; }
+    constexpr StaticMatrix& operator-=(const StaticMatrix& other) { return *this = *this - other; }
+    constexpr StaticMatrix& operator*=(T scalar) { return *this = *this * scalar; }
+    constexpr StaticMatrix& operator/=(T scalar) { return *this = *this / scalar; }
+    constexpr StaticMatrix& operator*=(const StaticMatrix<T, C, C>& other) { return *this = *this * other; }
+
+    // Операции с матрицами
+    constexpr StaticMatrix<T, C, R> computeTranspose() const {
+        return StaticMatrix<T, C, R>(static_detail::generate([&](std::size_t k) {
+            return (*this)(k % R, k / R);
+        }, std::make_index_sequence<R * C>{}));
+    }
+
+    constexpr T calculateTrace() const {
+        static_assert(R == C, "Matrix must be square to compute trace");
+        return static_detail::sum([&](std::size_t i) { return (*this)(i, i); }, std::make_index_sequence<R>{});
+    }
+
+    constexpr T calculateDeterminant() const {
+        static_assert(R == C, "Matrix must be square to compute determinant");
+        const StaticMatrix& m = *this;
+        if constexpr (R == 1) {
+            return m(0, 0);
+        } else if constexpr (R == 2) {
+            return m(0, 0) * m(1, 1) - m(0, 1) * m(1, 0);
+        } else if constexpr (R == 3) {
+            return m(0, 0) * (m(1, 1) * m(2, 2) - m(1, 2) * m(2, 1)) -
+                   m(0, 1) * (m(1, 0) * m(2, 2) - m(1, 2) * m(2, 0)) +
+                   m(0, 2) * (m(1, 0) * m(2, 1) - m(1, 1) * m(2, 0));
+        } else if constexpr (R == 4) {
+            const Minors4 minors(m);
+            return minors.determinant();
+        } else {
+            return eliminate(nullptr);
+        }
+    }
+
+    // Бросает std::runtime_error для вырожденной матрицы
+    constexpr StaticMatrix computeInverse() const {
+        static_assert(R == C, "Matrix must be square to compute inverse");
+        const StaticMatrix& m = *this;
+        if constexpr (R <= 3) {
+            const T det = calculateDeterminant();
+            if (det == T(0)) {
+                throw std::runtime_error("Matrix is singular");
+            }
+            if constexpr (R == 1) {
+                return StaticMatrix(T(1) / det);
+            } else if constexpr (R == 2) {
+                return StaticMatrix(m(1, 1), -m(0, 1), -m(1, 0), m(0, 0)) * (T(1) / det);
+            } else {
+                // Присоединённая матрица: транспонированные алгебраические дополнения
+                return StaticMatrix(
+                        m(1, 1) * m(2, 2) - m(1, 2) * m(2, 1), m(0, 2) * m(2, 1) - m(0, 1) * m(2, 2),
+                        m(0, 1) * m(1, 2) - m(0, 2) * m(1, 1),
+                        m(1, 2) * m(2, 0) - m(1, 0) * m(2, 2), m(0, 0) * m(2, 2) - m(0, 2) * m(2, 0),
+                        m(0, 2) * m(1, 0) - m(0, 0) * m(1, 2),
+                        m(1, 0) * m(2, 1) - m(1, 1) * m(2, 0), m(0, 1) * m(2, 0) - m(0, 0) * m(2, 1),
+                        m(0, 0) * m(1, 1) - m(0, 1) * m(1, 0)) * (T(1) / det);
+            }
+        } else if constexpr (R == 4) {
+            const Minors4 minors(m);
+            const T det = minors.determinant();
+            if (det == T(0)) {
+                throw std::runtime_error("Matrix is singular");
+            }
+            return minors.adjugate(m) * (T(1) / det);
+        } else {
+            StaticMatrix inverse = createIdentity();
+            if (eliminate(&inverse) == T(0)) {
+                throw std::runtime_error("Matrix is singular");
+            }
+            return inverse;
+        }
+    }
+
+    T calculateNorm() const {
+        return std::sqrt(static_detail::sum([&](std::size_t k) { return values[k] * values[k]; },
+                                            std::make_index_sequence<R * C>{}));
+    }
+
+    // Операторы сравнения (с допуском MatrixTraits<T>::epsilon, как у RealMatrix)
+    constexpr bool operator==(const StaticMatrix& other) const {
+        for (std::size_t k = 0; k < R * C; ++k) {
+            if (static_detail::absolute(values[k] - other.values[k]) > MatrixTraits<T>::epsilon) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    constexpr bool operator!=(const StaticMatrix& other) const {
+        return !(*this == other);
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const StaticMatrix& matrix) {
+        for (std::size_t i = 0; i < R; ++i) {
+            for (std::size_t j = 0; j < C; ++j) {
+                os << matrix(i, j);
+                if (j < C - 1) os << " ";
+            }
+            if (i < R - 1) os << "\n";
+        }
+        return os;
+    }
+
+private:
+    template <typename F>
+    constexpr StaticMatrix map(F f) const {
+        return StaticMatrix(static_detail::generate(f, std::make_index_sequence<R * C>{}));
+    }
+
+    // Миноры 2x2 верхней (s) и нижней (c) пар строк матрицы 4x4:
+    // определитель и присоединённая матрица через 12 произведений
+    struct Minors4 {
+        T s[6];
+        T c[6];
+
+        constexpr explicit Minors4(const StaticMatrix& m)
+                : s{m(0, 0) * m(1, 1) - m(1, 0) * m(0, 1), m(0, 0) * m(1, 2) - m(1, 0) * m(0, 2),
+                    m(0, 0) * m(1, 3) - m(1, 0) * m(0, 3), m(0, 1) * m(1, 2) - m(1, 1) * m(0, 2),
+                    m(0, 1) * m(1, 3) - m(1, 1) * m(0, 3), m(0, 2) * m(1, 3) - m(1, 2) * m(0, 3)},
+                  c{m(2, 0) * m(3, 1) - m(3, 0) * m(2, 1), m(2, 0) * m(3, 2) - m(3, 0) * m(2, 2),
+                    m(2, 0) * m(3, 3) - m(3, 0) * m(2, 3), m(2, 1) * m(3, 2) - m(3, 1) * m(2, 2),
+                    m(2, 1) * m(3, 3) - m(3, 1) * m(2, 3), m(2, 2) * m(3, 3) - m(3, 2) * m(2, 3)}
+        {}
+
+        constexpr T determinant() const {
+            return s[0] * c[5] - s[1] * c[4] + s[2] * c[3] + s[3] * c[2] - s[4] * c[1] + s[5] * c[0];
+        }
+
+        constexpr StaticMatrix adjugate(const StaticMatrix& m) const {
+            return StaticMatrix(
+                    m(1, 1) * c[5] - m(1, 2) * c[4] + m(1, 3) * c[3],
+                    -m(0, 1) * c[5] + m(0, 2) * c[4] - m(0, 3) * c[3],
+                    m(3, 1) * s[5] - m(3, 2) * s[4] + m(3, 3) * s[3],
+                    -m(2, 1) * s[5] + m(2, 2) * s[4] - m(2, 3) * s[3],
+                    -m(1, 0) * c[5] + m(1, 2) * c[2] - m(1, 3) * c[1],
+                    m(0, 0) * c[5] - m(0, 2) * c[2] + m(0, 3) * c[1],
+                    -m(3, 0) * s[5] + m(3, 2) * s[2] - m(3, 3) * s[1],
+                    m(2, 0) * s[5] - m(2, 2) * s[2] + m(2, 3) * s[1],
+                    m(1, 0) * c[4] - m(1, 1) * c[2] + m(1, 3) * c[0],
+                    -m(0, 0) * c[4] + m(0, 1) * c[2] - m(0, 3) * c[0],
+                    m(3, 0) * s[4] - m(3, 1) * s[2] + m(3, 3) * s[0],
+                    -m(2, 0) * s[4] + m(2, 1) * s[2] - m(2, 3) * s[0],
+                    -m(1, 0) * c[3] + m(1, 1) * c[1] - m(1, 2) * c[0],
+                    m(0, 0) * c[3] - m(0, 1) * c[1] + m(0, 2) * c[0],
+                    -m(3, 0) * s[3] + m(3, 1) * s[1] - m(3, 2) * s[0],
+                    m(2, 0) * s[3] - m(2, 1) * s[1] + m(2, 2) * s[0]);
+        }
+    };
+
+    // Гаусс-Жордан с выбором главного элемента для размеров больше 4.
+    // Возвращает определитель; если inverse не нулевой, он получает обратную
+    // матрицу (должен быть единичной матрицей на входе)
+    constexpr T eliminate(StaticMatrix* inverse) const {
+        StaticMatrix a = *this;
+        T det = T(1);
+        for (std::size_t j = 0; j < R; ++j) {
+            std::size_t pivotRow = j;
+            for (std::size_t i = j + 1; i < R; ++i) {
+                if (static_detail::absolute(a(i, j)) > static_detail::absolute(a(pivotRow, j))) {
+                    pivotRow = i;
+                }
+            }
+            if (a(pivotRow, j) == T(0)) {
+                return T(0);
+            }
+            if (pivotRow != j) {
+                for (std::size_t k = 0; k < C; ++k) {
+                    const T held = a(j, k);
+                    a(j, k) = a(pivotRow, k);
+                    a(pivotRow, k) = held;
+                    if (inverse != nullptr) {
+                        const T heldInverse = (*inverse)(j, k);
+                        (*inverse)(j, k) = (*inverse)(pivotRow, k);
+                        (*inverse)(pivotRow, k) = heldInverse;
+                    }
+                }
+                det = -det;
+            }
+
+            const T pivot = a(j, j);
+            det *= pivot;
+            const std::size_t firstRow = inverse != nullptr ? 0 : j + 1;
+            for (std::size_t i = firstRow; i < R; ++i) {
+                if (i == j) continue;
+                const T factor = a(i, j) / pivot;
+                for (std::size_t k = 0; k < C; ++k) {
+                    a(i, k) -= factor * a(j, k);
+                    if (inverse != nullptr) (*inverse)(i, k) -= factor * (*inverse)(j, k);
+                }
+            }
+        }
+        if (inverse != nullptr) {
+            for (std::size_t i = 0; i < R; ++i) {
+                for (std::size_t k = 0; k < C; ++k) {
+                    (*inverse)(i, k) /= a(i, i);
+                }
+            }
+        }
+        return det;
+    }
+
+    std::array<T, R * C> values;
+};
+
+template <typename T, std::size_t R, std::size_t C>
+constexpr StaticMatrix<T, R, C> operator*(T scalar, const StaticMatrix<T, R, C>& matrix) {
+    return matrix * scalar;
+}
+
+template <std::size_t R, std::size_t C>
+using StaticMatrixD = StaticMatrix<double, R, C>;
+using Matrix2d = StaticMatrix<double, 2, 2>;
+using Matrix3d = StaticMatrix<double, 3, 3>;
+using Matrix4d = StaticMatrix<double, 4, 4>;
+
+#endif // MATRIXLAB_STATICMATRIX_H
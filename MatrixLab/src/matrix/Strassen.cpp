@@ -0,0 +1,224 @@
+/**
+ * @file Strassen.cpp
+ * @brief Strassen-Winograd recursion with a single preallocated workspace
+ * @author Shchurko
+ * @date 2025
+ */
+
+#include "Strassen.h"
+#include "Gemm.h"
+#include "SimdKernels.h"
+#include "ThreadPool.h"
+#include "AlignedAllocator.h"
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+namespace kernels {
+
+namespace {
+
+// Блок операнда: указатель на левый верхний элемент и шаги исходной матрицы
+struct Operand {
+    const double* data;
+    std::size_t rowStride;
+    std::size_t colStride;
+
+    Operand block(std::size_t row, std::size_t col) const {
+        return {data + row * rowStride + col * colStride, rowStride, colStride};
+    }
+};
+
+// Строк в одной задаче пула при сложении блоков
+constexpr std::size_t ROWS_PER_TASK = 64;
+// Сложения блоков меньше этого числа элементов идут в одном потоке
+constexpr std::size_t PARALLEL_ELEMENTS = 1 << 16;
+
+// Шаг строки в рабочем буфере: кратен строке кэша
+std::size_t paddedStride(std::size_t cols) {
+    const std::size_t lane = MATRIX_ALIGNMENT / sizeof(double);
+    return (cols + lane - 1) / lane * lane;
+}
+
+// Построчный обход для сложений: большие блоки делятся между потоками пула.
+// Сложения ограничены пропускной способностью памяти, поэтому в одном
+// потоке они заметно тормозят на фоне параллельного gemm
+template <typename RowOperation>
+void forEachRow(std::size_t rows, std::size_t cols, RowOperation operation) {
+    const std::size_t tasks = (rows + ROWS_PER_TASK - 1) / ROWS_PER_TASK;
+    auto runTask = [&](std::size_t task) {
+        const std::size_t end = std::min(rows, (task + 1) * ROWS_PER_TASK);
+        for (std::size_t i = task * ROWS_PER_TASK; i < end; ++i) {
+            operation(i);
+        }
+    };
+    if (tasks > 1 && rows * cols >= PARALLEL_ELEMENTS &&
+        ThreadPool::getGlobalThreadCount() > 1) {
+        ThreadPool::global()->parallelFor(tasks, runTask);
+    } else {
+        for (std::size_t task = 0; task < tasks; ++task) runTask(task);
+    }
+}
+
+// out = x + y или x - y; out хранится по строкам
+void combine(std::size_t rows, std::size_t cols, Operand x, Operand y, bool subtractY,
+             double* out, std::size_t outStride) {
+    forEachRow(rows, cols, [&](std::size_t i) {
+        const double* xRow = x.data + i * x.rowStride;
+        const double* yRow = y.data + i * y.rowStride;
+        double* outRow = out + i * outStride;
+        if (x.colStride == 1 && y.colStride == 1) {
+            if (subtractY) {
+                subtract(xRow, yRow, outRow, cols);
+            } else {
+                add(xRow, yRow, outRow, cols);
+            }
+            return;
+        }
+        for (std::size_t j = 0; j < cols; ++j) {
+            const double xValue = xRow[j * x.colStride];
+            const double yValue = yRow[j * y.colStride];
+            outRow[j] = subtractY ? xValue - yValue : xValue + yValue;
+        }
+    });
+}
+
+// target += source или target -= source; обе матрицы хранятся по строкам
+void accumulate(std::size_t rows, std::size_t cols, double* target, std::size_t targetStride,
+                const double* source, std::size_t sourceStride, bool subtractSource) {
+    combine(rows, cols, {target, targetStride, 1}, {source, sourceStride, 1}, subtractSource,
+            target, targetStride);
+}
+
+bool isLeaf(std::size_t m, std::size_t n, std::size_t k, std::size_t crossover) {
+    return std::min({m, n, k}) < std::max<std::size_t>(crossover, 2);
+}
+
+std::size_t levelWorkspace(std::size_t m2, std::size_t n2, std::size_t k2) {
+    return m2 * paddedStride(k2) + k2 * paddedStride(n2) + m2 * paddedStride(n2);
+}
+
+void multiplyRecursive(std::size_t m, std::size_t n, std::size_t k, Operand a, Operand b,
+                       double* c, std::size_t cs, double* workspace, std::size_t crossover) {
+    if (isLeaf(m, n, k, crossover)) {
+        gemm(m, n, k, 1.0, a.data, a.rowStride, a.colStride,
+             b.data, b.rowStride, b.colStride, 0.0, c, cs);
+        return;
+    }
+
+    const std::size_t m2 = m / 2;
+    const std::size_t n2 = n / 2;
+    const std::size_t k2 = k / 2;
+
+    // Рабочие блоки уровня: X (m2 x k2) для сумм A, Y (k2 x n2) для сумм B,
+    // Z (m2 x n2) для произведений, которым не нашлось места в C.
+    // Всё, что дальше, отдаётся следующему уровню
+    const std::size_t xs = paddedStride(k2);
+    const std::size_t ys = paddedStride(n2);
+    const std::size_t zs = ys;
+    double* x = workspace;
+    double* y = x + m2 * xs;
+    double* z = y + k2 * ys;
+    double* rest = z + m2 * zs;
+    const Operand xOperand{x, xs, 1};
+    const Operand yOperand{y, ys, 1};
+
+    const Operand a11 = a.block(0, 0), a12 = a.block(0, k2), a21 = a.block(m2, 0), a22 = a.block(m2, k2);
+    const Operand b11 = b.block(0, 0), b12 = b.block(0, n2), b21 = b.block(k2, 0), b22 = b.block(k2, n2);
+    double* c11 = c;
+    double* c12 = c + n2;
+    double* c21 = c + m2 * cs;
+    double* c22 = c21 + n2;
+
+    auto recurse = [&](Operand left, Operand right, double* out, std::size_t outStride) {
+        multiplyRecursive(m2, n2, k2, left, right, out, outStride, rest, crossover);
+    };
+
+    // Схема Винограда: S1 = A21 + A22, S2 = S1 - A11, S3 = A11 - A21, S4 = A12 - S2,
+    // T1 = B12 - B11, T2 = B22 - T1, T3 = B22 - B12, T4 = T2 - B21.
+    // Произведения P1..P7 собираются в квадранты C по мере готовности
+    combine(m2, k2, a11, a21, true, x, xs);                       // X = S3
+    combine(k2, n2, b22, b12, true, y, ys);                       // Y = T3
+    recurse(xOperand, yOperand, c21, cs);                         // C21 = P7 = S3 * T3
+
+    combine(m2, k2, a21, a22, false, x, xs);                      // X = S1
+    combine(k2, n2, b12, b11, true, y, ys);                       // Y = T1
+    recurse(xOperand, yOperand, c22, cs);                         // C22 = P5 = S1 * T1
+
+    combine(m2, k2, xOperand, a11, true, x, xs);                  // X = S2
+    combine(k2, n2, b22, yOperand, true, y, ys);                  // Y = T2
+    recurse(xOperand, yOperand, c12, cs);                         // C12 = P6 = S2 * T2
+
+    combine(m2, k2, a12, xOperand, true, x, xs);                  // X = S4
+    recurse(xOperand, b22, z, zs);                                // Z = P3 = S4 * B22
+
+    recurse(a11, b11, c11, cs);                                   // C11 = P1 = A11 * B11
+    accumulate(m2, n2, c12, cs, c11, cs, false);                  // C12 = U2 = P1 + P6
+    accumulate(m2, n2, c21, cs, c12, cs, false);                  // C21 = U3 = U2 + P7
+    accumulate(m2, n2, c12, cs, c22, cs, false);                  // C12 = U4 = U2 + P5
+    accumulate(m2, n2, c22, cs, c21, cs, false);                  // C22 = U7 = U3 + P5
+    accumulate(m2, n2, c12, cs, z, zs, false);                    // C12 = U5 = U4 + P3
+
+    combine(k2, n2, yOperand, b21, true, y, ys);                  // Y = T4
+    recurse(a22, yOperand, z, zs);                                // Z = P4 = A22 * T4
+    accumulate(m2, n2, c21, cs, z, zs, true);                     // C21 = U6 = U3 - P4
+
+    recurse(a12, b21, z, zs);                                     // Z = P2 = A12 * B21
+    accumulate(m2, n2, c11, cs, z, zs, false);                    // C11 = U1 = P1 + P2
+
+    // Нечётные размеры: недостающий внутренний индекс добавляется к чётной
+    // части C, затем досчитываются последний столбец и последняя строка
+    if (k % 2 != 0) {
+        const Operand aLast = a.block(0, k - 1);
+        const Operand bLast = b.block(k - 1, 0);
+        gemm(2 * m2, 2 * n2, 1, 1.0, aLast.data, aLast.rowStride, aLast.colStride,
+             bLast.data, bLast.rowStride, bLast.colStride, 1.0, c, cs);
+    }
+    if (n % 2 != 0) {
+        const Operand bLast = b.block(0, n - 1);
+        gemm(m, 1, k, 1.0, a.data, a.rowStride, a.colStride,
+             bLast.data, bLast.rowStride, bLast.colStride, 0.0, c + n - 1, cs);
+    }
+    if (m % 2 != 0) {
+        const Operand aLast = a.block(m - 1, 0);
+        gemm(1, 2 * n2, k, 1.0, aLast.data, aLast.rowStride, aLast.colStride,
+             b.data, b.rowStride, b.colStride, 0.0, c + (m - 1) * cs, cs);
+    }
+}
+
+std::atomic<std::size_t> strassenCrossover{STRASSEN_CROSSOVER};
+
+} // namespace
+
+std::size_t strassenWorkspaceSize(std::size_t m, std::size_t n, std::size_t k, std::size_t crossover) {
+    std::size_t total = 0;
+    while (!isLeaf(m, n, k, crossover)) {
+        m /= 2;
+        n /= 2;
+        k /= 2;
+        total += levelWorkspace(m, n, k);
+    }
+    return total;
+}
+
+void strassen(std::size_t m, std::size_t n, std::size_t k,
+              const double* a, std::size_t aRowStride, std::size_t aColStride,
+              const double* b, std::size_t bRowStride, std::size_t bColStride,
+              double* c, std::size_t cRowStride, std::size_t crossover) {
+    if (m == 0 || n == 0) return;
+
+    std::vector<double, AlignedAllocator<double>> workspace;
+    workspace.resize(strassenWorkspaceSize(m, n, k, crossover));
+    multiplyRecursive(m, n, k, {a, aRowStride, aColStride}, {b, bRowStride, bColStride},
+                      c, cRowStride, workspace.data(), crossover);
+}
+
+void setStrassenCrossover(std::size_t size) {
+    strassenCrossover.store(std::max<std::size_t>(size, 2), std::memory_order_relaxed);
+}
+
+std::size_t getStrassenCrossover() {
+    return strassenCrossover.load(std::memory_order_relaxed);
+}
+
+} // namespace kernels
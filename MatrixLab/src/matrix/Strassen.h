@@ -0,0 +1,47 @@
+/**
+ * @file Strassen.h
+ * @brief Strassen-Winograd matrix multiplication over the blocked GEMM kernel
+ * @author Shchurko
+ * @date 2025
+ */
+
+#ifndef MATRIXLAB_STRASSEN_H
+#define MATRIXLAB_STRASSEN_H
+
+#include <cstddef>
+
+namespace kernels {
+
+// Рекурсия продолжается, пока наименьшая из сторон m, n, k не меньше
+// порога; дальше блоки умножает gemm
+constexpr std::size_t STRASSEN_CROSSOVER = 1024;
+
+/**
+ * @brief C = A * B по схеме Штрассена-Винограда
+ *
+ * Каждый уровень рекурсии заменяет 8 умножений блоков половинного
+ * размера на 7 умножений и 15 сложений. Нечётная строка, столбец и
+ * внутренний индекс досчитываются через gemm. Погрешность растёт с
+ * глубиной рекурсии быстрее, чем у обычного умножения: оценка нормы
+ * ошибки - c * n^log2(12) * eps * |A| * |B| вместо поэлементной оценки gemm.
+ *
+ * Рабочая память (три блока на уровень) выделяется одним буфером на
+ * весь вызов; уровни рекурсии занимают его по очереди. Операнды задаются
+ * шагами, как в gemm; C хранится по строкам с шагом cRowStride,
+ * его старое содержимое не читается.
+ */
+void strassen(std::size_t m, std::size_t n, std::size_t k,
+              const double* a, std::size_t aRowStride, std::size_t aColStride,
+              const double* b, std::size_t bRowStride, std::size_t bColStride,
+              double* c, std::size_t cRowStride, std::size_t crossover);
+
+// Размер рабочего буфера (в элементах), который использует strassen
+std::size_t strassenWorkspaceSize(std::size_t m, std::size_t n, std::size_t k, std::size_t crossover);
+
+// Порог перехода к gemm для RealMatrix::multiplyStrassen (не меньше 2)
+void setStrassenCrossover(std::size_t size);
+std::size_t getStrassenCrossover();
+
+} // namespace kernels
+
+#endif // MATRIXLAB_STRASSEN_H
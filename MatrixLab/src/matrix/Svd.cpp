@@ -0,0 +1,321 @@
+/**
+ * @file Svd.cpp
+ * @brief Implementation of the Jacobi and randomized singular value decompositions
+ * @author Shchurko
+ * @date 2025
+ */
+
+#include "Svd.h"
+#include "Factorization.h"
+#include "SimdKernels.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+
+namespace {
+
+// Циклов Якоби до отказа; на практике хватает 6-10
+constexpr std::size_t JACOBI_MAX_SWEEPS = 60;
+// Раунд вращений раздаётся потокам, начиная с этого числа элементов
+constexpr std::size_t JACOBI_PARALLEL_WORK = 1 << 15;
+
+constexpr double EPSILON = std::numeric_limits<double>::epsilon();
+
+// (x, y) <- (c x - s y, s x + c y)
+void rotateRows(double* x, double* y, std::size_t count, double c, double s) {
+    for (std::size_t k = 0; k < count; ++k) {
+        const double xk = x[k];
+        const double yk = y[k];
+        x[k] = c * xk - s * yk;
+        y[k] = s * xk + c * yk;
+    }
+}
+
+// Вращение, делающее строки wi и wj ортогональными (Хестенс); то же
+// вращение применяется к строкам vi и vj. alpha и beta - квадраты норм
+// строк, они пересчитываются без лишних проходов по памяти. Возвращает
+// false, если строки уже ортогональны с точностью tolerance или одна из
+// них на уровне погрешности округления (квадрат нормы не больше negligible).
+bool rotatePair(double* wi, double* wj, std::size_t length, double& alpha, double& beta,
+                double* vi, double* vj, std::size_t vLength, double tolerance, double negligible) {
+    if (alpha <= negligible || beta <= negligible) return false;
+    const double gamma = kernels::dot(wi, wj, length);
+    if (std::abs(gamma) <= tolerance * std::sqrt(alpha) * std::sqrt(beta)) return false;
+
+    // tan угла - меньший корень t^2 + 2 zeta t - 1 = 0; hypot не переполняется
+    const double zeta = (beta - alpha) / (2.0 * gamma);
+    const double t = std::copysign(1.0, zeta) / (std::abs(zeta) + std::hypot(1.0, zeta));
+    const double c = 1.0 / std::sqrt(1.0 + t * t);
+    const double s = c * t;
+    rotateRows(wi, wj, length, c, s);
+    rotateRows(vi, vj, vLength, c, s);
+
+    // Точные тождества для новых норм; при сильном сокращении (малые
+    // сингулярные числа) норма считается заново
+    const double newAlpha = alpha - t * gamma;
+    const double newBeta = beta + t * gamma;
+    alpha = newAlpha > 0.25 * alpha ? newAlpha : kernels::sumSquares(wi, length);
+    beta = newBeta > 0.25 * beta ? newBeta : kernels::sumSquares(wj, length);
+    return true;
+}
+
+// Односторонний метод Якоби над строками w: после сходимости строки
+// попарно ортогональны, а v (изначально I) накапливает вращения, так что
+// w_исходная = v^T w. Пары обходятся круговой таблицей: за раунд
+// каждая строка участвует не более чем в одной паре. Строки на уровне
+// погрешности округления в конце обнуляются.
+void orthogonalizeRows(RealMatrix& w, RealMatrix& v) {
+    const std::size_t count = w.getRows();
+    const std::size_t length = w.getCols();
+    const std::size_t vLength = v.getCols();
+    // При нечётном числе строк добавляется фиктивная - пропуск раунда
+    const std::size_t players = count + count % 2;
+    const std::size_t pairs = players / 2;
+    const double tolerance = std::sqrt(static_cast<double>(length)) * EPSILON;
+
+    double* wData = w.getData();
+    double* vData = v.getData();
+    const std::size_t wStride = w.getRowStride();
+    const std::size_t vStride = v.getRowStride();
+
+    std::vector<std::size_t> circle(players);
+    std::iota(circle.begin(), circle.end(), std::size_t{0});
+    std::vector<unsigned char> rotated(pairs, 0);
+    std::vector<double> squaredNorms(count);
+    // Строки короче eps ||w||_F - шум округления: вращения между ними
+    // не уточняют результат, а лишь добавляют циклы (как в LAPACK dgesvj)
+    double total = 0.0;
+    for (std::size_t i = 0; i < count; ++i) total += kernels::sumSquares(wData + i * wStride, length);
+    const double negligible = EPSILON * EPSILON * total;
+
+    const std::size_t tasks = pairs * (length + vLength) >= JACOBI_PARALLEL_WORK
+                                  ? std::min(ThreadPool::getGlobalThreadCount(), pairs)
+                                  : 1;
+    auto runPairs = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t p = begin; p < end; ++p) {
+            const std::size_t i = std::min(circle[p], circle[players - 1 - p]);
+            const std::size_t j = std::max(circle[p], circle[players - 1 - p]);
+            rotated[p] = j < count &&
+                         rotatePair(wData + i * wStride, wData + j * wStride, length,
+                                    squaredNorms[i], squaredNorms[j],
+                                    vData + i * vStride, vData + j * vStride, vLength,
+                                    tolerance, negligible);
+        }
+    };
+
+    for (std::size_t sweep = 0; sweep < JACOBI_MAX_SWEEPS; ++sweep) {
+        // Обновляемые нормы пересчитываются каждый цикл, чтобы не копить ошибку
+        for (std::size_t i = 0; i < count; ++i) {
+            squaredNorms[i] = kernels::sumSquares(wData + i * wStride, length);
+        }
+        bool anyRotation = false;
+        for (std::size_t round = 0; round + 1 < players; ++round) {
+            if (tasks > 1) {
+                ThreadPool::global()->parallelFor(tasks, [&](std::size_t t) {
+                    runPairs(pairs * t / tasks, pairs * (t + 1) / tasks);
+                });
+            } else {
+                runPairs(0, pairs);
+            }
+            anyRotation = anyRotation || std::any_of(rotated.begin(), rotated.end(),
+                                                     [](unsigned char r) { return r != 0; });
+            // Первый участник на месте, остальные сдвигаются по кругу
+            std::rotate(circle.begin() + 1, circle.end() - 1, circle.end());
+        }
+        if (!anyRotation) {
+            // Оставшийся шум обнуляется (изменение A не больше eps ||A||_F),
+            // чтобы векторы для таких строк достраивались ортонормированными
+            for (std::size_t i = 0; i < count; ++i) {
+                if (kernels::sumSquares(wData + i * wStride, length) <= negligible) {
+                    std::fill(wData + i * wStride, wData + i * wStride + length, 0.0);
+                }
+            }
+            return;
+        }
+    }
+    throw std::runtime_error("Jacobi SVD did not converge");
+}
+
+// Дополняет столбцы u с индексами from.. до ортонормированного набора
+// (для нулевых сингулярных чисел) ортогонализацией координатных векторов
+void completeOrthonormalColumns(RealMatrix& u, std::size_t from) {
+    const std::size_t rows = u.getRows();
+    std::vector<double> candidate(rows);
+    std::size_t basis = 0;
+    for (std::size_t col = from; col < u.getCols(); ++col) {
+        for (; basis < rows; ++basis) {
+            std::fill(candidate.begin(), candidate.end(), 0.0);
+            candidate[basis] = 1.0;
+            // Два прохода Грама-Шмидта
+            for (int pass = 0; pass < 2; ++pass) {
+                for (std::size_t k = 0; k < col; ++k) {
+                    double projection = 0.0;
+                    for (std::size_t r = 0; r < rows; ++r) projection += u.getValue(r, k) * candidate[r];
+                    for (std::size_t r = 0; r < rows; ++r) candidate[r] -= projection * u.getValue(r, k);
+                }
+            }
+            const double norm = std::sqrt(kernels::sumSquares(candidate.data(), rows));
+            if (norm > 0.5) {
+                for (std::size_t r = 0; r < rows; ++r) u.setValue(r, col, candidate[r] / norm);
+                ++basis;
+                break;
+            }
+        }
+    }
+}
+
+// Тонкое SVD матрицы m x n при m >= n. Предобработка (Drmac, Veselic):
+// столбцы упорядочиваются по убыванию нормы, A P = Q R, и вращения идут
+// по строкам R, т.е. по столбцам R^T = X diag(sigma) Y^T. Тогда
+// A = (Q Y) diag(sigma) (P X)^T, а на градуированных матрицах циклов
+// Якоби нужно в разы меньше, чем для столбцов самой A.
+void decomposeTall(const RealMatrix& matrix, RealMatrix& u, std::vector<double>& sigma, RealMatrix& v) {
+    const std::size_t m = matrix.getRows();
+    const std::size_t n = matrix.getCols();
+
+    std::vector<double> columnNorms(n, 0.0);
+    for (std::size_t i = 0; i < m; ++i) {
+        const double* row = matrix.getData() + i * matrix.getRowStride();
+        for (std::size_t j = 0; j < n; ++j) columnNorms[j] += row[j] * row[j];
+    }
+    std::vector<std::size_t> permutation(n);
+    std::iota(permutation.begin(), permutation.end(), std::size_t{0});
+    std::stable_sort(permutation.begin(), permutation.end(),
+                     [&](std::size_t a, std::size_t b) { return columnNorms[a] > columnNorms[b]; });
+    RealMatrix permuted(m, n);
+    for (std::size_t i = 0; i < m; ++i) {
+        const double* source = matrix.getData() + i * matrix.getRowStride();
+        double* target = permuted.getData() + i * permuted.getRowStride();
+        for (std::size_t j = 0; j < n; ++j) target[j] = source[permutation[j]];
+    }
+
+    const QRDecomposition qr(permuted);
+    RealMatrix w = qr.getR();
+    RealMatrix y = RealMatrix::createIdentity(n);
+    orthogonalizeRows(w, y);
+
+    std::vector<double> norms(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        norms[i] = std::sqrt(kernels::sumSquares(w.getData() + i * w.getRowStride(), n));
+    }
+    std::vector<std::size_t> order(n);
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::stable_sort(order.begin(), order.end(),
+                     [&](std::size_t a, std::size_t b) { return norms[a] > norms[b]; });
+
+    sigma.resize(n);
+    RealMatrix left(n, n);
+    RealMatrix right(n, n);
+    std::size_t nonZero = 0;
+    for (std::size_t k = 0; k < n; ++k) {
+        const std::size_t source = order[k];
+        sigma[k] = norms[source];
+        if (sigma[k] > 0.0) {
+            ++nonZero;
+            for (std::size_t r = 0; r < n; ++r) right.setValue(r, k, w.getValue(source, r) / sigma[k]);
+        }
+        for (std::size_t r = 0; r < n; ++r) left.setValue(r, k, y.getValue(source, r));
+    }
+    completeOrthonormalColumns(right, nonZero);
+
+    u = RealMatrix::multiply(qr.getQ().view(), left.view());
+    v = RealMatrix(n, n);
+    for (std::size_t r = 0; r < n; ++r) {
+        for (std::size_t k = 0; k < n; ++k) v.setValue(permutation[r], k, right.getValue(r, k));
+    }
+}
+
+// Матрица rows x cols из стандартного нормального распределения
+// (Бокс-Мюллер поверх mt19937_64: одинакова на всех платформах)
+RealMatrix makeGaussianMatrix(std::size_t rows, std::size_t cols, std::uint64_t seed) {
+    std::mt19937_64 generator(seed);
+    const double scale = 1.0 / 9007199254740992.0;  // 2^-53
+    auto uniform = [&]() { return (static_cast<double>(generator() >> 11) + 0.5) * scale; };
+    const double twoPi = 6.283185307179586;
+
+    RealMatrix result(rows, cols);
+    double* data = result.getData();
+    const std::size_t stride = result.getRowStride();
+    for (std::size_t i = 0; i < rows; ++i) {
+        for (std::size_t j = 0; j < cols; j += 2) {
+            const double radius = std::sqrt(-2.0 * std::log(uniform()));
+            const double angle = twoPi * uniform();
+            data[i * stride + j] = radius * std::cos(angle);
+            if (j + 1 < cols) data[i * stride + j + 1] = radius * std::sin(angle);
+        }
+    }
+    return result;
+}
+
+RealMatrix orthonormalBasis(const RealMatrix& columns) {
+    return QRDecomposition(columns).getQ();
+}
+
+} // namespace
+
+SingularValueDecomposition::SingularValueDecomposition(const RealMatrix& matrix) {
+    if (matrix.getRows() >= matrix.getCols()) {
+        decomposeTall(matrix, leftVectors, singularValues, rightVectors);
+    } else {
+        // A^T = U' S V'^T, значит A = V' S U'^T
+        decomposeTall(matrix.computeTranspose(), rightVectors, singularValues, leftVectors);
+    }
+}
+
+SingularValueDecomposition SingularValueDecomposition::computeRandomized(const RealMatrix& matrix,
+                                                                         std::size_t rank,
+                                                                         std::size_t oversampling,
+                                                                         std::size_t powerIterations,
+                                                                         std::uint64_t seed) {
+    const std::size_t m = matrix.getRows();
+    const std::size_t n = matrix.getCols();
+    const std::size_t limit = std::min(m, n);
+    if (rank == 0 || rank > limit) {
+        throw std::invalid_argument("Rank must be between 1 and min(rows, cols)");
+    }
+    const std::size_t samples = std::min(limit, rank + oversampling);
+
+    // Базис Q приближённого образа A (m x samples)
+    const RealMatrix omega = makeGaussianMatrix(n, samples, seed);
+    RealMatrix q = orthonormalBasis(RealMatrix::multiply(matrix.view(), omega.view()));
+    for (std::size_t iteration = 0; iteration < powerIterations; ++iteration) {
+        // Ортонормировка после каждого умножения не даёт малым
+        // направлениям потеряться на фоне старших
+        const RealMatrix z = orthonormalBasis(RealMatrix::multiply(matrix.transposedView(), q.view()));
+        q = orthonormalBasis(RealMatrix::multiply(matrix.view(), z.view()));
+    }
+
+    // A ~ Q (Q^T A); малая матрица samples x n раскладывается точно
+    const SingularValueDecomposition projected(RealMatrix::multiply(q.transposedView(), matrix.view()));
+
+    SingularValueDecomposition result;
+    result.singularValues.assign(projected.singularValues.begin(), projected.singularValues.begin() + rank);
+    result.leftVectors = RealMatrix::multiply(q.view(), projected.leftVectors.view(0, 0, samples, rank));
+    result.rightVectors = projected.rightVectors.extractSubmatrix(0, 0, n, rank);
+    return result;
+}
+
+std::vector<double> SingularValueDecomposition::getSingularValues() const {
+    return singularValues;
+}
+
+RealMatrix SingularValueDecomposition::getU() const {
+    return leftVectors;
+}
+
+RealMatrix SingularValueDecomposition::getV() const {
+    return rightVectors;
+}
+
+RealMatrix SingularValueDecomposition::reconstruct() const {
+    RealMatrix scaled(leftVectors);
+    for (std::size_t i = 0; i < scaled.getRows(); ++i) {
+        double* row = scaled.getData() + i * scaled.getRowStride();
+        for (std::size_t k = 0; k < singularValues.size(); ++k) row[k] *= singularValues[k];
+    }
+    return RealMatrix::multiply(scaled.view(), rightVectors.transposedView());
+}
@@ -0,0 +1,72 @@
+/**
+ * @file Svd.h
+ * @brief Singular value decomposition: one-sided Jacobi and randomized top-k
+ * @author Shchurko
+ * @date 2025
+ */
+
+#ifndef MATRIXLAB_SVD_H
+#define MATRIXLAB_SVD_H
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include "Matrix.h"
+
+/**
+ * @brief Сингулярное разложение A = U diag(sigma) V^T (тонкое)
+ *
+ * Полное разложение m x n (m >= n, иначе раскладывается A^T) считается
+ * односторонним методом Якоби с предобработкой QR: столбцы A
+ * упорядочиваются по убыванию нормы, A P = Q R, и вращения применяются к
+ * строкам R (n x n). Раунды вращений идут в порядке круговой таблицы:
+ * пары в раунде не пересекаются и при достаточной работе раздаются
+ * потокам общего пула, а результат от числа потоков не зависит.
+ * Стоимость - O(m n^2) на QR и O(n^3) за каждый цикл Якоби; циклов
+ * обычно около десяти. Сингулярные числа ниже eps ||A||_F обнуляются.
+ *
+ * Для больших матриц, где нужны только первые k компонент, есть
+ * computeRandomized: он обращается к A всего 2 + 2 * powerIterations раз,
+ * и каждое обращение - умножение через kernels::gemm.
+ */
+class SingularValueDecomposition {
+public:
+    explicit SingularValueDecomposition(const RealMatrix& matrix);
+
+    /**
+     * @brief Первые rank сингулярных троек рандомизированным методом
+     * (Halko, Martinsson, Tropp)
+     *
+     * A умножается на гауссову матрицу n x (rank + oversampling), базис
+     * образа уточняется powerIterations шагами степенного метода с
+     * ортонормировкой, после чего точно раскладывается малая матрица
+     * Q^T A. Погрешность близка к sigma_{rank+1}; при быстро убывающем
+     * спектре хватает oversampling = 10 и одной-двух итераций. Одно и то
+     * же seed даёт один и тот же результат. Бросает std::invalid_argument,
+     * если rank = 0 или больше min(rows, cols).
+     */
+    static SingularValueDecomposition computeRandomized(const RealMatrix& matrix, std::size_t rank,
+                                                        std::size_t oversampling = 10,
+                                                        std::size_t powerIterations = 2,
+                                                        std::uint64_t seed = 0);
+
+    // Сингулярные числа по убыванию
+    std::vector<double> getSingularValues() const;
+
+    // Левые (m x r) и правые (n x r) сингулярные векторы по столбцам;
+    // r = min(m, n) для полного разложения и rank для усечённого
+    RealMatrix getU() const;
+    RealMatrix getV() const;
+
+    // U diag(sigma) V^T; для усечённого разложения - приближение ранга rank
+    RealMatrix reconstruct() const;
+
+private:
+    SingularValueDecomposition() = default;
+
+    RealMatrix leftVectors;
+    std::vector<double> singularValues;
+    RealMatrix rightVectors;
+};
+
+#endif // MATRIXLAB_SVD_H
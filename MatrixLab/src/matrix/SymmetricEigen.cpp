@@ -0,0 +1,669 @@
+/**
+ * @file SymmetricEigen.cpp
+ * @brief Implementation of the symmetric eigensolver
+ * @author Shchurko
+ * @date 2025
+ */
+
+#include "SymmetricEigen.h"
+#include "Factorization.h"
+#include "Gemm.h"
+#include "Gemv.h"
+#include "SimdKernels.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+namespace {
+
+// Подзадачи «разделяй и властвуй» не больше этого размера решаются QL
+constexpr std::size_t EIGEN_LEAF_SIZE = 32;
+// Итераций QL на одно собственное значение
+constexpr std::size_t QL_MAX_ITERATIONS = 30;
+constexpr std::size_t SECULAR_MAX_ITERATIONS = 100;
+// Столбцов собственных векторов, собираемых за один вызов gemm при слиянии
+constexpr std::size_t MERGE_COLUMN_BLOCK = 256;
+
+constexpr double EPSILON = std::numeric_limits<double>::epsilon();
+
+// Части строк, в которых у столбца Q при слиянии могут быть ненулевые элементы
+constexpr unsigned char PART_TOP = 1;
+constexpr unsigned char PART_BOTTOM = 2;
+
+// ==================== Приведение к трёхдиагональному виду ====================
+
+// Приводит симметричную A к трёхдиагональной T = Q^T A Q (LAPACK dsytrd).
+// Используется и обновляется только верхний треугольник. Отражение шага j
+// H_j = I - tau[j] v v^T действует на индексы j+1..n-1; v[j+1] = 1, остальное
+// хранится в строке j правее диагонали (A[j][j+1] = 1).
+//
+// Внутри панели обновление A22 -= V W^T + W V^T откладывается: очередная
+// строка обновляется перед своим шагом (gemv), а произведение A22 v берётся
+// по необновлённой матрице с поправкой через уже накопленные V и W. После
+// панели остаток обновляется одним gemm ранга 2 nb по блокам строк
+void reduceToTridiagonal(RealMatrix& matrix, std::vector<double>& diagonal,
+                         std::vector<double>& offDiagonal, std::vector<double>& tau) {
+    const std::size_t n = matrix.getRows();
+    const std::size_t lda = matrix.getRowStride();
+    double* a = matrix.getData();
+    diagonal.assign(n, 0.0);
+    offDiagonal.assign(n > 0 ? n - 1 : 0, 0.0);
+    tau.assign(n > 0 ? n - 1 : 0, 0.0);
+
+    std::vector<double> vPanel, wPanel, left, right, y, coefficients;
+    for (std::size_t k0 = 0; k0 < n; k0 += FACTORIZATION_BLOCK) {
+        const std::size_t nb = std::min(FACTORIZATION_BLOCK, n - k0);
+        // V и W: строки k0..n-1 (локальный номер r - k0), nb столбцов
+        vPanel.assign((n - k0) * nb, 0.0);
+        wPanel.assign((n - k0) * nb, 0.0);
+
+        for (std::size_t c = 0; c < nb; ++c) {
+            const std::size_t j = k0 + c;
+            double* rowJ = a + j * lda;
+            if (c > 0) {
+                // A[j, j:n] -= W[j:n, :c] V[j, :c]^T + V[j:n, :c] W[j, :c]^T
+                const double* vRows = vPanel.data() + (j - k0) * nb;
+                const double* wRows = wPanel.data() + (j - k0) * nb;
+                kernels::gemv(n - j, c, -1.0, wRows, nb, vRows, 1.0, rowJ + j);
+                kernels::gemv(n - j, c, -1.0, vRows, nb, wRows, 1.0, rowJ + j);
+            }
+            diagonal[j] = rowJ[j];
+            if (j + 1 == n) break;
+
+            // Отражение, обнуляющее A[j, j+2:n]
+            double* x = rowJ + j + 1;
+            const std::size_t len = n - j - 1;
+            const double alpha = x[0];
+            const double sigma = len > 1 ? kernels::sumSquares(x + 1, len - 1) : 0.0;
+            if (sigma == 0.0) {
+                tau[j] = 0.0;
+                offDiagonal[j] = alpha;
+            } else {
+                const double beta = -std::copysign(std::sqrt(alpha * alpha + sigma), alpha);
+                tau[j] = (beta - alpha) / beta;
+                kernels::scale(x + 1, 1.0 / (alpha - beta), x + 1, len - 1);
+                offDiagonal[j] = beta;
+            }
+            x[0] = 1.0;
+
+            double* vColumn = vPanel.data() + (j + 1 - k0) * nb + c;
+            for (std::size_t i = 0; i < len; ++i) {
+                vColumn[i * nb] = x[i];
+            }
+            if (tau[j] == 0.0) continue;
+
+            // y = A22 v - V (W^T v) - W (V^T v) по строкам j+1..n-1
+            y.resize(len);
+            kernels::symvUpper(len, 1.0, a + (j + 1) * lda + j + 1, lda, x, 0.0, y.data());
+            if (c > 0) {
+                const double* vRows = vPanel.data() + (j + 1 - k0) * nb;
+                const double* wRows = wPanel.data() + (j + 1 - k0) * nb;
+                coefficients.resize(2 * c);
+                kernels::gemvTransposed(len, c, 1.0, wRows, nb, x, 0.0, coefficients.data());
+                kernels::gemvTransposed(len, c, 1.0, vRows, nb, x, 0.0, coefficients.data() + c);
+                kernels::gemv(len, c, -1.0, vRows, nb, coefficients.data(), 1.0, y.data());
+                kernels::gemv(len, c, -1.0, wRows, nb, coefficients.data() + c, 1.0, y.data());
+            }
+
+            // w = tau y - (tau^2 / 2) (y^T v) v, тогда H A22 H = A22 - v w^T - w v^T
+            kernels::scale(y.data(), tau[j], y.data(), len);
+            const double correction = -0.5 * tau[j] * kernels::dot(y.data(), x, len);
+            kernels::axpy(correction, x, y.data(), len);
+            double* wColumn = wPanel.data() + (j + 1 - k0) * nb + c;
+            for (std::size_t i = 0; i < len; ++i) {
+                wColumn[i * nb] = y[i];
+            }
+        }
+
+        const std::size_t trailingStart = k0 + nb;
+        if (trailingStart >= n) break;
+
+        // A22 -= [V W] [W V]^T: блоки строк от диагонали вправо
+        const std::size_t trailing = n - trailingStart;
+        const std::size_t width = 2 * nb;
+        left.resize(trailing * width);
+        right.resize(trailing * width);
+        for (std::size_t i = 0; i < trailing; ++i) {
+            const double* vRow = vPanel.data() + (nb + i) * nb;
+            const double* wRow = wPanel.data() + (nb + i) * nb;
+            std::copy(vRow, vRow + nb, left.data() + i * width);
+            std::copy(wRow, wRow + nb, left.data() + i * width + nb);
+            std::copy(wRow, wRow + nb, right.data() + i * width);
+            std::copy(vRow, vRow + nb, right.data() + i * width + nb);
+        }
+        for (std::size_t ib = 0; ib < trailing; ib += FACTORIZATION_BLOCK) {
+            const std::size_t mb = std::min(FACTORIZATION_BLOCK, trailing - ib);
+            kernels::gemm(mb, trailing - ib, width, -1.0,
+                          left.data() + ib * width, width, 1,
+                          right.data() + ib * width, 1, width,
+                          1.0, a + (trailingStart + ib) * lda + trailingStart + ib, lda);
+        }
+    }
+}
+
+// Z = Q Z, где Q = H_0 H_1 ... H_{n-2} из reduceToTridiagonal. Отражения
+// применяются блоками с конца в компактном WY-представлении
+// H_k0 ... H_{k0+nb-1} = I - V T V^T, так что основная работа идёт в gemm
+void applyReflectors(const RealMatrix& reduced, const std::vector<double>& tau, RealMatrix& z) {
+    const std::size_t n = reduced.getRows();
+    const std::size_t reflectors = tau.size();
+    if (reflectors == 0) return;
+    const std::size_t lda = reduced.getRowStride();
+    const double* a = reduced.getData();
+    const std::size_t ldz = z.getRowStride();
+
+    std::vector<double> vPanel, tMatrix, projection, work;
+    std::size_t k0 = (reflectors - 1) / FACTORIZATION_BLOCK * FACTORIZATION_BLOCK;
+    while (true) {
+        const std::size_t nb = std::min(FACTORIZATION_BLOCK, reflectors - k0);
+        // Строки k0+1..n-1; V[i][c] - элемент v_{k0+c} в строке k0+1+i
+        const std::size_t rows = n - k0 - 1;
+        vPanel.assign(rows * nb, 0.0);
+        for (std::size_t c = 0; c < nb; ++c) {
+            const double* source = a + (k0 + c) * lda + k0 + 1;
+            for (std::size_t i = c; i < rows; ++i) {
+                vPanel[i * nb + c] = source[i];
+            }
+        }
+
+        // T[0:c, c] = -tau_c T[0:c, 0:c] (V[:, 0:c]^T v_c), T[c][c] = tau_c
+        tMatrix.assign(nb * nb, 0.0);
+        for (std::size_t c = 0; c < nb; ++c) {
+            projection.assign(c, 0.0);
+            for (std::size_t i = c; i < rows; ++i) {
+                const double vc = vPanel[i * nb + c];
+                for (std::size_t p = 0; p < c; ++p) {
+                    projection[p] += vPanel[i * nb + p] * vc;
+                }
+            }
+            for (std::size_t p = 0; p < c; ++p) {
+                double value = 0.0;
+                for (std::size_t q = p; q < c; ++q) {
+                    value += tMatrix[p * nb + q] * projection[q];
+                }
+                tMatrix[p * nb + c] = -tau[k0 + c] * value;
+            }
+            tMatrix[c * nb + c] = tau[k0 + c];
+        }
+
+        // Z2 -= V (T (V^T Z2))
+        double* z2 = z.getData() + (k0 + 1) * ldz;
+        work.assign(nb * n, 0.0);
+        kernels::gemm(nb, n, rows, 1.0, vPanel.data(), 1, nb, z2, ldz, 1, 0.0, work.data(), n);
+        for (std::size_t i = 0; i < nb; ++i) {
+            double* target = work.data() + i * n;
+            kernels::scale(target, tMatrix[i * nb + i], target, n);
+            for (std::size_t q = i + 1; q < nb; ++q) {
+                const double factor = tMatrix[i * nb + q];
+                if (factor != 0.0) {
+                    kernels::axpy(factor, work.data() + q * n, target, n);
+                }
+            }
+        }
+        kernels::gemm(rows, n, nb, -1.0, vPanel.data(), nb, 1, work.data(), n, 1, 1.0, z2, ldz);
+
+        if (k0 == 0) break;
+        k0 -= FACTORIZATION_BLOCK;
+    }
+}
+
+// ==================== Трёхдиагональная задача ====================
+
+// Неявный QL со сдвигами Уилкинсона (tql2). offDiagonal длины n, последний
+// элемент служебный. Если z задана, вращения накапливаются в её столбцах
+void tridiagonalQL(std::size_t n, double* diagonal, double* offDiagonal, double* z, std::size_t ldz) {
+    if (n == 0) return;
+    double* d = diagonal;
+    double* e = offDiagonal;
+    e[n - 1] = 0.0;
+
+    // Масштаб для проверки малости e[m] - наибольшая |d| + |e| по пройденным
+    // строкам, как в tql2: чисто локальный критерий не срабатывает на
+    // блоках из шума округления (почти вырожденная матрица)
+    double scale = 0.0;
+    for (std::size_t l = 0; l < n; ++l) {
+        scale = std::max(scale, std::abs(d[l]) + std::abs(e[l]));
+        std::size_t iterations = 0;
+        while (true) {
+            // Ищем пренебрежимо малый e[m]: блок l..m отщепляется
+            std::size_t m = l;
+            for (; m + 1 < n; ++m) {
+                if (std::abs(e[m]) <= EPSILON * scale) break;
+            }
+            if (m == l) break;
+            if (++iterations > QL_MAX_ITERATIONS) {
+                throw std::runtime_error("Eigenvalue iteration did not converge");
+            }
+
+            double g = (d[l + 1] - d[l]) / (2.0 * e[l]);
+            double r = std::hypot(g, 1.0);
+            g = d[m] - d[l] + e[l] / (g + std::copysign(r, g));
+            double s = 1.0;
+            double c = 1.0;
+            double p = 0.0;
+            bool restarted = false;
+            for (std::size_t i = m; i-- > l;) {
+                double f = s * e[i];
+                const double b = c * e[i];
+                r = std::hypot(f, g);
+                e[i + 1] = r;
+                if (r == 0.0) {
+                    // Исчезновение порядка: блок распался, сдвиг повторяется
+                    d[i + 1] -= p;
+                    e[m] = 0.0;
+                    restarted = true;
+                    break;
+                }
+                s = f / r;
+                c = g / r;
+                g = d[i + 1] - p;
+                r = (d[i] - g) * s + 2.0 * c * b;
+                p = s * r;
+                d[i + 1] = g + p;
+                g = c * r - b;
+                if (z != nullptr) {
+                    for (std::size_t k = 0; k < n; ++k) {
+                        double* row = z + k * ldz;
+                        f = row[i + 1];
+                        row[i + 1] = s * row[i] + c * f;
+                        row[i] = c * row[i] - s * f;
+                    }
+                }
+            }
+            if (restarted) continue;
+            d[l] -= p;
+            e[l] = g;
+            e[m] = 0.0;
+        }
+    }
+}
+
+// Упорядочивает значения по возрастанию вместе со столбцами z (n x n)
+void sortEigenpairs(std::size_t n, double* d, double* z, std::size_t ldz) {
+    for (std::size_t i = 0; i < n; ++i) {
+        const std::size_t k = static_cast<std::size_t>(std::min_element(d + i, d + n) - d);
+        if (k == i) continue;
+        std::swap(d[i], d[k]);
+        for (std::size_t r = 0; r < n; ++r) {
+            std::swap(z[r * ldz + i], z[r * ldz + k]);
+        }
+    }
+}
+
+// i-й корень уравнения 1 + rho * sum_j z_j^2 / (d_j - lambda) = 0 (d строго
+// возрастают, rho > 0; корень i лежит в (d_i, d_{i+1}), последний - правее d_k-1).
+// Корень возвращается как lambda = d[origin] + shift от ближайшего полюса:
+// тогда d_j - lambda = (d_j - d[origin]) - shift считается без вычитания
+// близких чисел, от чего зависит ортогональность векторов. Шаг - корень
+// модели с двумя ближайшими полюсами, при выходе из вилки - деление пополам
+void solveSecular(std::size_t k, std::size_t i, const double* d, const double* z, double rho,
+                  std::size_t& origin, double& shift) {
+    const bool last = i + 1 == k;
+    double lower;
+    double upper;
+    if (last) {
+        origin = i;
+        lower = 0.0;
+        upper = rho * kernels::sumSquares(z, k);
+    } else {
+        const double half = 0.5 * (d[i + 1] - d[i]);
+        double f = 1.0;
+        for (std::size_t j = 0; j < k; ++j) {
+            f += rho * z[j] * z[j] / ((d[j] - d[i]) - half);
+        }
+        if (f >= 0.0) {
+            origin = i;
+            lower = 0.0;
+            upper = half;
+        } else {
+            origin = i + 1;
+            lower = (d[i] - d[i + 1]) + half;
+            upper = 0.0;
+        }
+    }
+
+    const double base = d[origin];
+    shift = 0.5 * (lower + upper);
+    for (std::size_t iteration = 0; iteration < SECULAR_MAX_ITERATIONS; ++iteration) {
+        // psi - полюса слева от корня (j <= i), phi - справа
+        double psi = 0.0, psiDerivative = 0.0, phi = 0.0, phiDerivative = 0.0;
+        for (std::size_t j = 0; j <= i; ++j) {
+            const double term = z[j] / ((d[j] - base) - shift);
+            psi += z[j] * term;
+            psiDerivative += term * term;
+        }
+        for (std::size_t j = i + 1; j < k; ++j) {
+            const double term = z[j] / ((d[j] - base) - shift);
+            phi += z[j] * term;
+            phiDerivative += term * term;
+        }
+        const double f = 1.0 + rho * (psi + phi);
+        if (f < 0.0) {
+            lower = shift;
+        } else {
+            upper = shift;
+        }
+        const double error = 8.0 * EPSILON * static_cast<double>(k) * (1.0 + rho * (std::abs(psi) + std::abs(phi)));
+        if (std::abs(f) <= error || upper - lower <= 4.0 * EPSILON * std::max(std::abs(lower), std::abs(upper))) {
+            break;
+        }
+
+        // Модель c + s / (deltaI - h) + s2 / (deltaNext - h) с той же
+        // производной, что у f; для последнего корня полюс один
+        const double deltaI = (d[i] - base) - shift;
+        const double s = rho * psiDerivative * deltaI * deltaI;
+        double step = 0.0;
+        bool haveStep = false;
+        if (last) {
+            const double c = f - s / deltaI;
+            if (c > 0.0) {
+                step = deltaI + s / c;
+                haveStep = true;
+            }
+        } else {
+            const double deltaNext = (d[i + 1] - base) - shift;
+            const double s2 = rho * phiDerivative * deltaNext * deltaNext;
+            const double c = f - s / deltaI - s2 / deltaNext;
+            // c h^2 - a h + b = 0; корень модели в (deltaI, deltaNext) единственный
+            const double a = c * (deltaI + deltaNext) + s + s2;
+            const double b = c * deltaI * deltaNext + s * deltaNext + s2 * deltaI;
+            if (c == 0.0) {
+                if (a != 0.0) {
+                    step = b / a;
+                    haveStep = true;
+                }
+            } else {
+                const double q = 0.5 * (a + std::copysign(std::sqrt(std::max(0.0, a * a - 4.0 * b * c)), a));
+                const double first = q / c;
+                const double second = q != 0.0 ? b / q : first;
+                if (first > deltaI && first < deltaNext) {
+                    step = first;
+                    haveStep = true;
+                } else if (second > deltaI && second < deltaNext) {
+                    step = second;
+                    haveStep = true;
+                }
+            }
+        }
+
+        double next = shift + step;
+        if (!haveStep || !(next > lower && next < upper)) {
+            next = 0.5 * (lower + upper);
+        }
+        if (next == shift) break;
+        shift = next;
+    }
+}
+
+// Слияние двух решённых половин (LAPACK dlaed1-dlaed3). На входе d[0:n1] и
+// d[n1:n] - собственные значения T1 и T2, блок q - diag(Q1, Q2); T =
+// diag(T1, T2) + |rho| u u^T с u = e_{n1-1} + sign(rho) e_{n1}. На выходе d -
+// значения T по возрастанию, q - её собственные векторы
+void mergeSubproblems(std::size_t n, std::size_t n1, double* d, double* q, std::size_t ldq, double rho) {
+    const std::size_t n2 = n - n1;
+
+    // z = diag(Q1, Q2)^T u / sqrt(2): последняя строка Q1 и первая строка Q2
+    const double inverseRoot = 1.0 / std::sqrt(2.0);
+    const double sign = rho < 0.0 ? -1.0 : 1.0;
+    std::vector<double> z(n);
+    for (std::size_t i = 0; i < n1; ++i) {
+        z[i] = q[(n1 - 1) * ldq + i] * inverseRoot;
+    }
+    for (std::size_t i = 0; i < n2; ++i) {
+        z[n1 + i] = sign * q[n1 * ldq + n1 + i] * inverseRoot;
+    }
+    const double weight = 2.0 * std::abs(rho);
+
+    std::vector<std::size_t> order(n);
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::stable_sort(order.begin(), order.end(), [&](std::size_t x, std::size_t y) { return d[x] < d[y]; });
+    std::vector<double> poles(n), weights(n);
+    std::vector<std::size_t> columns(n);
+    std::vector<unsigned char> parts(n);
+    double poleMax = 0.0;
+    double weightMax = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        poles[i] = d[order[i]];
+        weights[i] = z[order[i]];
+        columns[i] = order[i];
+        parts[i] = order[i] < n1 ? PART_TOP : PART_BOTTOM;
+        poleMax = std::max(poleMax, std::abs(poles[i]));
+        weightMax = std::max(weightMax, std::abs(weights[i]));
+    }
+
+    // Отделение: малый вес - значение и вектор не меняются; два близких
+    // полюса - вращение обнуляет вес одного из них
+    const double tolerance = 8.0 * EPSILON * std::max(poleMax, weightMax);
+    std::vector<std::size_t> kept, deflated;
+    std::size_t previous = n;
+    for (std::size_t j = 0; j < n; ++j) {
+        if (weight * std::abs(weights[j]) <= tolerance) {
+            deflated.push_back(j);
+            continue;
+        }
+        if (previous == n) {
+            previous = j;
+            continue;
+        }
+        const double r = std::hypot(weights[j], weights[previous]);
+        const double c = weights[j] / r;
+        const double s = -weights[previous] / r;
+        if (std::abs((poles[j] - poles[previous]) * c * s) <= tolerance) {
+            weights[j] = r;
+            weights[previous] = 0.0;
+            double* x = q + columns[previous];
+            double* y = q + columns[j];
+            for (std::size_t row = 0; row < n; ++row) {
+                const double xv = x[row * ldq];
+                const double yv = y[row * ldq];
+                x[row * ldq] = c * xv + s * yv;
+                y[row * ldq] = c * yv - s * xv;
+            }
+            const double deflatedPole = poles[previous] * c * c + poles[j] * s * s;
+            poles[j] = poles[previous] * s * s + poles[j] * c * c;
+            poles[previous] = deflatedPole;
+            parts[j] = parts[previous] = static_cast<unsigned char>(parts[j] | parts[previous]);
+            deflated.push_back(previous);
+        } else {
+            kept.push_back(previous);
+        }
+        previous = j;
+    }
+    if (previous != n) {
+        kept.push_back(previous);
+    }
+
+    // Секулярное уравнение для оставшихся k полюсов
+    const std::size_t k = kept.size();
+    std::vector<double> keptPoles(k), keptWeights(k), shifts(k);
+    std::vector<std::size_t> origins(k);
+    for (std::size_t i = 0; i < k; ++i) {
+        keptPoles[i] = poles[kept[i]];
+        keptWeights[i] = weights[kept[i]];
+    }
+    for (std::size_t i = 0; i < k; ++i) {
+        solveSecular(k, i, keptPoles.data(), keptWeights.data(), weight, origins[i], shifts[i]);
+    }
+    // lambda_i - d_j
+    auto rootMinusPole = [&](std::size_t i, std::size_t j) {
+        return shifts[i] - (keptPoles[j] - keptPoles[origins[i]]);
+    };
+
+    // Веса, для которых найденные корни точные (Гу-Айзенштат, теорема Лёвнера)
+    std::vector<double> exactWeights(k);
+    for (std::size_t j = 0; j < k; ++j) {
+        double product = rootMinusPole(k - 1, j) / weight;
+        for (std::size_t i = 0; i < j; ++i) {
+            product *= rootMinusPole(i, j) / (keptPoles[i] - keptPoles[j]);
+        }
+        for (std::size_t i = j; i + 1 < k; ++i) {
+            product *= rootMinusPole(i, j) / (keptPoles[i + 1] - keptPoles[j]);
+        }
+        exactWeights[j] = std::copysign(std::sqrt(std::abs(product)), keptWeights[j]);
+    }
+
+    // Итоговый порядок: корни уже возрастают, отделённые значения сортируются
+    std::sort(deflated.begin(), deflated.end(), [&](std::size_t x, std::size_t y) { return poles[x] < poles[y]; });
+    std::vector<std::size_t> keptTarget(k), deflatedTarget(deflated.size());
+    {
+        std::size_t i = 0;
+        std::size_t t = 0;
+        for (std::size_t position = 0; position < n; ++position) {
+            const bool takeRoot = t == deflated.size() ||
+                                  (i < k && keptPoles[origins[i]] + shifts[i] <= poles[deflated[t]]);
+            if (takeRoot) {
+                d[position] = keptPoles[origins[i]] + shifts[i];
+                keptTarget[i++] = position;
+            } else {
+                d[position] = poles[deflated[t]];
+                deflatedTarget[t++] = position;
+            }
+        }
+    }
+
+    // Копии нужных столбцов q до перезаписи: ненулевые части векторов
+    // сохранившихся полюсов (верх и низ отдельно) и отделённые векторы
+    std::vector<std::size_t> topIndices, bottomIndices;
+    for (std::size_t i = 0; i < k; ++i) {
+        if (parts[kept[i]] & PART_TOP) topIndices.push_back(i);
+        if (parts[kept[i]] & PART_BOTTOM) bottomIndices.push_back(i);
+    }
+    const std::size_t kt = topIndices.size();
+    const std::size_t kb = bottomIndices.size();
+    std::vector<double> qTop(n1 * kt), qBottom(n2 * kb), qDeflated(n * deflated.size());
+    for (std::size_t r = 0; r < n1; ++r) {
+        for (std::size_t t = 0; t < kt; ++t) {
+            qTop[r * kt + t] = q[r * ldq + columns[kept[topIndices[t]]]];
+        }
+    }
+    for (std::size_t r = 0; r < n2; ++r) {
+        for (std::size_t t = 0; t < kb; ++t) {
+            qBottom[r * kb + t] = q[(n1 + r) * ldq + columns[kept[bottomIndices[t]]]];
+        }
+    }
+    const std::size_t nd = deflated.size();
+    for (std::size_t r = 0; r < n; ++r) {
+        for (std::size_t t = 0; t < nd; ++t) {
+            qDeflated[r * nd + t] = q[r * ldq + columns[deflated[t]]];
+        }
+    }
+
+    for (std::size_t r = 0; r < n; ++r) {
+        for (std::size_t t = 0; t < nd; ++t) {
+            q[r * ldq + deflatedTarget[t]] = qDeflated[r * nd + t];
+        }
+    }
+
+    // Векторы D + rho z z^T: v_j = z_j / (d_j - lambda_i); в базис T они
+    // переводятся умножением на верхнюю и нижнюю части Q по блокам столбцов
+    std::vector<double> vector(k), vTop, vBottom, result;
+    for (std::size_t i0 = 0; i0 < k; i0 += MERGE_COLUMN_BLOCK) {
+        const std::size_t width = std::min(MERGE_COLUMN_BLOCK, k - i0);
+        vTop.assign(kt * width, 0.0);
+        vBottom.assign(kb * width, 0.0);
+        result.assign(n * width, 0.0);
+        for (std::size_t c = 0; c < width; ++c) {
+            const std::size_t i = i0 + c;
+            for (std::size_t j = 0; j < k; ++j) {
+                vector[j] = -exactWeights[j] / rootMinusPole(i, j);
+            }
+            const double inverseNorm = 1.0 / std::sqrt(kernels::sumSquares(vector.data(), k));
+            for (std::size_t t = 0; t < kt; ++t) {
+                vTop[t * width + c] = vector[topIndices[t]] * inverseNorm;
+            }
+            for (std::size_t t = 0; t < kb; ++t) {
+                vBottom[t * width + c] = vector[bottomIndices[t]] * inverseNorm;
+            }
+        }
+        if (kt > 0) {
+            kernels::gemm(n1, width, kt, 1.0, qTop.data(), kt, 1, vTop.data(), width, 1,
+                          0.0, result.data(), width);
+        }
+        if (kb > 0) {
+            kernels::gemm(n2, width, kb, 1.0, qBottom.data(), kb, 1, vBottom.data(), width, 1,
+                          0.0, result.data() + n1 * width, width);
+        }
+        for (std::size_t r = 0; r < n; ++r) {
+            for (std::size_t c = 0; c < width; ++c) {
+                q[r * ldq + keptTarget[i0 + c]] = result[r * width + c];
+            }
+        }
+    }
+}
+
+// Собственные значения (в d, по возрастанию) и векторы (в блоке q, который
+// должен быть нулевым) трёхдиагональной матрицы; e - n-1 внедиагональных
+void divideAndConquer(std::size_t n, double* d, const double* e, double* q, std::size_t ldq) {
+    if (n <= EIGEN_LEAF_SIZE) {
+        for (std::size_t i = 0; i < n; ++i) {
+            q[i * ldq + i] = 1.0;
+        }
+        std::vector<double> offDiagonal(e, e + n - 1);
+        offDiagonal.push_back(0.0);
+        tridiagonalQL(n, d, offDiagonal.data(), q, ldq);
+        sortEigenpairs(n, d, q, ldq);
+        return;
+    }
+
+    // T = diag(T1', T2') + |rho| u u^T, где у T1', T2' вычтено |rho| из углов
+    const std::size_t n1 = n / 2;
+    const double rho = e[n1 - 1];
+    d[n1 - 1] -= std::abs(rho);
+    d[n1] -= std::abs(rho);
+    divideAndConquer(n1, d, e, q, ldq);
+    divideAndConquer(n - n1, d + n1, e + n1, q + n1 * ldq + n1, ldq);
+    mergeSubproblems(n, n1, d, q, ldq, rho);
+}
+
+} // namespace
+
+SymmetricEigenDecomposition::SymmetricEigenDecomposition(const RealMatrix& matrix, bool computeEigenvectors)
+        : vectorsComputed(computeEigenvectors)
+{
+    if (!matrix.checkIsSquare()) {
+        throw std::invalid_argument("Matrix must be square for eigendecomposition");
+    }
+    if (!matrix.checkIsSymmetric()) {
+        throw std::invalid_argument("Matrix must be symmetric for eigendecomposition");
+    }
+
+    const std::size_t n = matrix.getRows();
+    RealMatrix reduced(matrix);
+    std::vector<double> offDiagonal;
+    std::vector<double> tau;
+    reduceToTridiagonal(reduced, eigenvalues, offDiagonal, tau);
+
+    if (!computeEigenvectors) {
+        offDiagonal.push_back(0.0);
+        tridiagonalQL(n, eigenvalues.data(), offDiagonal.data(), nullptr, 0);
+        std::sort(eigenvalues.begin(), eigenvalues.end());
+        return;
+    }
+
+    if (n == 0) return;
+    eigenvectors = RealMatrix(n, n, 0.0);
+    divideAndConquer(n, eigenvalues.data(), offDiagonal.data(),
+                     eigenvectors.getData(), eigenvectors.getRowStride());
+    applyReflectors(reduced, tau, eigenvectors);
+}
+
+std::size_t SymmetricEigenDecomposition::getSize() const {
+    return eigenvalues.size();
+}
+
+bool SymmetricEigenDecomposition::hasEigenvectors() const {
+    return vectorsComputed;
+}
+
+std::vector<double> SymmetricEigenDecomposition::getEigenvalues() const {
+    return eigenvalues;
+}
+
+RealMatrix SymmetricEigenDecomposition::getEigenvectors() const {
+    if (!vectorsComputed) {
+        throw std::runtime_error("Eigenvectors were not computed");
+    }
+    return eigenvectors;
+}
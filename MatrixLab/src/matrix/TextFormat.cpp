@@ -0,0 +1,188 @@
+/**
+ * @file TextFormat.cpp
+ * @brief Implementation of the text matrix parser and writer
+ * @author Shchurko
+ * @date 2025
+ */
+
+#include "TextFormat.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstring>
+#include <system_error>
+
+namespace text_format {
+
+namespace {
+
+// Самая длинная кратчайшая запись double ("-2.2250738585072014e-308") - 24 символа
+constexpr std::size_t MAX_VALUE_CHARS = 32;
+
+bool isSeparator(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+const char* findLineEnd(const char* position, const char* end) {
+    const void* found = std::memchr(position, '\n', static_cast<std::size_t>(end - position));
+    return found != nullptr ? static_cast<const char*>(found) : end;
+}
+
+const char* nextLine(const char* lineEnd, const char* end) {
+    return lineEnd == end ? end : lineEnd + 1;
+}
+
+bool isBlank(const char* begin, const char* end) {
+    return std::all_of(begin, end, isSeparator);
+}
+
+std::size_t countTokens(const char* begin, const char* end) {
+    std::size_t count = 0;
+    bool inToken = false;
+    for (const char* p = begin; p != end; ++p) {
+        const bool separator = isSeparator(*p);
+        if (!separator && !inToken) ++count;
+        inToken = !separator;
+    }
+    return count;
+}
+
+// Разбирает одно значение и возвращает позицию за ним или nullptr.
+// Знак '+' допускается, как и при чтении через operator>>
+const char* parseValue(const char* position, const char* end, double& value) {
+    if (*position == '+') {
+        ++position;
+        if (position == end || *position == '-') return nullptr;
+    }
+    const std::from_chars_result result = std::from_chars(position, end, value);
+    if (result.ec != std::errc() || (result.ptr != end && !isSeparator(*result.ptr))) {
+        return nullptr;
+    }
+    return result.ptr;
+}
+
+// Куски обрабатываются общим пулом потоков; один кусок - в вызывающем потоке
+template <typename Task>
+void forEachChunk(std::size_t chunkCount, Task task) {
+    if (chunkCount > 1) {
+        ThreadPool::global()->parallelFor(chunkCount, task);
+    } else {
+        task(0);
+    }
+}
+
+} // namespace
+
+bool scan(const char* text, std::size_t length, Layout& layout) {
+    const char* end = text + length;
+
+    // Куски примерно равной длины, граница сдвигается к началу следующей строки
+    const std::size_t threads = ThreadPool::getGlobalThreadCount();
+    const std::size_t chunkCount = std::max<std::size_t>(1, std::min(threads, length / PARSE_CHUNK_BYTES));
+    layout.chunkBegin.assign(1, 0);
+    for (std::size_t k = 1; k < chunkCount; ++k) {
+        const std::size_t target = std::max(length * k / chunkCount, layout.chunkBegin.back());
+        const char* lineEnd = findLineEnd(text + target, end);
+        const std::size_t boundary = lineEnd == end ? length : static_cast<std::size_t>(lineEnd - text) + 1;
+        if (boundary > layout.chunkBegin.back() && boundary < length) {
+            layout.chunkBegin.push_back(boundary);
+        }
+    }
+    layout.chunkBegin.push_back(length);
+
+    const std::size_t chunks = layout.chunkBegin.size() - 1;
+    std::vector<std::size_t> rowsPerChunk(chunks, 0);
+    forEachChunk(chunks, [&](std::size_t k) {
+        const char* position = text + layout.chunkBegin[k];
+        const char* chunkEnd = text + layout.chunkBegin[k + 1];
+        std::size_t rows = 0;
+        while (position < chunkEnd) {
+            const char* lineEnd = findLineEnd(position, chunkEnd);
+            if (!isBlank(position, lineEnd)) ++rows;
+            position = nextLine(lineEnd, chunkEnd);
+        }
+        rowsPerChunk[k] = rows;
+    });
+
+    layout.chunkFirstRow.assign(chunks, 0);
+    layout.rows = 0;
+    for (std::size_t k = 0; k < chunks; ++k) {
+        layout.chunkFirstRow[k] = layout.rows;
+        layout.rows += rowsPerChunk[k];
+    }
+    if (layout.rows == 0) {
+        return false;
+    }
+
+    // Число столбцов задаёт первая непустая строка
+    const char* position = text;
+    const char* lineEnd = findLineEnd(position, end);
+    while (isBlank(position, lineEnd)) {
+        position = nextLine(lineEnd, end);
+        lineEnd = findLineEnd(position, end);
+    }
+    layout.cols = countTokens(position, lineEnd);
+    return true;
+}
+
+bool parse(const char* text, const Layout& layout, double* data, std::size_t rowStride) {
+    std::atomic<bool> failed{false};
+    const std::size_t chunks = layout.chunkFirstRow.size();
+
+    forEachChunk(chunks, [&](std::size_t k) {
+        const char* position = text + layout.chunkBegin[k];
+        const char* chunkEnd = text + layout.chunkBegin[k + 1];
+        std::size_t row = layout.chunkFirstRow[k];
+
+        while (position < chunkEnd && !failed.load(std::memory_order_relaxed)) {
+            const char* lineEnd = findLineEnd(position, chunkEnd);
+            double* out = data + row * rowStride;
+            std::size_t col = 0;
+            while (true) {
+                while (position != lineEnd && isSeparator(*position)) ++position;
+                if (position == lineEnd) break;
+                if (col == layout.cols || (position = parseValue(position, lineEnd, out[col])) == nullptr) {
+                    failed = true;
+                    return;
+                }
+                ++col;
+            }
+            if (col != 0) {
+                if (col != layout.cols) {
+                    failed = true;
+                    return;
+                }
+                ++row;
+            }
+            position = nextLine(lineEnd, chunkEnd);
+        }
+    });
+
+    return !failed;
+}
+
+bool write(std::ostream& stream, const double* data, std::size_t rows,
+           std::size_t cols, std::size_t rowStride) {
+    std::vector<char> buffer(WRITE_BUFFER_BYTES);
+    char* const begin = buffer.data();
+    char* const end = begin + buffer.size();
+    char* position = begin;
+
+    for (std::size_t i = 0; i < rows; ++i) {
+        const double* row = data + i * rowStride;
+        for (std::size_t j = 0; j < cols; ++j) {
+            if (static_cast<std::size_t>(end - position) < MAX_VALUE_CHARS + 1) {
+                stream.write(begin, position - begin);
+                position = begin;
+            }
+            position = std::to_chars(position, end, row[j]).ptr;
+            if (j + 1 < cols) *position++ = ' ';
+        }
+        if (i + 1 < rows) *position++ = '\n';
+    }
+    stream.write(begin, position - begin);
+    return static_cast<bool>(stream);
+}
+
+} // namespace text_format
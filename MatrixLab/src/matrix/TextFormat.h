@@ -0,0 +1,56 @@
+/**
+ * @file TextFormat.h
+ * @brief Parallel from_chars parser and to_chars writer for text matrix files
+ * @author Shchurko
+ * @date 2025
+ */
+
+#ifndef MATRIXLAB_TEXTFORMAT_H
+#define MATRIXLAB_TEXTFORMAT_H
+
+#include <cstddef>
+#include <ostream>
+#include <vector>
+
+/*
+ * Текстовый формат: строка файла - строка матрицы, значения разделены
+ * пробелами или табуляциями, пустые строки пропускаются. Все строки
+ * должны содержать одинаковое число значений.
+ *
+ * Разбор идёт в два прохода по тексту, целиком прочитанному в память.
+ * Текст делится на куски по границам строк; первый проход считает
+ * непустые строки в каждом куске (и столбцы по первой строке), после чего
+ * буфер матрицы выделяется один раз, а второй проход разбирает куски
+ * параллельно через std::from_chars прямо в свои строки матрицы.
+ */
+namespace text_format {
+
+// Кусок текста на один поток при разборе
+constexpr std::size_t PARSE_CHUNK_BYTES = std::size_t{1} << 20;
+// Буфер форматирования при записи
+constexpr std::size_t WRITE_BUFFER_BYTES = std::size_t{1} << 20;
+
+struct Layout {
+    std::size_t rows = 0;
+    std::size_t cols = 0;
+    // Границы кусков: кусок k занимает [chunkBegin[k], chunkBegin[k + 1])
+    std::vector<std::size_t> chunkBegin;
+    // Номер первой строки матрицы в каждом куске
+    std::vector<std::size_t> chunkFirstRow;
+};
+
+// Первый проход. Возвращает false для текста без значений
+bool scan(const char* text, std::size_t length, Layout& layout);
+
+// Второй проход: значения строки i попадают в data + i * rowStride.
+// Возвращает false, если встретилось не число или строка с другим
+// числом значений
+bool parse(const char* text, const Layout& layout, double* data, std::size_t rowStride);
+
+// Кратчайшая запись, однозначно восстанавливающая значение (std::to_chars)
+bool write(std::ostream& stream, const double* data, std::size_t rows,
+           std::size_t cols, std::size_t rowStride);
+
+} // namespace text_format
+
+#endif // MATRIXLAB_TEXTFORMAT_H
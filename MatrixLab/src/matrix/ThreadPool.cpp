@@ -0,0 +1,151 @@
+/**
+ * @file ThreadPool.cpp
+ * @brief Implementation of persistent worker pool
+ * @author Shchurko
+ * @date 2025
+ */
+
+#include "ThreadPool.h"
+#include <memory>
+#include <stdexcept>
+
+namespace {
+
+// Поток уже выполняет задачу пула: вложенный parallelFor идёт последовательно
+thread_local bool insidePoolTask = false;
+
+std::size_t defaultThreadCount() {
+    unsigned hardware = std::thread::hardware_concurrency();
+    return hardware == 0 ? 1 : hardware;
+}
+
+std::mutex globalPoolMutex;
+std::shared_ptr<ThreadPool> globalPool;
+
+} // namespace
+
+ThreadPool::ThreadPool(std::size_t threadCount)
+        : currentTask(nullptr), currentTaskCount(0), generation(0),
+          pendingWorkers(0), stopping(false)
+{
+    if (threadCount == 0) {
+        throw std::invalid_argument("Thread pool needs at least one thread");
+    }
+    workers.reserve(threadCount - 1);
+    for (std::size_t participant = 1; participant < threadCount; ++participant) {
+        workers.emplace_back(&ThreadPool::workerLoop, this, participant);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeWorkers.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+std::size_t ThreadPool::getThreadCount() const {
+    return workers.size() + 1;
+}
+
+void ThreadPool::parallelFor(std::size_t taskCount, const std::function<void(std::size_t)>& task) {
+    if (taskCount == 0) return;
+
+    if (workers.empty() || taskCount == 1 || insidePoolTask) {
+        for (std::size_t i = 0; i < taskCount; ++i) {
+            task(i);
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex> submitLock(submitMutex);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        currentTask = &task;
+        currentTaskCount = taskCount;
+        pendingWorkers = workers.size();
+        firstError = nullptr;
+        ++generation;
+    }
+    wakeWorkers.notify_all();
+
+    runShare(0);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    workDone.wait(lock, [this] { return pendingWorkers == 0; });
+    currentTask = nullptr;
+    if (firstError) {
+        std::exception_ptr error = firstError;
+        firstError = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+void ThreadPool::runShare(std::size_t participant) {
+    const std::size_t participants = getThreadCount();
+    insidePoolTask = true;
+    try {
+        for (std::size_t i = participant; i < currentTaskCount; i += participants) {
+            (*currentTask)(i);
+        }
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!firstError) {
+            firstError = std::current_exception();
+        }
+    }
+    insidePoolTask = false;
+}
+
+void ThreadPool::workerLoop(std::size_t participant) {
+    std::size_t seenGeneration = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wakeWorkers.wait(lock, [&] { return stopping || generation != seenGeneration; });
+            if (stopping) return;
+            seenGeneration = generation;
+        }
+
+        runShare(participant);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--pendingWorkers == 0) {
+            workDone.notify_one();
+        }
+    }
+}
+
+std::shared_ptr<ThreadPool> ThreadPool::global() {
+    std::lock_guard<std::mutex> lock(globalPoolMutex);
+    if (!globalPool) {
+        globalPool = std::make_shared<ThreadPool>(defaultThreadCount());
+    }
+    return globalPool;
+}
+
+// Прежний пул отпускается вне блокировки: если он последний, деструктор
+// ждёт свои потоки. Задачи пула не держат ссылок на него, поэтому
+// последним владельцем никогда не бывает поток самого пула
+void ThreadPool::setGlobalThreadCount(std::size_t threadCount) {
+    if (threadCount == 0) {
+        threadCount = defaultThreadCount();
+    }
+    std::shared_ptr<ThreadPool> previous;
+    {
+        std::lock_guard<std::mutex> lock(globalPoolMutex);
+        if (globalPool && globalPool->getThreadCount() == threadCount) return;
+    }
+    std::shared_ptr<ThreadPool> replacement = std::make_shared<ThreadPool>(threadCount);
+    std::lock_guard<std::mutex> lock(globalPoolMutex);
+    previous = std::move(globalPool);
+    globalPool = std::move(replacement);
+}
+
+std::size_t ThreadPool::getGlobalThreadCount() {
+    return global()->getThreadCount();
+}
@@ -0,0 +1,74 @@
+/**
+ * @file ThreadPool.h
+ * @brief Persistent worker pool for parallel matrix kernels
+ * @author Shchurko
+ * @date 2025
+ */
+
+#ifndef MATRIXLAB_THREADPOOL_H
+#define MATRIXLAB_THREADPOOL_H
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <exception>
+
+/**
+ * @brief Пул потоков, создаваемый один раз на всю программу
+ *
+ * parallelFor раздаёт индексы задач потокам статически: задача i
+ * выполняется участником (i mod число участников), поэтому разбиение
+ * работы не зависит от того, какой поток освободился первым.
+ * Вызывающий поток участвует в работе как участник с номером 0.
+ * Вызов parallelFor изнутри задачи выполняется последовательно.
+ */
+class ThreadPool {
+public:
+    explicit ThreadPool(std::size_t threadCount);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Число участников, включая вызывающий поток
+    std::size_t getThreadCount() const;
+
+    // Выполняет task(i) для i в [0, taskCount); возвращается после
+    // завершения всех задач. Первое исключение пробрасывается вызывающему
+    void parallelFor(std::size_t taskCount, const std::function<void(std::size_t)>& task);
+
+    // Общий пул; размер задаётся setGlobalThreadCount (по умолчанию - число
+    // ядер). Возвращённый указатель держит пул живым: смена размера из
+    // другого потока (или изнутри задачи) создаёт новый пул, а прежний
+    // разрушается, когда его отпустит последний пользователь
+    static std::shared_ptr<ThreadPool> global();
+    static void setGlobalThreadCount(std::size_t threadCount);
+    static std::size_t getGlobalThreadCount();
+
+private:
+    void workerLoop(std::size_t participant);
+    void runShare(std::size_t participant);
+
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wakeWorkers;
+    std::condition_variable workDone;
+
+    // Текущее задание; поколение увеличивается при каждом parallelFor
+    const std::function<void(std::size_t)>* currentTask;
+    std::size_t currentTaskCount;
+    std::size_t generation;
+    std::size_t pendingWorkers;
+    bool stopping;
+    std::exception_ptr firstError;
+
+    // Один parallelFor за раз: вложенные и конкурирующие вызовы ждут
+    std::mutex submitMutex;
+};
+
+#endif // MATRIXLAB_THREADPOOL_H
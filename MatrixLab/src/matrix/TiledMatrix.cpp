@@ -0,0 +1,474 @@
+/**
+ * @file TiledMatrix.cpp
+ * @brief Implementation of tiled matrix files and out-of-core multiplication
+ * @author Shchurko
+ * @date 2025
+ */
+
+#include "TiledMatrix.h"
+#include "Gemm.h"
+#include "MatrixFile.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <future>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define MATRIX_TILED_POSIX 1
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define MATRIX_TILED_POSIX 0
+#include <fstream>
+#include <mutex>
+#endif
+
+namespace {
+
+constexpr char TILED_MAGIC[8] = {'M', 'T', 'X', 'T', 'I', 'L', 'E', '\0'};
+constexpr std::uint32_t TILED_VERSION = 1;
+
+struct TiledHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t type;
+    std::uint32_t byteOrder;
+    std::uint32_t headerSize;
+    std::uint64_t rows;
+    std::uint64_t cols;
+    std::uint64_t tileSize;
+    std::uint8_t reserved[16];
+};
+
+static_assert(sizeof(TiledHeader) == 64, "Tiled header must be exactly 64 bytes");
+static_assert(TILED_HEADER_SIZE % MATRIX_ALIGNMENT == 0, "Tiles must start at an aligned offset");
+
+using TileBuffer = std::vector<double, AlignedAllocator<double>>;
+
+std::size_t tileCount(std::size_t length, std::size_t tileSize) {
+    return (length + tileSize - 1) / tileSize;
+}
+
+// Размер файла rows x cols (оба больше 0) с плитками tileSize x tileSize
+// или 0, если смещение плитки не выражается в off_t или плитка не
+// помещается в память. Каждое произведение проверяется до умножения
+std::uint64_t tiledFileSize(std::uint64_t rows, std::uint64_t cols, std::uint64_t tileSize) {
+    const std::uint64_t limit = static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max());
+    if (rows > SIZE_MAX || cols > SIZE_MAX || tileSize > SIZE_MAX / tileSize ||
+        tileSize * tileSize > SIZE_MAX / sizeof(double)) {
+        return 0;
+    }
+    const std::uint64_t tileBytes = tileSize * tileSize * sizeof(double);
+    const std::uint64_t tileRows = (rows - 1) / tileSize + 1;
+    const std::uint64_t tileCols = (cols - 1) / tileSize + 1;
+    if (tileRows > limit / tileCols || tileRows * tileCols > (limit - TILED_HEADER_SIZE) / tileBytes) {
+        return 0;
+    }
+    return TILED_HEADER_SIZE + tileRows * tileCols * tileBytes;
+}
+
+} // namespace
+
+// ==================== Файл ====================
+// Все операции - по абсолютному смещению, без общей позиции в файле,
+// поэтому разные плитки читаются и пишутся параллельно
+struct TiledMatrix::FileHandle {
+#if MATRIX_TILED_POSIX
+    int descriptor = -1;
+
+    ~FileHandle() {
+        if (descriptor >= 0) {
+            ::close(descriptor);
+        }
+    }
+
+    bool open(const std::string& path, bool create, bool write) {
+        const int flags = create ? (O_RDWR | O_CREAT | O_TRUNC) : (write ? O_RDWR : O_RDONLY);
+        descriptor = ::open(path.c_str(), flags, 0644);
+        return descriptor >= 0;
+    }
+
+    // pread и pwrite могут передать меньше запрошенного - дочитываем в цикле
+    bool readAt(void* data, std::size_t size, std::uint64_t offset) {
+        char* bytes = static_cast<char*>(data);
+        while (size > 0) {
+            const ssize_t done = ::pread(descriptor, bytes, size, static_cast<off_t>(offset));
+            if (done < 0 && errno == EINTR) continue;
+            if (done <= 0) return false;
+            bytes += done;
+            size -= static_cast<std::size_t>(done);
+            offset += static_cast<std::uint64_t>(done);
+        }
+        return true;
+    }
+
+    bool writeAt(const void* data, std::size_t size, std::uint64_t offset) {
+        const char* bytes = static_cast<const char*>(data);
+        while (size > 0) {
+            const ssize_t done = ::pwrite(descriptor, bytes, size, static_cast<off_t>(offset));
+            if (done < 0 && errno == EINTR) continue;
+            if (done <= 0) return false;
+            bytes += done;
+            size -= static_cast<std::size_t>(done);
+            offset += static_cast<std::uint64_t>(done);
+        }
+        return true;
+    }
+
+    // Файл без записанных данных: система выделяет место по мере записи плиток
+    bool resize(std::uint64_t size) {
+        return ::ftruncate(descriptor, static_cast<off_t>(size)) == 0;
+    }
+
+    std::uint64_t size() {
+        struct stat status {};
+        return ::fstat(descriptor, &status) == 0 ? static_cast<std::uint64_t>(status.st_size) : 0;
+    }
+#else
+    std::fstream stream;
+    std::mutex lock;
+
+    bool open(const std::string& path, bool create, bool write) {
+        std::ios::openmode mode = std::ios::binary | std::ios::in;
+        if (create) mode |= std::ios::out | std::ios::trunc;
+        else if (write) mode |= std::ios::out;
+        stream.open(path, mode);
+        return stream.is_open();
+    }
+
+    bool readAt(void* data, std::size_t size, std::uint64_t offset) {
+        std::lock_guard<std::mutex> guard(lock);
+        stream.clear();
+        stream.seekg(static_cast<std::streamoff>(offset));
+        return static_cast<bool>(stream.read(static_cast<char*>(data), static_cast<std::streamsize>(size)));
+    }
+
+    bool writeAt(const void* data, std::size_t size, std::uint64_t offset) {
+        std::lock_guard<std::mutex> guard(lock);
+        stream.clear();
+        stream.seekp(static_cast<std::streamoff>(offset));
+        return static_cast<bool>(stream.write(static_cast<const char*>(data), static_cast<std::streamsize>(size)));
+    }
+
+    bool resize(std::uint64_t size) {
+        const char zero = 0;
+        return size == 0 || writeAt(&zero, 1, size - 1);
+    }
+
+    std::uint64_t size() {
+        std::lock_guard<std::mutex> guard(lock);
+        stream.clear();
+        stream.seekg(0, std::ios::end);
+        return static_cast<std::uint64_t>(stream.tellg());
+    }
+#endif
+};
+
+// ==================== Создание и открытие ====================
+TiledMatrix::TiledMatrix() : writable(false), numRows(0), numCols(0), tileSize(0) {}
+
+TiledMatrix TiledMatrix::create(const std::string& filename, std::size_t rows, std::size_t cols,
+                                std::size_t tileSize) {
+    if (rows == 0 || cols == 0 || tileSize == 0) {
+        throw std::invalid_argument("Matrix dimensions and tile size must be positive");
+    }
+    const std::uint64_t totalSize = tiledFileSize(rows, cols, tileSize);
+    if (totalSize == 0) {
+        throw std::invalid_argument("Tiled matrix is too large");
+    }
+
+    TiledMatrix matrix;
+    matrix.filename = filename;
+    matrix.writable = true;
+    matrix.numRows = rows;
+    matrix.numCols = cols;
+    matrix.tileSize = tileSize;
+    matrix.file.reset(new FileHandle());
+    if (!matrix.file->open(filename, true, true)) {
+        throw std::runtime_error("Cannot create tiled matrix file: " + filename);
+    }
+
+    std::vector<char> headerBlock(TILED_HEADER_SIZE, 0);
+    TiledHeader header{};
+    std::memcpy(header.magic, TILED_MAGIC, sizeof(TILED_MAGIC));
+    header.version = TILED_VERSION;
+    header.type = static_cast<std::uint32_t>(binary_format::BinaryType::Float64);
+    header.byteOrder = binary_format::BYTE_ORDER_MARK;
+    header.headerSize = static_cast<std::uint32_t>(TILED_HEADER_SIZE);
+    header.rows = rows;
+    header.cols = cols;
+    header.tileSize = tileSize;
+    std::memcpy(headerBlock.data(), &header, sizeof(header));
+
+    if (!matrix.file->writeAt(headerBlock.data(), headerBlock.size(), 0) || !matrix.file->resize(totalSize)) {
+        throw std::runtime_error("Cannot write tiled matrix file: " + filename);
+    }
+    return matrix;
+}
+
+TiledMatrix TiledMatrix::fromMatrix(const RealMatrix& matrix, const std::string& filename,
+                                    std::size_t tileSize) {
+    TiledMatrix tiled = create(filename, matrix.getRows(), matrix.getCols(), tileSize);
+    for (std::size_t ti = 0; ti < tiled.getTileRows(); ++ti) {
+        for (std::size_t tj = 0; tj < tiled.getTileCols(); ++tj) {
+            tiled.storeTile(ti, tj, matrix.view(ti * tileSize, tj * tileSize,
+                                                tiled.getTileHeight(ti), tiled.getTileWidth(tj)));
+        }
+    }
+    return tiled;
+}
+
+TiledMatrix::TiledMatrix(const std::string& filename, bool writable) : TiledMatrix() {
+    this->filename = filename;
+    this->writable = writable;
+    file.reset(new FileHandle());
+    if (!file->open(filename, false, writable)) {
+        throw std::runtime_error("Cannot open tiled matrix file: " + filename);
+    }
+
+    TiledHeader header{};
+    if (!file->readAt(&header, sizeof(header), 0) ||
+        std::memcmp(header.magic, TILED_MAGIC, sizeof(TILED_MAGIC)) != 0 ||
+        header.version != TILED_VERSION ||
+        header.type != static_cast<std::uint32_t>(binary_format::BinaryType::Float64) ||
+        header.headerSize != TILED_HEADER_SIZE ||
+        header.rows == 0 || header.cols == 0 || header.tileSize == 0) {
+        throw std::runtime_error("Invalid tiled matrix file header: " + filename);
+    }
+    if (header.byteOrder != binary_format::BYTE_ORDER_MARK) {
+        throw std::runtime_error("Tiled matrix file byte order differs from this machine: " + filename);
+    }
+    // Размеры из заголовка не доверенные: их произведения могут переполниться
+    const std::uint64_t expectedSize = tiledFileSize(header.rows, header.cols, header.tileSize);
+    if (expectedSize == 0) {
+        throw std::runtime_error("Invalid tiled matrix file header: " + filename);
+    }
+
+    numRows = static_cast<std::size_t>(header.rows);
+    numCols = static_cast<std::size_t>(header.cols);
+    tileSize = static_cast<std::size_t>(header.tileSize);
+    if (file->size() < expectedSize) {
+        throw std::runtime_error("Tiled matrix file is truncated: " + filename);
+    }
+}
+
+TiledMatrix::~TiledMatrix() = default;
+TiledMatrix::TiledMatrix(TiledMatrix&& other) noexcept = default;
+TiledMatrix& TiledMatrix::operator=(TiledMatrix&& other) noexcept = default;
+
+// ==================== Геттеры ====================
+std::size_t TiledMatrix::getRows() const {
+    return numRows;
+}
+
+std::size_t TiledMatrix::getCols() const {
+    return numCols;
+}
+
+std::size_t TiledMatrix::getTileSize() const {
+    return tileSize;
+}
+
+std::size_t TiledMatrix::getTileRows() const {
+    return tileCount(numRows, tileSize);
+}
+
+std::size_t TiledMatrix::getTileCols() const {
+    return tileCount(numCols, tileSize);
+}
+
+std::size_t TiledMatrix::getTileHeight(std::size_t tileRow) const {
+    return std::min(tileSize, numRows - tileRow * tileSize);
+}
+
+std::size_t TiledMatrix::getTileWidth(std::size_t tileCol) const {
+    return std::min(tileSize, numCols - tileCol * tileSize);
+}
+
+const std::string& TiledMatrix::getFilename() const {
+    return filename;
+}
+
+// ==================== Плитки ====================
+void TiledMatrix::readTile(std::size_t tileRow, std::size_t tileCol, double* buffer) const {
+    checkTile(tileRow, tileCol);
+    if (!file->readAt(buffer, tileElements() * sizeof(double), tileOffset(tileRow, tileCol))) {
+        throw std::runtime_error("Cannot read tile from " + filename);
+    }
+}
+
+void TiledMatrix::writeTile(std::size_t tileRow, std::size_t tileCol, const double* buffer) {
+    checkTile(tileRow, tileCol);
+    if (!writable) {
+        throw std::runtime_error("Tiled matrix is opened read-only: " + filename);
+    }
+    if (!file->writeAt(buffer, tileElements() * sizeof(double), tileOffset(tileRow, tileCol))) {
+        throw std::runtime_error("Cannot write tile to " + filename);
+    }
+}
+
+RealMatrix TiledMatrix::loadTile(std::size_t tileRow, std::size_t tileCol) const {
+    TileBuffer buffer(tileElements());
+    readTile(tileRow, tileCol, buffer.data());
+    return RealMatrix(ConstMatrixView(buffer.data(), getTileHeight(tileRow), getTileWidth(tileCol), tileSize));
+}
+
+void TiledMatrix::storeTile(std::size_t tileRow, std::size_t tileCol, const ConstMatrixView& tile) {
+    checkTile(tileRow, tileCol);
+    if (tile.getRows() != getTileHeight(tileRow) || tile.getCols() != getTileWidth(tileCol)) {
+        throw std::invalid_argument("Tile size doesn't match the tiled matrix");
+    }
+    TileBuffer buffer(tileElements(), 0.0);
+    MatrixView(buffer.data(), tile.getRows(), tile.getCols(), tileSize) = tile;
+    writeTile(tileRow, tileCol, buffer.data());
+}
+
+RealMatrix TiledMatrix::toMatrix() const {
+    RealMatrix matrix(numRows, numCols);
+    TileBuffer buffer(tileElements());
+    for (std::size_t ti = 0; ti < getTileRows(); ++ti) {
+        for (std::size_t tj = 0; tj < getTileCols(); ++tj) {
+            readTile(ti, tj, buffer.data());
+            const ConstMatrixView tile(buffer.data(), getTileHeight(ti), getTileWidth(tj), tileSize);
+            matrix.view(ti * tileSize, tj * tileSize, tile.getRows(), tile.getCols()) = tile;
+        }
+    }
+    return matrix;
+}
+
+// ==================== Умножение вне памяти ====================
+std::size_t TiledMatrix::panelTiles(std::size_t tileSize, std::size_t memoryBudget) {
+    const std::size_t tileBytes = tileSize * tileSize * sizeof(double);
+    const std::size_t tiles = tileBytes == 0 ? 0 : memoryBudget / tileBytes;
+    // s^2 плиток C и 4s плиток A и B (текущий шаг и читаемый следующий)
+    std::size_t side = 0;
+    while ((side + 1) * (side + 1) + 4 * (side + 1) <= tiles) {
+        ++side;
+    }
+    return side;
+}
+
+TiledMatrix TiledMatrix::multiply(const TiledMatrix& left, const TiledMatrix& right,
+                                  const std::string& resultFilename, std::size_t memoryBudget) {
+    if (left.numCols != right.numRows) {
+        throw std::invalid_argument("Matrix dimensions don't match for multiplication");
+    }
+    if (left.tileSize != right.tileSize) {
+        throw std::invalid_argument("Tiled matrices must have the same tile size");
+    }
+    const std::size_t ts = left.tileSize;
+    const std::size_t side = panelTiles(ts, memoryBudget);
+    if (side == 0) {
+        throw std::invalid_argument("Memory budget must hold at least five tiles");
+    }
+
+    TiledMatrix result = create(resultFilename, left.numRows, right.numCols, ts);
+    const std::size_t tileRows = result.getTileRows();
+    const std::size_t tileCols = result.getTileCols();
+    const std::size_t inner = left.getTileCols();
+
+    // Узкая сторона результата освобождает бюджет для другой стороны панели
+    const std::size_t budgetTiles = memoryBudget / (ts * ts * sizeof(double));
+    const std::size_t panelRows = std::min(side, tileRows);
+    const std::size_t panelCols = std::min(tileCols, (budgetTiles - 2 * panelRows) / (panelRows + 2));
+    const std::size_t panelsDown = tileCount(tileRows, panelRows);
+    const std::size_t panelsAcross = tileCount(tileCols, panelCols);
+
+    const std::size_t tileElements = ts * ts;
+    TileBuffer cTiles(panelRows * panelCols * tileElements);
+    // Плитки A панели, затем плитки B панели; второй набор заполняется фоном
+    TileBuffer operands[2] = {TileBuffer((panelRows + panelCols) * tileElements),
+                              TileBuffer((panelRows + panelCols) * tileElements)};
+
+    // Шаг - пара (панель, внутренний индекс p); шаги идут подряд через
+    // границы панелей, поэтому чтение всегда опережает вычисление на шаг
+    struct Step {
+        std::size_t rowBegin, rowEnd, colBegin, colEnd, p;
+    };
+    auto stepAt = [&](std::size_t step) {
+        const std::size_t panel = step / inner;
+        const std::size_t rowBegin = panel / panelsAcross * panelRows;
+        const std::size_t colBegin = panel % panelsAcross * panelCols;
+        return Step{rowBegin, std::min(tileRows, rowBegin + panelRows),
+                    colBegin, std::min(tileCols, colBegin + panelCols), step % inner};
+    };
+    auto load = [&](std::size_t step) {
+        const Step s = stepAt(step);
+        double* buffer = operands[step % 2].data();
+        for (std::size_t ti = s.rowBegin; ti < s.rowEnd; ++ti) {
+            left.readTile(ti, s.p, buffer + (ti - s.rowBegin) * tileElements);
+        }
+        for (std::size_t tj = s.colBegin; tj < s.colEnd; ++tj) {
+            right.readTile(s.p, tj, buffer + (panelRows + tj - s.colBegin) * tileElements);
+        }
+    };
+
+    const std::size_t steps = panelsDown * panelsAcross * inner;
+    std::future<void> pending = std::async(std::launch::async, load, std::size_t{0});
+    for (std::size_t step = 0; step < steps; ++step) {
+        pending.get();
+        if (step + 1 < steps) {
+            pending = std::async(std::launch::async, load, step + 1);
+        }
+
+        const Step s = stepAt(step);
+        const double* aTiles = operands[step % 2].data();
+        const double* bTiles = aTiles + panelRows * tileElements;
+        const std::size_t rows = s.rowEnd - s.rowBegin;
+        const std::size_t cols = s.colEnd - s.colBegin;
+        const std::size_t depth = left.getTileWidth(s.p);
+        auto multiplyTile = [&](std::size_t index) {
+            const std::size_t i = index / cols;
+            const std::size_t j = index % cols;
+            const std::size_t height = result.getTileHeight(s.rowBegin + i);
+            const std::size_t width = result.getTileWidth(s.colBegin + j);
+            double* c = cTiles.data() + index * tileElements;
+            if (s.p == 0 && (height < ts || width < ts)) {
+                // Край плитки C должен остаться нулевым и в файле
+                std::fill(c, c + tileElements, 0.0);
+            }
+            kernels::gemm(height, width, depth, 1.0,
+                          aTiles + i * tileElements, ts, 1,
+                          bTiles + j * tileElements, ts, 1,
+                          s.p == 0 ? 0.0 : 1.0, c, ts);
+        };
+        // Большая плитка распараллеливается внутри gemm, маленькие - между собой
+        if (ts * ts * ts >= kernels::getGemmParallelThreshold() || rows * cols == 1) {
+            for (std::size_t index = 0; index < rows * cols; ++index) multiplyTile(index);
+        } else {
+            ThreadPool::global()->parallelFor(rows * cols, multiplyTile);
+        }
+
+        // Панель готова: запись идёт, пока фоновый поток читает следующую
+        if (s.p + 1 == inner) {
+            for (std::size_t index = 0; index < rows * cols; ++index) {
+                result.writeTile(s.rowBegin + index / cols, s.colBegin + index % cols,
+                                 cTiles.data() + index * tileElements);
+            }
+        }
+    }
+    return result;
+}
+
+// ==================== Вспомогательные ====================
+std::uint64_t TiledMatrix::tileOffset(std::size_t tileRow, std::size_t tileCol) const {
+    const std::uint64_t index = static_cast<std::uint64_t>(tileRow) * getTileCols() + tileCol;
+    return TILED_HEADER_SIZE + index * tileElements() * sizeof(double);
+}
+
+std::size_t TiledMatrix::tileElements() const {
+    return tileSize * tileSize;
+}
+
+void TiledMatrix::checkTile(std::size_t tileRow, std::size_t tileCol) const {
+    if (tileRow >= getTileRows() || tileCol >= getTileCols()) {
+        throw std::out_of_range("Tile indices out of range");
+    }
+}
@@ -0,0 +1,126 @@
+/**
+ * @file TiledMatrix.h
+ * @brief Disk-resident tiled matrices and out-of-core multiplication
+ * @author Shchurko
+ * @date 2025
+ */
+
+#ifndef MATRIXLAB_TILEDMATRIX_H
+#define MATRIXLAB_TILEDMATRIX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "Matrix.h"
+
+/*
+ * Формат файла плиточной матрицы (поля - в порядке байтов записавшей машины):
+ *
+ *   0  char[8]   магическая строка "MTXTILE\0"
+ *   8  uint32    версия формата
+ *  12  uint32    тип элементов (binary_format::BinaryType)
+ *  16  uint32    метка порядка байтов binary_format::BYTE_ORDER_MARK
+ *  20  uint32    размер заголовка (смещение первой плитки)
+ *  24  uint64    число строк
+ *  32  uint64    число столбцов
+ *  40  uint64    сторона плитки t
+ *  48  byte[16]  резерв (нули)
+ *  ... нули до TILED_HEADER_SIZE
+ *
+ * Плитка (ti, tj) занимает t * t элементов по строкам с шагом t, начиная
+ * со смещения TILED_HEADER_SIZE + (ti * tileCols + tj) * t * t * 8.
+ * Крайние плитки дополнены нулями до полного размера: у всех плиток
+ * одинаковый размер и выровненное смещение, и любая читается одним
+ * вызовом pread. Контрольной суммы нет - плитки переписываются по одной.
+ */
+constexpr std::size_t TILED_HEADER_SIZE = 4096;
+
+/**
+ * @brief Матрица на диске, разбитая на квадратные плитки
+ *
+ * В памяти хранятся только размеры и дескриптор файла; плитки читаются
+ * и пишутся по запросу, поэтому размер матрицы ограничен только диском.
+ * Чтение и запись разных плиток можно вести из нескольких потоков
+ * одновременно. Объект только перемещается: он владеет дескриптором.
+ * Ошибки ввода-вывода бросают std::runtime_error.
+ */
+class TiledMatrix {
+public:
+    // Новая нулевая матрица: файл создаётся (или обрезается) и расширяется
+    // до полного размера без записи нулей
+    static TiledMatrix create(const std::string& filename, std::size_t rows, std::size_t cols,
+                              std::size_t tileSize);
+    // Запись плотной матрицы в новый плиточный файл
+    static TiledMatrix fromMatrix(const RealMatrix& matrix, const std::string& filename,
+                                  std::size_t tileSize);
+
+    // Открытие существующего файла; writable разрешает writeTile
+    explicit TiledMatrix(const std::string& filename, bool writable = false);
+    ~TiledMatrix();
+
+    TiledMatrix(TiledMatrix&& other) noexcept;
+    TiledMatrix& operator=(TiledMatrix&& other) noexcept;
+    TiledMatrix(const TiledMatrix&) = delete;
+    TiledMatrix& operator=(const TiledMatrix&) = delete;
+
+    // Геттеры
+    std::size_t getRows() const;
+    std::size_t getCols() const;
+    std::size_t getTileSize() const;
+    std::size_t getTileRows() const;
+    std::size_t getTileCols() const;
+    // Фактический размер плитки (меньше getTileSize() у правого и нижнего края)
+    std::size_t getTileHeight(std::size_t tileRow) const;
+    std::size_t getTileWidth(std::size_t tileCol) const;
+    const std::string& getFilename() const;
+
+    // Плитка целиком (t x t с шагом t, края - нули) из буфера или в буфер
+    void readTile(std::size_t tileRow, std::size_t tileCol, double* buffer) const;
+    void writeTile(std::size_t tileRow, std::size_t tileCol, const double* buffer);
+
+    // Плитка как обычная матрица фактического размера
+    RealMatrix loadTile(std::size_t tileRow, std::size_t tileCol) const;
+    void storeTile(std::size_t tileRow, std::size_t tileCol, const ConstMatrixView& tile);
+
+    // Вся матрица в памяти (только для матриц, которые в неё помещаются)
+    RealMatrix toMatrix() const;
+
+    /**
+     * @brief result = left * right вне памяти
+     *
+     * Результат считается панелями из s x s' плиток: панель C копится в
+     * памяти, пока на каждом шаге по внутреннему индексу через неё
+     * проходят s плиток A и s' плиток B; каждая пара плиток умножается
+     * через kernels::gemm. Плитки следующего шага читаются фоновым
+     * потоком, пока считается текущий, и при переходе к следующей панели
+     * запись готовой панели идёт вместе с чтением. s - наибольшее, при
+     * котором s^2 плиток C и два набора по 2s плиток A и B помещаются в
+     * memoryBudget байт; если у результата меньше s строк плиток, остаток
+     * бюджета уходит на ширину s'. Бюджет меньше пяти плиток и
+     * несовпадающие размеры плиток бросают std::invalid_argument.
+     */
+    static TiledMatrix multiply(const TiledMatrix& left, const TiledMatrix& right,
+                                const std::string& resultFilename, std::size_t memoryBudget);
+
+    // Число плиток на сторону панели, которое multiply выберет для бюджета
+    static std::size_t panelTiles(std::size_t tileSize, std::size_t memoryBudget);
+
+private:
+    TiledMatrix();
+
+    std::uint64_t tileOffset(std::size_t tileRow, std::size_t tileCol) const;
+    std::size_t tileElements() const;
+    void checkTile(std::size_t tileRow, std::size_t tileCol) const;
+
+    // Открытый файл (дескриптор POSIX или поток там, где его нет)
+    struct FileHandle;
+    std::unique_ptr<FileHandle> file;
+    std::string filename;
+    bool writable;
+    std::size_t numRows;
+    std::size_t numCols;
+    std::size_t tileSize;
+};
+
+#endif // MATRIXLAB_TILEDMATRIX_H
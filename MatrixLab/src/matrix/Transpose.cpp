@@ -0,0 +1,284 @@
+/**
+ * @file Transpose.cpp
+ * @brief Implementation of blocked transpose kernels
+ * @author Shchurko
+ * @date 2025
+ */
+
+#include "Transpose.h"
+#include "AlignedAllocator.h"
+#include "SimdKernels.h"
+#include <algorithm>
+#include <utility>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define MATRIX_TRANSPOSE_X86 1
+#include <immintrin.h>
+#else
+#define MATRIX_TRANSPOSE_X86 0
+#endif
+
+namespace kernels {
+
+namespace {
+
+// Транспонирует плитку size x size: destination = source^T
+using TileFunction = void (*)(const double* source, std::size_t sourceRowStride,
+                              double* destination, std::size_t destinationRowStride);
+
+struct TileKernel {
+    std::size_t size;
+    TileFunction transpose;
+};
+
+// Наибольшая плитка среди ядер (для буфера обмена плиток)
+constexpr std::size_t MAX_TILE = 8;
+
+constexpr std::size_t GENERIC_TILE = 4;
+
+void tileGeneric(const double* source, std::size_t sourceRowStride,
+                 double* destination, std::size_t destinationRowStride) {
+    for (std::size_t i = 0; i < GENERIC_TILE; ++i) {
+        for (std::size_t j = 0; j < GENERIC_TILE; ++j) {
+            destination[j * destinationRowStride + i] = source[i * sourceRowStride + j];
+        }
+    }
+}
+
+#if MATRIX_TRANSPOSE_X86
+
+__attribute__((target("sse2")))
+void tileSse2(const double* source, std::size_t sourceRowStride,
+              double* destination, std::size_t destinationRowStride) {
+    __m128d r0 = _mm_loadu_pd(source);
+    __m128d r1 = _mm_loadu_pd(source + sourceRowStride);
+    _mm_storeu_pd(destination, _mm_unpacklo_pd(r0, r1));
+    _mm_storeu_pd(destination + destinationRowStride, _mm_unpackhi_pd(r0, r1));
+}
+
+// Перемешивание пар строк, затем обмен 128-битных половин
+__attribute__((target("avx2")))
+void tileAvx2(const double* source, std::size_t sourceRowStride,
+              double* destination, std::size_t destinationRowStride) {
+    __m256d r0 = _mm256_loadu_pd(source);
+    __m256d r1 = _mm256_loadu_pd(source + sourceRowStride);
+    __m256d r2 = _mm256_loadu_pd(source + 2 * sourceRowStride);
+    __m256d r3 = _mm256_loadu_pd(source + 3 * sourceRowStride);
+
+    __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+    __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+    __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+    __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+
+    _mm256_storeu_pd(destination, _mm256_permute2f128_pd(t0, t2, 0x20));
+    _mm256_storeu_pd(destination + destinationRowStride, _mm256_permute2f128_pd(t1, t3, 0x20));
+    _mm256_storeu_pd(destination + 2 * destinationRowStride, _mm256_permute2f128_pd(t0, t2, 0x31));
+    _mm256_storeu_pd(destination + 3 * destinationRowStride, _mm256_permute2f128_pd(t1, t3, 0x31));
+}
+
+// Перемешивание пар строк, затем две перестановки 128-битных четвертей:
+// 0x88 берёт чётные четверти обоих операндов, 0xDD - нечётные
+__attribute__((target("avx512f")))
+void tileAvx512(const double* source, std::size_t sourceRowStride,
+                double* destination, std::size_t destinationRowStride) {
+    __m512d r[8];
+    for (std::size_t i = 0; i < 8; ++i) {
+        r[i] = _mm512_loadu_pd(source + i * sourceRowStride);
+    }
+
+    __m512d t[8];
+    for (std::size_t i = 0; i < 8; i += 2) {
+        t[i] = _mm512_unpacklo_pd(r[i], r[i + 1]);
+        t[i + 1] = _mm512_unpackhi_pd(r[i], r[i + 1]);
+    }
+
+    // u: строки 0-3, v: строки 4-7; индекс - номер столбца источника по модулю 4
+    __m512d u0 = _mm512_shuffle_f64x2(t[0], t[2], 0x88);
+    __m512d u1 = _mm512_shuffle_f64x2(t[1], t[3], 0x88);
+    __m512d u2 = _mm512_shuffle_f64x2(t[0], t[2], 0xDD);
+    __m512d u3 = _mm512_shuffle_f64x2(t[1], t[3], 0xDD);
+    __m512d v0 = _mm512_shuffle_f64x2(t[4], t[6], 0x88);
+    __m512d v1 = _mm512_shuffle_f64x2(t[5], t[7], 0x88);
+    __m512d v2 = _mm512_shuffle_f64x2(t[4], t[6], 0xDD);
+    __m512d v3 = _mm512_shuffle_f64x2(t[5], t[7], 0xDD);
+
+    _mm512_storeu_pd(destination, _mm512_shuffle_f64x2(u0, v0, 0x88));
+    _mm512_storeu_pd(destination + destinationRowStride, _mm512_shuffle_f64x2(u1, v1, 0x88));
+    _mm512_storeu_pd(destination + 2 * destinationRowStride, _mm512_shuffle_f64x2(u2, v2, 0x88));
+    _mm512_storeu_pd(destination + 3 * destinationRowStride, _mm512_shuffle_f64x2(u3, v3, 0x88));
+    _mm512_storeu_pd(destination + 4 * destinationRowStride, _mm512_shuffle_f64x2(u0, v0, 0xDD));
+    _mm512_storeu_pd(destination + 5 * destinationRowStride, _mm512_shuffle_f64x2(u1, v1, 0xDD));
+    _mm512_storeu_pd(destination + 6 * destinationRowStride, _mm512_shuffle_f64x2(u2, v2, 0xDD));
+    _mm512_storeu_pd(destination + 7 * destinationRowStride, _mm512_shuffle_f64x2(u3, v3, 0xDD));
+}
+
+#endif // MATRIX_TRANSPOSE_X86
+
+TileKernel selectTileKernel() {
+#if MATRIX_TRANSPOSE_X86
+    switch (getSimdLevel()) {
+        case SimdLevel::AVX512: return {8, tileAvx512};
+        case SimdLevel::AVX2: return {4, tileAvx2};
+        case SimdLevel::SSE2: return {2, tileSse2};
+        default: break;
+    }
+#endif
+    return {GENERIC_TILE, tileGeneric};
+}
+
+// Точка деления стороны пополам, кратная размеру плитки
+std::size_t splitPoint(std::size_t length, std::size_t tile) {
+    return (length / 2 + tile - 1) / tile * tile;
+}
+
+void transposeLeaf(std::size_t rows, std::size_t cols,
+                   const double* source, std::size_t sourceRowStride,
+                   double* destination, std::size_t destinationRowStride, const TileKernel& kernel) {
+    const std::size_t tile = kernel.size;
+    const std::size_t fullRows = rows / tile * tile;
+    const std::size_t fullCols = cols / tile * tile;
+
+    for (std::size_t i = 0; i < fullRows; i += tile) {
+        for (std::size_t j = 0; j < fullCols; j += tile) {
+            kernel.transpose(source + i * sourceRowStride + j, sourceRowStride,
+                             destination + j * destinationRowStride + i, destinationRowStride);
+        }
+    }
+    // Края, не покрытые плитками
+    for (std::size_t i = 0; i < rows; ++i) {
+        const std::size_t firstCol = i < fullRows ? fullCols : 0;
+        for (std::size_t j = firstCol; j < cols; ++j) {
+            destination[j * destinationRowStride + i] = source[i * sourceRowStride + j];
+        }
+    }
+}
+
+void transposeRecursive(std::size_t rows, std::size_t cols,
+                        const double* source, std::size_t sourceRowStride,
+                        double* destination, std::size_t destinationRowStride, const TileKernel& kernel) {
+    if (rows <= TRANSPOSE_BLOCK && cols <= TRANSPOSE_BLOCK) {
+        transposeLeaf(rows, cols, source, sourceRowStride, destination, destinationRowStride, kernel);
+        return;
+    }
+
+    if (rows >= cols) {
+        const std::size_t half = splitPoint(rows, kernel.size);
+        transposeRecursive(half, cols, source, sourceRowStride,
+                           destination, destinationRowStride, kernel);
+        transposeRecursive(rows - half, cols, source + half * sourceRowStride, sourceRowStride,
+                           destination + half, destinationRowStride, kernel);
+    } else {
+        const std::size_t half = splitPoint(cols, kernel.size);
+        transposeRecursive(rows, half, source, sourceRowStride,
+                           destination, destinationRowStride, kernel);
+        transposeRecursive(rows, cols - half, source + half, sourceRowStride,
+                           destination + half * destinationRowStride, destinationRowStride, kernel);
+    }
+}
+
+// Обмен плиток: a (в строке i, столбце j) <- b^T, b (в строке j, столбце i) <- a^T
+void swapTiles(double* a, double* b, std::size_t rowStride, const TileKernel& kernel) {
+    alignas(MATRIX_ALIGNMENT) double buffer[MAX_TILE * MAX_TILE];
+    const std::size_t tile = kernel.size;
+    kernel.transpose(a, rowStride, buffer, tile);
+    kernel.transpose(b, rowStride, a, rowStride);
+    for (std::size_t i = 0; i < tile; ++i) {
+        std::copy(buffer + i * tile, buffer + (i + 1) * tile, b + i * rowStride);
+    }
+}
+
+// a (rows x cols) и b (cols x rows) с общим шагом обмениваются
+// транспонированными значениями: a <- b^T, b <- a^T
+void swapTransposeLeaf(std::size_t rows, std::size_t cols, double* a, double* b,
+                       std::size_t rowStride, const TileKernel& kernel) {
+    const std::size_t tile = kernel.size;
+    const std::size_t fullRows = rows / tile * tile;
+    const std::size_t fullCols = cols / tile * tile;
+
+    for (std::size_t i = 0; i < fullRows; i += tile) {
+        for (std::size_t j = 0; j < fullCols; j += tile) {
+            swapTiles(a + i * rowStride + j, b + j * rowStride + i, rowStride, kernel);
+        }
+    }
+    for (std::size_t i = 0; i < rows; ++i) {
+        const std::size_t firstCol = i < fullRows ? fullCols : 0;
+        for (std::size_t j = firstCol; j < cols; ++j) {
+            std::swap(a[i * rowStride + j], b[j * rowStride + i]);
+        }
+    }
+}
+
+void swapTransposeRecursive(std::size_t rows, std::size_t cols, double* a, double* b,
+                            std::size_t rowStride, const TileKernel& kernel) {
+    if (rows <= TRANSPOSE_BLOCK && cols <= TRANSPOSE_BLOCK) {
+        swapTransposeLeaf(rows, cols, a, b, rowStride, kernel);
+        return;
+    }
+
+    if (rows >= cols) {
+        const std::size_t half = splitPoint(rows, kernel.size);
+        swapTransposeRecursive(half, cols, a, b, rowStride, kernel);
+        swapTransposeRecursive(rows - half, cols, a + half * rowStride, b + half, rowStride, kernel);
+    } else {
+        const std::size_t half = splitPoint(cols, kernel.size);
+        swapTransposeRecursive(rows, half, a, b, rowStride, kernel);
+        swapTransposeRecursive(rows, cols - half, a + half, b + half * rowStride, rowStride, kernel);
+    }
+}
+
+void transposeInPlaceLeaf(std::size_t n, double* data, std::size_t rowStride, const TileKernel& kernel) {
+    alignas(MATRIX_ALIGNMENT) double buffer[MAX_TILE * MAX_TILE];
+    const std::size_t tile = kernel.size;
+    const std::size_t full = n / tile * tile;
+
+    for (std::size_t i = 0; i < full; i += tile) {
+        double* diagonal = data + i * rowStride + i;
+        kernel.transpose(diagonal, rowStride, buffer, tile);
+        for (std::size_t r = 0; r < tile; ++r) {
+            std::copy(buffer + r * tile, buffer + (r + 1) * tile, diagonal + r * rowStride);
+        }
+        for (std::size_t j = i + tile; j < full; j += tile) {
+            swapTiles(data + i * rowStride + j, data + j * rowStride + i, rowStride, kernel);
+        }
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = std::max(i + 1, full); j < n; ++j) {
+            std::swap(data[i * rowStride + j], data[j * rowStride + i]);
+        }
+    }
+}
+
+// Диагональные блоки транспонируются рекурсивно, внедиагональные
+// меняются местами с транспонированием
+void transposeInPlaceRecursive(std::size_t n, double* data, std::size_t rowStride, const TileKernel& kernel) {
+    if (n <= TRANSPOSE_BLOCK) {
+        transposeInPlaceLeaf(n, data, rowStride, kernel);
+        return;
+    }
+
+    const std::size_t half = splitPoint(n, kernel.size);
+    transposeInPlaceRecursive(half, data, rowStride, kernel);
+    transposeInPlaceRecursive(n - half, data + half * rowStride + half, rowStride, kernel);
+    swapTransposeRecursive(half, n - half, data + half, data + half * rowStride, rowStride, kernel);
+}
+
+} // namespace
+
+void transpose(std::size_t rows, std::size_t cols,
+               const double* source, std::size_t sourceRowStride,
+               double* destination, std::size_t destinationRowStride) {
+    if (rows == 0 || cols == 0) {
+        return;
+    }
+    transposeRecursive(rows, cols, source, sourceRowStride,
+                       destination, destinationRowStride, selectTileKernel());
+}
+
+void transposeInPlace(std::size_t n, double* data, std::size_t rowStride) {
+    if (n < 2) {
+        return;
+    }
+    transposeInPlaceRecursive(n, data, rowStride, selectTileKernel());
+}
+
+} // namespace kernels
@@ -0,0 +1,37 @@
+/**
+ * @file Transpose.h
+ * @brief Cache-oblivious blocked matrix transpose kernels
+ * @author Shchurko
+ * @date 2025
+ */
+
+#ifndef MATRIXLAB_TRANSPOSE_H
+#define MATRIXLAB_TRANSPOSE_H
+
+#include <cstddef>
+
+namespace kernels {
+
+// Рекурсия делит матрицу пополам по большей стороне, пока блок не станет
+// не больше TRANSPOSE_BLOCK x TRANSPOSE_BLOCK: такой блок источника вместе
+// с блоком приёмника помещается в L1 на любом уровне иерархии памяти
+constexpr std::size_t TRANSPOSE_BLOCK = 32;
+
+/**
+ * @brief destination = source^T
+ *
+ * source (rows x cols) и destination (cols x rows) хранятся по строкам
+ * со своими шагами и не должны пересекаться. Внутри листового блока
+ * плитки 8x8 (AVX-512), 4x4 (AVX2) или 2x2 (SSE2) транспонируются в
+ * регистрах.
+ */
+void transpose(std::size_t rows, std::size_t cols,
+               const double* source, std::size_t sourceRowStride,
+               double* destination, std::size_t destinationRowStride);
+
+// Транспонирование квадратной матрицы n x n на месте
+void transposeInPlace(std::size_t n, double* data, std::size_t rowStride);
+
+} // namespace kernels
+
+#endif // MATRIXLAB_TRANSPOSE_H
@@ -0,0 +1,192 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include "matrix/Matrix.h"
+#include "matrix/SimdKernels.h"
+#include "TestHelpers.h"
+
+namespace {
+
+using test_helpers::forEachSupportedLevel;
+using test_helpers::makeMatrix;
+using test_helpers::maxDifference;
+
+template <typename T>
+void expectMatchesRealMatrix(double tolerance) {
+    const RealMatrix a = makeMatrix(37, 29, 0.3);
+    const RealMatrix b = makeMatrix(37, 29, 1.7);
+    const RealMatrix c = makeMatrix(29, 21, 2.9);
+    const BasicMatrix<T> ta(a);
+    const BasicMatrix<T> tb(b);
+    const BasicMatrix<T> tc(c);
+
+    EXPECT_LT(maxDifference(ta + tb, a + b), tolerance);
+    EXPECT_LT(maxDifference(ta - tb, a - b), tolerance);
+    EXPECT_LT(maxDifference(ta * T(2.5), a * 2.5), tolerance);
+    EXPECT_LT(maxDifference(ta / T(4), a / 4.0), tolerance);
+    EXPECT_LT(maxDifference(ta * tc, a * c), 30 * tolerance);
+    EXPECT_LT(maxDifference(ta.computeTranspose(), a.computeTranspose()), tolerance);
+    EXPECT_NEAR(static_cast<double>(ta.calculateNorm()), a.calculateNorm(), 30 * tolerance);
+
+    const RealMatrix square = makeMatrix(6, 6, 0.9) + RealMatrix::createIdentity(6) * 3.0;
+    EXPECT_NEAR(static_cast<double>(BasicMatrix<T>(square).calculateDeterminant()),
+                square.calculateDeterminant(), 100 * tolerance);
+
+    BasicMatrix<T> counter(ta);
+    ++counter;
+    EXPECT_LT(maxDifference(counter--, a + RealMatrix(37, 29, 1.0)), tolerance);
+    EXPECT_TRUE(counter == ta);
+    // Хвосты строк остаются нулевыми: норма не меняется после ++/--
+    EXPECT_EQ(counter.calculateNorm(), ta.calculateNorm());
+
+    EXPECT_THROW(ta * tb, std::invalid_argument);
+    EXPECT_THROW(ta + tc, std::invalid_argument);
+    EXPECT_THROW(ta / T(0), std::invalid_argument);
+    EXPECT_THROW(ta.getValue(37, 0), std::out_of_range);
+    EXPECT_THROW(BasicMatrix<T>(0, 3), std::invalid_argument);
+}
+
+} // namespace
+
+TEST(BasicMatrixTest, FloatMatchesRealMatrix) {
+    expectMatchesRealMatrix<float>(1e-5);
+}
+
+TEST(BasicMatrixTest, LongDoubleMatchesRealMatrix) {
+    expectMatchesRealMatrix<long double>(1e-13);
+}
+
+TEST(BasicMatrixTest, ParallelFloatProductMatchesSerial) {
+    const std::size_t previousThreads = RealMatrix::getThreadCount();
+    const std::size_t previousThreshold = RealMatrix::getParallelThreshold();
+
+    const FloatMatrix a(makeMatrix(70, 45, 0.1));
+    const FloatMatrix b(makeMatrix(45, 33, 0.2));
+    RealMatrix::setThreadCount(1);
+    const FloatMatrix serial = a * b;
+
+    RealMatrix::setThreadCount(4);
+    RealMatrix::setParallelThreshold(1);
+    const FloatMatrix parallel = a * b;
+    for (std::size_t i = 0; i < serial.getRows(); ++i) {
+        for (std::size_t j = 0; j < serial.getCols(); ++j) {
+            EXPECT_EQ(parallel.getValue(i, j), serial.getValue(i, j));
+        }
+    }
+
+    RealMatrix::setParallelThreshold(previousThreshold);
+    RealMatrix::setThreadCount(previousThreads);
+}
+
+TEST(BasicMatrixTest, FloatKernelsMatchScalarAtEveryLevel) {
+    forEachSupportedLevel([] {
+        for (std::size_t count = 0; count < 37; ++count) {
+            std::vector<float> a(count);
+            std::vector<float> b(count);
+            for (std::size_t i = 0; i < count; ++i) {
+                a[i] = static_cast<float>(std::sin(0.5 + static_cast<double>(i)));
+                b[i] = static_cast<float>(std::cos(1.5 * static_cast<double>(i)));
+            }
+            std::vector<float> out(count + 1, -7.0f);
+
+            kernels::add(a.data(), b.data(), out.data(), count);
+            for (std::size_t i = 0; i < count; ++i) EXPECT_FLOAT_EQ(out[i], a[i] + b[i]);
+
+            kernels::subtract(a.data(), b.data(), out.data(), count);
+            for (std::size_t i = 0; i < count; ++i) EXPECT_FLOAT_EQ(out[i], a[i] - b[i]);
+
+            kernels::scale(a.data(), 3.0f, out.data(), count);
+            for (std::size_t i = 0; i < count; ++i) EXPECT_FLOAT_EQ(out[i], a[i] * 3.0f);
+
+            kernels::addScalar(a.data(), -2.0f, out.data(), count);
+            for (std::size_t i = 0; i < count; ++i) EXPECT_FLOAT_EQ(out[i], a[i] - 2.0f);
+
+            std::vector<float> accumulated(b);
+            kernels::axpy(0.5f, a.data(), accumulated.data(), count);
+            for (std::size_t i = 0; i < count; ++i) EXPECT_NEAR(accumulated[i], b[i] + 0.5f * a[i], 1e-6);
+            // Запись не выходит за границу
+            EXPECT_FLOAT_EQ(out[count], -7.0f);
+
+            double expected = 0.0;
+            for (float value : a) expected += static_cast<double>(value) * value;
+            EXPECT_NEAR(kernels::sumSquares(a.data(), count), expected, 1e-12);
+
+            EXPECT_TRUE(kernels::allClose(a.data(), a.data(), 0.0f, count));
+            EXPECT_TRUE(kernels::allWithin(a.data(), 1.0f, count));
+            if (count > 0) {
+                std::vector<float> shifted(a);
+                shifted[count - 1] += 0.01f;
+                EXPECT_FALSE(kernels::allClose(a.data(), shifted.data(), 1e-3f, count));
+                EXPECT_FALSE(kernels::allWithin(shifted.data(), 0.0f, count) && expected > 0.0);
+            }
+        }
+    });
+}
+
+TEST(BasicMatrixTest, ConvertsBetweenPrecisions) {
+    const RealMatrix source = makeMatrix(5, 19, 0.4);
+    const FloatMatrix single(source);
+    const LongDoubleMatrix extended(source);
+
+    EXPECT_EQ(single.getRows(), 5u);
+    EXPECT_EQ(single.getCols(), 19u);
+    EXPECT_EQ(single.getRowStride(), 32u);
+    EXPECT_EQ(single.getValue(3, 7), static_cast<float>(source.getValue(3, 7)));
+
+    // double -> long double -> double без потерь
+    EXPECT_TRUE(RealMatrix(extended) == source);
+    EXPECT_EQ(RealMatrix(extended).getValue(4, 18), source.getValue(4, 18));
+    // Через float - с точностью float
+    EXPECT_FALSE(RealMatrix(single) == source);
+    EXPECT_LT(maxDifference(FloatMatrix(LongDoubleMatrix(single)), source), 1e-6);
+
+    EXPECT_EQ(RealMatrix(FloatMatrix()).getRows(), 0u);
+
+    std::ostringstream os;
+    os << FloatMatrix({{1.0f, 2.5f}, {-3.0f, 4.0f}});
+    EXPECT_EQ(os.str(), "1 2.5\n-3 4");
+}
+
+TEST(BasicMatrixTest, EpsilonDependsOnElementType) {
+    static_assert(MatrixTraits<double>::epsilon == MATRIX_EPSILON, "double keeps the historical threshold");
+    static_assert(MatrixTraits<float>::epsilon > MatrixTraits<double>::epsilon, "float is coarser");
+    static_assert(MatrixTraits<int>::epsilon == 0, "integers compare exactly");
+
+    // Отличие 1e-7 ниже порога float, но выше порога double
+    FloatMatrix single = FloatMatrix::createIdentity(3);
+    single.setValue(0, 1, 1e-7f);
+    EXPECT_TRUE(single.checkIsIdentity());
+    EXPECT_TRUE(single.checkIsSymmetric());
+
+    RealMatrix dense = RealMatrix::createIdentity(3);
+    dense.setValue(0, 1, 1e-7);
+    EXPECT_FALSE(dense.checkIsIdentity());
+
+    EXPECT_TRUE(FloatMatrix::createDiagonal({1.0f, 2.0f, 3.0f}).checkIsDiagonal());
+    EXPECT_FALSE(FloatMatrix({{1.0f, 2.0f}, {0.0f, 1.0f}}).checkIsLowerTriangular());
+    EXPECT_TRUE(FloatMatrix({{1.0f, 2.0f}, {0.0f, 1.0f}}).checkIsUpperTriangular());
+    EXPECT_TRUE(FloatMatrix({{0.0f, -1.0f}, {1.0f, 0.0f}}).checkIsOrthogonal());
+}
+
+TEST(BasicMatrixTest, RowPaddingStaysZero) {
+    // Умножение на inf не должно оставить NaN в хвостах строк
+    const float infinity = std::numeric_limits<float>::infinity();
+    FloatMatrix m(2, 2, 1.0f);
+    ASSERT_GT(m.getRowStride(), m.getCols());
+    m *= infinity;
+    m += FloatMatrix(2, 2, 1.0f);
+    m -= FloatMatrix(2, 2, 1.0f);
+    for (std::size_t i = 0; i < 2; ++i) {
+        for (std::size_t j = 0; j < 2; ++j) m.setValue(i, j, 1.0f);
+    }
+    EXPECT_FLOAT_EQ(m.calculateNorm(), 2.0f);
+    EXPECT_TRUE(m == FloatMatrix(2, 2, 1.0f));
+    for (std::size_t i = 0; i < 2; ++i) {
+        for (std::size_t j = 2; j < m.getRowStride(); ++j) {
+            EXPECT_EQ(m.getData()[i * m.getRowStride() + j], 0.0f);
+        }
+    }
+}
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "matrix/Matrix.h"
+
+namespace {
+
+RealMatrix makeSharedMatrix(std::size_t rows, std::size_t cols) {
+    RealMatrix m(rows, cols);
+    m.setCopyOnWrite(true);
+    for (std::size_t i = 0; i < rows; ++i) {
+        for (std::size_t j = 0; j < cols; ++j) {
+            m.setValue(i, j, static_cast<double>(i * cols + j));
+        }
+    }
+    return m;
+}
+
+} // namespace
+
+TEST(CopyOnWriteTest, CopiesShareUntilFirstMutation) {
+    RealMatrix original = makeSharedMatrix(5, 7);
+    EXPECT_TRUE(original.isCopyOnWrite());
+    EXPECT_FALSE(original.isSharingData());
+
+    RealMatrix copy(original);
+    EXPECT_TRUE(copy.isCopyOnWrite());
+    EXPECT_TRUE(original.isSharingData());
+    // Чтение не отсоединяет, запись - отсоединяет только изменяемую копию
+    const RealMatrix& readOnly = copy;
+    EXPECT_EQ(readOnly.getData(), static_cast<const RealMatrix&>(original).getData());
+    EXPECT_EQ(readOnly.getValue(2, 3), 17.0);
+    EXPECT_EQ(readOnly.view().getValue(4, 6), 34.0);
+    EXPECT_TRUE(copy.isSharingData());
+    copy.setValue(2, 3, -1.0);
+    EXPECT_FALSE(copy.isSharingData());
+    EXPECT_FALSE(original.isSharingData());
+    EXPECT_EQ(copy.getValue(2, 3), -1.0);
+    EXPECT_EQ(original.getValue(2, 3), 17.0);
+
+    // Операторы на месте, изменяемый указатель и представление
+    RealMatrix added = original;
+    added += original;
+    EXPECT_EQ(added.getValue(4, 6), 68.0);
+    EXPECT_EQ(original.getValue(4, 6), 34.0);
+
+    RealMatrix viaPointer = original;
+    viaPointer.getData()[0] = 100.0;
+    EXPECT_EQ(original.getValue(0, 0), 0.0);
+
+    RealMatrix viaView = original;
+    viaView.row(1).fill(5.0);
+    EXPECT_EQ(viaView.getValue(1, 6), 5.0);
+    EXPECT_EQ(original.getValue(1, 6), 13.0);
+
+    // Выражение того же размера не пишет в общий буфер
+    RealMatrix assigned = original;
+    RealMatrix other = original;
+    assigned = original + original;
+    EXPECT_EQ(assigned.getValue(1, 1), 16.0);
+    EXPECT_EQ(original.getValue(1, 1), 8.0);
+    EXPECT_EQ(other.getValue(1, 1), 8.0);
+
+    // Постфиксный инкремент и изменение размера сохраняют режим
+    RealMatrix counter = original;
+    RealMatrix before = counter++;
+    EXPECT_TRUE(counter.isCopyOnWrite());
+    EXPECT_EQ(counter.getValue(0, 1), 2.0);
+    EXPECT_EQ(before.getValue(0, 1), 1.0);
+    EXPECT_EQ(original.getValue(0, 1), 1.0);
+    RealMatrix resized = original;
+    resized.changeSize(3, 9);
+    EXPECT_TRUE(resized.isCopyOnWrite());
+    EXPECT_EQ(resized.getValue(2, 6), 20.0);
+    EXPECT_EQ(original.getRows(), 5u);
+
+    RealMatrix moved(std::move(copy));
+    EXPECT_TRUE(moved.isCopyOnWrite());
+    EXPECT_EQ(moved.getValue(2, 3), -1.0);
+}
+
+TEST(CopyOnWriteTest, DefaultModeCopiesAndModeCanBeDisabled) {
+    RealMatrix plain(4, 4, 1.5);
+    EXPECT_FALSE(plain.isCopyOnWrite());
+    RealMatrix plainCopy(plain);
+    EXPECT_FALSE(plainCopy.isSharingData());
+    EXPECT_NE(plainCopy.getData(), plain.getData());
+
+    // Присваивание от матрицы в режиме копирования при записи включает режим
+    RealMatrix shared = makeSharedMatrix(4, 4);
+    plain = shared;
+    EXPECT_TRUE(plain.isCopyOnWrite());
+    EXPECT_TRUE(shared.isSharingData());
+
+    // Выключение режима отсоединяет буфер, последующие копии глубокие
+    plain.setCopyOnWrite(false);
+    EXPECT_FALSE(plain.isSharingData());
+    EXPECT_FALSE(shared.isSharingData());
+    RealMatrix deep(plain);
+    EXPECT_FALSE(deep.isCopyOnWrite());
+    deep.setValue(3, 3, -2.0);
+    EXPECT_EQ(plain.getValue(3, 3), 15.0);
+    EXPECT_EQ(shared.getValue(3, 3), 15.0);
+}
+
+TEST(CopyOnWriteTest, ConcurrentCopiesAndMutations) {
+    const RealMatrix original = makeSharedMatrix(64, 64);
+    const std::size_t threadCount = 8;
+    std::vector<RealMatrix> results(threadCount);
+    std::vector<int> mismatches(threadCount, 0);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&original, &results, &mismatches, t] {
+            for (int round = 0; round < 200; ++round) {
+                RealMatrix copy(original);
+                RealMatrix second(copy);
+                copy.setValue(t, t, -static_cast<double>(t));
+                if (second.getValue(t, t) != static_cast<double>(t * 64 + t)) ++mismatches[t];
+                results[t] = std::move(copy);
+            }
+        });
+    }
+    for (std::thread& thread : threads) thread.join();
+
+    EXPECT_FALSE(original.isSharingData());
+    for (std::size_t t = 0; t < threadCount; ++t) {
+        EXPECT_EQ(mismatches[t], 0);
+        ASSERT_EQ(results[t].getRows(), 64u);
+        EXPECT_EQ(results[t].getValue(t, t), -static_cast<double>(t));
+        EXPECT_EQ(original.getValue(t, t), static_cast<double>(t * 64 + t));
+    }
+}
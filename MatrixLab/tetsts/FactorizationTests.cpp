@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+#include "matrix/Factorization.h"
+#include "TestHelpers.h"
+
+namespace {
+
+using test_helpers::maxDifference;
+
+// Хорошо обусловленная несимметричная матрица
+RealMatrix makeGeneralMatrix(std::size_t rows, std::size_t cols) {
+    RealMatrix m(rows, cols);
+    for (std::size_t i = 0; i < rows; ++i) {
+        for (std::size_t j = 0; j < cols; ++j) {
+            m.setValue(i, j, std::sin(0.3 * static_cast<double>(i) + 1.7 * static_cast<double>(j)));
+        }
+        if (i < cols) {
+            m.setValue(i, i, m.getValue(i, i) + static_cast<double>(cols));
+        }
+    }
+    return m;
+}
+
+// A^T A + n I - симметричная положительно определённая
+RealMatrix makeSpdMatrix(std::size_t n) {
+    RealMatrix a = makeGeneralMatrix(n, n);
+    RealMatrix spd = a.computeTranspose() * a;
+    for (std::size_t i = 0; i < n; ++i) {
+        spd.setValue(i, i, spd.getValue(i, i) + static_cast<double>(n));
+    }
+    return spd;
+}
+
+} // namespace
+
+TEST(FactorizationTest, LUReconstructsPermutedMatrix) {
+    // 150 > FACTORIZATION_BLOCK: проверяется блочный путь
+    const std::size_t n = 150;
+    RealMatrix a = makeGeneralMatrix(n, n);
+    LUDecomposition lu(a);
+
+    RealMatrix product = lu.getL() * lu.getU();
+    std::vector<std::size_t> permutation = lu.getPermutation();
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            EXPECT_NEAR(product.getValue(i, j), a.getValue(permutation[i], j), 1e-10);
+        }
+    }
+}
+
+TEST(FactorizationTest, LUSolvesVectorAndMatrixRightHandSides) {
+    const std::size_t n = 130;
+    RealMatrix a = makeGeneralMatrix(n, n);
+    RealMatrix expected = makeGeneralMatrix(n, 3);
+    LUDecomposition lu(a);
+
+    RealMatrix solution = lu.solve(a * expected);
+    EXPECT_LT(maxDifference(solution, expected), 1e-10);
+
+    std::vector<double> x(n);
+    for (std::size_t i = 0; i < n; ++i) x[i] = 1.0 + static_cast<double>(i % 7);
+    std::vector<double> b(n, 0.0);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) b[i] += a.getValue(i, j) * x[j];
+    }
+    std::vector<double> solved = lu.solve(b);
+    for (std::size_t i = 0; i < n; ++i) {
+        EXPECT_NEAR(solved[i], x[i], 1e-10);
+    }
+
+    EXPECT_LT(maxDifference(a * lu.inverse(), RealMatrix::createIdentity(n)), 1e-10);
+}
+
+TEST(FactorizationTest, LUDeterminantAndSingularity) {
+    RealMatrix a({{0.0, 2.0}, {3.0, 1.0}});
+    LUDecomposition lu(a);
+    EXPECT_DOUBLE_EQ(lu.determinant(), -6.0);
+    EXPECT_FALSE(lu.isSingular());
+
+    RealMatrix singular(3, 3, 2.0);
+    LUDecomposition singularLu(singular);
+    EXPECT_TRUE(singularLu.isSingular());
+    EXPECT_DOUBLE_EQ(singularLu.determinant(), 0.0);
+    EXPECT_THROW(singularLu.solve(std::vector<double>(3, 1.0)), std::runtime_error);
+
+    EXPECT_THROW(LUDecomposition(RealMatrix(2, 3)), std::invalid_argument);
+    EXPECT_THROW(lu.solve(std::vector<double>(3, 1.0)), std::invalid_argument);
+}
+
+TEST(FactorizationTest, CholeskyFactorsAndSolves) {
+    const std::size_t n = 140;
+    RealMatrix a = makeSpdMatrix(n);
+    CholeskyDecomposition cholesky(a);
+
+    RealMatrix lower = cholesky.getL();
+    EXPECT_TRUE(lower.checkIsLowerTriangular());
+    EXPECT_LT(maxDifference(lower * lower.computeTranspose(), a), 1e-8 * a.calculateNorm());
+
+    RealMatrix expected = makeGeneralMatrix(n, 2);
+    EXPECT_LT(maxDifference(cholesky.solve(a * expected), expected), 1e-9);
+
+    int sign = 0;
+    double luLogDet = LUDecomposition(a).logDeterminant(sign);
+    EXPECT_EQ(sign, 1);
+    EXPECT_NEAR(cholesky.logDeterminant(), luLogDet, 1e-8);
+}
+
+TEST(FactorizationTest, CholeskyRejectsIndefiniteAndAsymmetric) {
+    RealMatrix indefinite({{1.0, 2.0}, {2.0, 1.0}});
+    EXPECT_THROW(CholeskyDecomposition{indefinite}, std::invalid_argument);
+
+    RealMatrix asymmetric({{4.0, 1.0}, {0.0, 4.0}});
+    EXPECT_THROW(CholeskyDecomposition{asymmetric}, std::invalid_argument);
+
+    RealMatrix spd({{4.0, 2.0}, {2.0, 3.0}});
+    CholeskyDecomposition cholesky(spd);
+    EXPECT_DOUBLE_EQ(cholesky.determinant(), 8.0);
+    EXPECT_TRUE((spd * cholesky.inverse()).checkIsIdentity());
+}
+
+TEST(FactorizationTest, QRGivesOrthonormalQAndLeastSquares) {
+    const std::size_t m = 200, n = 90;
+    RealMatrix a = makeGeneralMatrix(m, n);
+    QRDecomposition qr(a);
+
+    RealMatrix q = qr.getQ();
+    RealMatrix r = qr.getR();
+    EXPECT_TRUE(r.checkIsUpperTriangular());
+    EXPECT_LT(maxDifference(q.computeTranspose() * q, RealMatrix::createIdentity(n)), 1e-12);
+    EXPECT_LT(maxDifference(q * r, a), 1e-10);
+
+    // Согласованная система: наименьшие квадраты дают точное решение
+    RealMatrix expected = makeGeneralMatrix(n, 2);
+    EXPECT_LT(maxDifference(qr.solve(a * expected), expected), 1e-10);
+
+    // Невязка ортогональна столбцам A
+    std::vector<double> b(m);
+    for (std::size_t i = 0; i < m; ++i) b[i] = std::cos(static_cast<double>(i));
+    std::vector<double> x = qr.solve(b);
+    for (std::size_t j = 0; j < n; ++j) {
+        double projection = 0.0;
+        for (std::size_t i = 0; i < m; ++i) {
+            double residual = b[i];
+            for (std::size_t p = 0; p < n; ++p) residual -= a.getValue(i, p) * x[p];
+            projection += a.getValue(i, j) * residual;
+        }
+        EXPECT_NEAR(projection, 0.0, 1e-9);
+    }
+}
+
+TEST(FactorizationTest, QRSquareDeterminantAndInverse) {
+    RealMatrix a = makeGeneralMatrix(70, 70);
+    QRDecomposition qr(a);
+
+    EXPECT_NEAR(qr.determinant() / a.calculateDeterminant(), 1.0, 1e-10);
+    EXPECT_LT(maxDifference(a * qr.inverse(), RealMatrix::createIdentity(70)), 1e-10);
+    EXPECT_THROW(QRDecomposition(RealMatrix(2, 3)), std::invalid_argument);
+}
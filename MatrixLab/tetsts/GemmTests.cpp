@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include <cmath>
+#include "matrix/Gemm.h"
+#include "matrix/Matrix.h"
+
+namespace {
+
+std::vector<double> makeValues(std::size_t count, double seed) {
+    std::vector<double> values(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        values[i] = std::sin(seed + 0.37 * static_cast<double>(i));
+    }
+    return values;
+}
+
+// Эталон: прямая тройная сумма без блоков
+std::vector<double> referenceProduct(std::size_t m, std::size_t n, std::size_t k,
+                                     const std::vector<double>& a, std::size_t aRow, std::size_t aCol,
+                                     const std::vector<double>& b, std::size_t bRow, std::size_t bCol) {
+    std::vector<double> c(m * n, 0.0);
+    for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            double sum = 0.0;
+            for (std::size_t p = 0; p < k; ++p) {
+                sum += a[i * aRow + p * aCol] * b[p * bRow + j * bCol];
+            }
+            c[i * n + j] = sum;
+        }
+    }
+    return c;
+}
+
+} // namespace
+
+TEST(GemmTest, BlockedMatchesReferenceOnRaggedSizes) {
+    // Размеры выбраны так, чтобы задеть все краевые блоки и несколько блоков по k
+    const std::size_t m = 131, n = 77, k = 300;
+    std::vector<double> a = makeValues(m * k, 0.1);
+    std::vector<double> b = makeValues(k * n, 0.7);
+    std::vector<double> c(m * n, 0.0);
+
+    kernels::gemm(m, n, k, 1.0, a.data(), k, 1, b.data(), n, 1, 0.0, c.data(), n);
+
+    std::vector<double> expected = referenceProduct(m, n, k, a, k, 1, b, n, 1);
+    for (std::size_t i = 0; i < m * n; ++i) {
+        EXPECT_NEAR(c[i], expected[i], 1e-10);
+    }
+}
+
+TEST(GemmTest, TransposedOperandsAndAlphaBeta) {
+    const std::size_t m = 70, n = 45, k = 90;
+    // A хранится как k x m, B - как n x k: оба передаются транспонированными
+    std::vector<double> a = makeValues(k * m, 0.3);
+    std::vector<double> b = makeValues(n * k, 1.9);
+    std::vector<double> c(m * n, 2.0);
+
+    kernels::gemm(m, n, k, 0.5, a.data(), 1, m, b.data(), 1, k, -1.0, c.data(), n);
+
+    std::vector<double> expected = referenceProduct(m, n, k, a, 1, m, b, 1, k);
+    for (std::size_t i = 0; i < m * n; ++i) {
+        EXPECT_NEAR(c[i], 0.5 * expected[i] - 2.0, 1e-10);
+    }
+}
+
+TEST(GemmTest, ZeroBetaIgnoresGarbageInOutput) {
+    const std::size_t m = 40, n = 40, k = 40;
+    std::vector<double> a = makeValues(m * k, 0.2);
+    std::vector<double> b = makeValues(k * n, 0.4);
+    std::vector<double> c(m * n, std::nan(""));
+
+    kernels::gemm(m, n, k, 1.0, a.data(), k, 1, b.data(), n, 1, 0.0, c.data(), n);
+
+    for (double value : c) {
+        EXPECT_FALSE(std::isnan(value));
+    }
+}
+
+TEST(GemmTest, MatrixOperatorUsesBlockedKernel) {
+    const std::size_t n = 100;
+    RealMatrix left(n, n);
+    RealMatrix right(n, n);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            left.setValue(i, j, std::cos(0.01 * static_cast<double>(i * n + j)));
+            right.setValue(i, j, (i == j) ? 2.0 : 0.0);
+        }
+    }
+
+    RealMatrix product = left * right;
+    EXPECT_TRUE(product == left * 2.0);
+
+    left *= right;
+    EXPECT_TRUE(product == left);
+}
@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+#include "matrix/MatrixBatch.h"
+#include "matrix/Factorization.h"
+#include "matrix/SimdKernels.h"
+#include "TestHelpers.h"
+
+namespace {
+
+using test_helpers::makeMatrix;
+using test_helpers::maxDifference;
+
+std::vector<RealMatrix> makeMatrices(std::size_t count, std::size_t rows, std::size_t cols, double seed) {
+    std::vector<RealMatrix> matrices;
+    for (std::size_t b = 0; b < count; ++b) {
+        matrices.push_back(makeMatrix(rows, cols, seed + 0.37 * static_cast<double>(b)));
+    }
+    return matrices;
+}
+
+// Хорошо обусловленные матрицы: сдвиг диагонали отделяет сингулярные числа от нуля
+std::vector<RealMatrix> makeRegularMatrices(std::size_t count, std::size_t size, double seed) {
+    std::vector<RealMatrix> matrices = makeMatrices(count, size, size, seed);
+    for (auto& matrix : matrices) {
+        for (std::size_t i = 0; i < size; ++i) {
+            matrix.setValue(i, i, matrix.getValue(i, i) + 1.5);
+        }
+    }
+    return matrices;
+}
+
+// Все уровни SIMD, которые поддерживает процессор; исходный уровень восстанавливается
+class MatrixBatchTest : public ::testing::Test {
+protected:
+    void SetUp() override { previousLevel = kernels::getSimdLevel(); }
+    void TearDown() override { kernels::setSimdLevel(previousLevel); }
+
+    std::vector<kernels::SimdLevel> supportedLevels() const {
+        std::vector<kernels::SimdLevel> levels;
+        for (auto level : {kernels::SimdLevel::Scalar, kernels::SimdLevel::SSE2,
+                           kernels::SimdLevel::AVX2, kernels::SimdLevel::AVX512}) {
+            if (level <= kernels::detectSimdLevel()) levels.push_back(level);
+        }
+        return levels;
+    }
+
+    kernels::SimdLevel previousLevel = kernels::SimdLevel::Scalar;
+};
+
+} // namespace
+
+TEST_F(MatrixBatchTest, PacksAndUnpacksMatrices) {
+    // 13 матриц: вторая группа заполнена не полностью
+    const std::vector<RealMatrix> matrices = makeMatrices(13, 3, 5, 0.2);
+    MatrixBatch batch(matrices);
+    EXPECT_EQ(batch.getCount(), 13u);
+    EXPECT_EQ(batch.getRows(), 3u);
+    EXPECT_EQ(batch.getCols(), 5u);
+
+    // Раскладка: элемент (i, j) матрицы b в группе b / 8, линии b % 8
+    EXPECT_DOUBLE_EQ(batch.getData()[1 * 15 * 8 + (2 * 5 + 4) * 8 + 3], matrices[11].getValue(2, 4));
+    EXPECT_DOUBLE_EQ(batch.getValue(11, 2, 4), matrices[11].getValue(2, 4));
+
+    const std::vector<RealMatrix> unpacked = batch.toMatrices();
+    ASSERT_EQ(unpacked.size(), matrices.size());
+    for (std::size_t b = 0; b < matrices.size(); ++b) {
+        EXPECT_EQ(unpacked[b], matrices[b]);
+    }
+
+    batch.setValue(12, 0, 0, 42.0);
+    EXPECT_DOUBLE_EQ(batch.getMatrix(12).getValue(0, 0), 42.0);
+    EXPECT_THROW(batch.getValue(13, 0, 0), std::out_of_range);
+    EXPECT_THROW(batch.setMatrix(0, RealMatrix(5, 3)), std::invalid_argument);
+    EXPECT_THROW(MatrixBatch(makeMatrices(1, 2, 2, 0.0)) * MatrixBatch(makeMatrices(1, 3, 2, 0.0)),
+                 std::invalid_argument);
+}
+
+TEST_F(MatrixBatchTest, MultiplyAndTransposeMatchRealMatrix) {
+    const std::vector<RealMatrix> left = makeMatrices(21, 6, 4, 0.5);
+    const std::vector<RealMatrix> right = makeMatrices(21, 4, 7, 1.3);
+    for (auto level : supportedLevels()) {
+        SCOPED_TRACE(kernels::simdLevelName(level));
+        kernels::setSimdLevel(level);
+        const MatrixBatch product = MatrixBatch(left) * MatrixBatch(right);
+        const MatrixBatch transposed = MatrixBatch(left).computeTranspose();
+        for (std::size_t b = 0; b < left.size(); ++b) {
+            EXPECT_LT(maxDifference(product.getMatrix(b), left[b] * right[b]), 1e-13);
+            EXPECT_EQ(transposed.getMatrix(b), left[b].computeTranspose());
+        }
+    }
+}
+
+TEST_F(MatrixBatchTest, DeterminantsAndSolveMatchLU) {
+    // Матрицы, которым нужна перестановка строк: ноль в левом верхнем углу
+    std::vector<RealMatrix> matrices = makeRegularMatrices(19, 8, 0.9);
+    for (std::size_t b = 0; b < matrices.size(); b += 3) {
+        matrices[b].setValue(0, 0, 0.0);
+    }
+    const std::vector<RealMatrix> rhs = makeMatrices(19, 8, 2, 2.4);
+
+    for (auto level : supportedLevels()) {
+        SCOPED_TRACE(kernels::simdLevelName(level));
+        kernels::setSimdLevel(level);
+        const MatrixBatch batch(matrices);
+        const std::vector<double> determinants = batch.calculateDeterminants();
+        const MatrixBatch solution = batch.solve(MatrixBatch(rhs));
+        ASSERT_EQ(determinants.size(), matrices.size());
+        for (std::size_t b = 0; b < matrices.size(); ++b) {
+            const LUDecomposition lu(matrices[b]);
+            EXPECT_NEAR(determinants[b], lu.determinant(), 1e-12 * std::max(1.0, std::abs(lu.determinant())));
+            EXPECT_LT(maxDifference(solution.getMatrix(b), lu.solve(rhs[b])), 1e-9);
+        }
+
+        // 19 = 2 * 8 + 3: линии 3..7 последней группы - нулевое дополнение,
+        // обратный ход не должен оставить в них 0 / 0
+        const std::size_t elements = 8 * 2;
+        const double* lastGroup = solution.getData() + 2 * elements * MatrixBatch::BATCH_LANES;
+        for (std::size_t e = 0; e < elements; ++e) {
+            for (std::size_t lane = 3; lane < MatrixBatch::BATCH_LANES; ++lane) {
+                EXPECT_EQ(lastGroup[e * MatrixBatch::BATCH_LANES + lane], 0.0);
+            }
+        }
+    }
+}
+
+TEST_F(MatrixBatchTest, SingularMatrixIsReported) {
+    std::vector<RealMatrix> matrices = makeRegularMatrices(10, 3, 0.1);
+    // Матрица 9 с двумя одинаковыми строками
+    for (std::size_t j = 0; j < 3; ++j) {
+        matrices[9].setValue(2, j, matrices[9].getValue(0, j));
+    }
+    const MatrixBatch batch(matrices);
+    EXPECT_DOUBLE_EQ(batch.calculateDeterminants()[9], 0.0);
+    try {
+        batch.solve(MatrixBatch(makeMatrices(10, 3, 1, 0.0)));
+        FAIL() << "solve must reject a singular matrix";
+    } catch (const std::runtime_error& error) {
+        EXPECT_NE(std::string(error.what()).find("Matrix 9"), std::string::npos);
+    }
+    EXPECT_THROW(MatrixBatch(makeMatrices(2, 2, 3, 0.0)).calculateDeterminants(), std::invalid_argument);
+}
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <utility>
+#include "matrix/Matrix.h"
+
+namespace {
+
+// Разные значения в каждой ячейке, 7 столбцов дают выравнивающий хвост строки
+RealMatrix makeFilled(std::size_t rows, std::size_t cols, double seed) {
+    RealMatrix m(rows, cols);
+    for (std::size_t i = 0; i < rows; ++i) {
+        for (std::size_t j = 0; j < cols; ++j) {
+            m.setValue(i, j, seed + 0.5 * static_cast<double>(i) - 0.25 * static_cast<double>(j));
+        }
+    }
+    return m;
+}
+
+} // namespace
+
+TEST(MatrixExpressionTest, FusedExpressionMatchesElementwiseResult) {
+    RealMatrix a = makeFilled(5, 7, 1.0);
+    RealMatrix b = makeFilled(5, 7, -2.0);
+    RealMatrix c = makeFilled(5, 7, 3.5);
+
+    RealMatrix result = a + b * 2.0 - c / 4.0;
+    ASSERT_EQ(result.getRows(), 5u);
+    ASSERT_EQ(result.getCols(), 7u);
+    for (std::size_t i = 0; i < 5; ++i) {
+        for (std::size_t j = 0; j < 7; ++j) {
+            double expected = a.getValue(i, j) + b.getValue(i, j) * 2.0 - c.getValue(i, j) * 0.25;
+            EXPECT_DOUBLE_EQ(result.getValue(i, j), expected);
+        }
+        // Хвост строки остаётся нулевым
+        for (std::size_t j = 7; j < result.getRowStride(); ++j) {
+            EXPECT_EQ(result.getData()[i * result.getRowStride() + j], 0.0);
+        }
+    }
+}
+
+TEST(MatrixExpressionTest, SpansLongerThanOneBlock) {
+    RealMatrix a = makeFilled(40, 64, 0.0);
+    RealMatrix b = makeFilled(40, 64, 1.0);
+
+    RealMatrix result = 3.0 * a - b;
+    for (std::size_t i = 0; i < 40; i += 13) {
+        for (std::size_t j = 0; j < 64; j += 9) {
+            EXPECT_DOUBLE_EQ(result.getValue(i, j), 3.0 * a.getValue(i, j) - b.getValue(i, j));
+        }
+    }
+}
+
+TEST(MatrixExpressionTest, DimensionsCheckedWhenExpressionIsBuilt) {
+    RealMatrix a(2, 3, 1.0);
+    RealMatrix b(2, 3, 1.0);
+    RealMatrix c(3, 2, 1.0);
+
+    EXPECT_THROW(a + b - c, std::invalid_argument);
+    EXPECT_THROW(a * 2.0 + c, std::invalid_argument);
+    EXPECT_THROW((a + b) / 0.0, std::invalid_argument);
+    EXPECT_THROW((a + b) * (a - b), std::invalid_argument);
+}
+
+TEST(MatrixExpressionTest, AssignmentReusesDestinationBuffer) {
+    RealMatrix a(4, 5, 1.0);
+    RealMatrix b(4, 5, 2.0);
+    const double* buffer = a.getData();
+
+    // Результат пишется поверх операнда
+    a = a + b * 3.0;
+    EXPECT_EQ(a.getData(), buffer);
+    EXPECT_DOUBLE_EQ(a.getValue(3, 4), 7.0);
+
+    a = b - a;
+    EXPECT_EQ(a.getData(), buffer);
+    EXPECT_DOUBLE_EQ(a.getValue(0, 0), -5.0);
+
+    RealMatrix other(2, 2);
+    other = a * 0.5;
+    EXPECT_EQ(other.getRows(), 4u);
+    EXPECT_DOUBLE_EQ(other.getValue(2, 2), -2.5);
+}
+
+TEST(MatrixExpressionTest, TemporaryOperandBecomesResult) {
+    RealMatrix a(3, 3, 1.0);
+    RealMatrix b(3, 3, 2.0);
+    RealMatrix c(3, 3, 4.0);
+    const double* buffer = b.getData();
+
+    RealMatrix result = a + std::move(b) * 2.0 - c;
+    EXPECT_EQ(result.getData(), buffer);
+    EXPECT_DOUBLE_EQ(result.getValue(1, 2), 1.0);
+}
+
+TEST(MatrixExpressionTest, ExpressionIsEvaluatedLazily) {
+    RealMatrix a(2, 2, 1.0);
+    RealMatrix b(2, 2, 2.0);
+    auto sum = a + b;
+
+    EXPECT_EQ(sum.getRows(), 2u);
+    EXPECT_EQ(sum.getCols(), 2u);
+    EXPECT_DOUBLE_EQ(sum.evaluate().getValue(0, 0), 3.0);
+
+    a.setValue(0, 0, 10.0);
+    RealMatrix result = sum;
+    EXPECT_DOUBLE_EQ(result.getValue(0, 0), 12.0);
+    EXPECT_DOUBLE_EQ(result.getValue(1, 1), 3.0);
+}
+
+TEST(MatrixExpressionTest, MatrixProductMaterializesOperands) {
+    RealMatrix a = makeFilled(3, 4, 1.0);
+    RealMatrix b = makeFilled(3, 4, 2.0);
+    RealMatrix c = makeFilled(4, 2, -1.0);
+
+    RealMatrix sum = a + b;
+    EXPECT_TRUE((a + b) * c == sum * c);
+    EXPECT_TRUE((a - b) * c * 2.0 == ((a - b).evaluate() * c) * 2.0);
+    EXPECT_FALSE((a + b) != sum);
+}
@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+#include "matrix/Matrix.h"
+#include "matrix/MatrixFile.h"
+
+namespace {
+
+RealMatrix makeSequence(std::size_t rows, std::size_t cols) {
+    RealMatrix m(rows, cols);
+    for (std::size_t i = 0; i < rows; ++i) {
+        for (std::size_t j = 0; j < cols; ++j) {
+            m.setValue(i, j, static_cast<double>(i * cols + j) * 0.25 - 7.0);
+        }
+    }
+    return m;
+}
+
+std::vector<char> readBytes(const char* filename) {
+    std::ifstream file(filename, std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+void writeBytes(const char* filename, const std::vector<char>& bytes) {
+    std::ofstream file(filename, std::ios::binary);
+    file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+} // namespace
+
+TEST(MatrixFileTest, BinaryRoundTripIsExact) {
+    RealMatrix original = makeSequence(7, 13);
+    original.setValue(3, 4, 1.0 / 3.0);
+    ASSERT_TRUE(original.saveBinary("binary_matrix.bin"));
+
+    // Заголовок 64 байта, данные с шагом строки матрицы
+    std::vector<char> bytes = readBytes("binary_matrix.bin");
+    EXPECT_EQ(bytes.size(), binary_format::HEADER_SIZE + 7 * original.getRowStride() * sizeof(double));
+
+    RealMatrix loaded;
+    ASSERT_TRUE(loaded.loadBinary("binary_matrix.bin"));
+    EXPECT_EQ(loaded.getRows(), 7u);
+    EXPECT_EQ(loaded.getCols(), 13u);
+    for (std::size_t i = 0; i < 7; ++i) {
+        for (std::size_t j = 0; j < 13; ++j) {
+            EXPECT_EQ(loaded.getValue(i, j), original.getValue(i, j));
+        }
+    }
+
+    std::remove("binary_matrix.bin");
+}
+
+TEST(MatrixFileTest, CorruptedFilesAreRejected) {
+    RealMatrix original = makeSequence(4, 4);
+    ASSERT_TRUE(original.saveBinary("corrupt_matrix.bin"));
+    const std::vector<char> bytes = readBytes("corrupt_matrix.bin");
+
+    RealMatrix m(2, 2, 5.0);
+
+    std::vector<char> flipped = bytes;
+    flipped[binary_format::HEADER_SIZE + 17] ^= 0x40;
+    writeBytes("corrupt_matrix.bin", flipped);
+    EXPECT_FALSE(m.loadBinary("corrupt_matrix.bin"));
+    EXPECT_THROW(MappedMatrix("corrupt_matrix.bin"), std::runtime_error);
+
+    std::vector<char> truncated(bytes.begin(), bytes.end() - 8);
+    writeBytes("corrupt_matrix.bin", truncated);
+    EXPECT_FALSE(m.loadBinary("corrupt_matrix.bin"));
+    EXPECT_THROW(MappedMatrix("corrupt_matrix.bin", false), std::runtime_error);
+
+    std::vector<char> wrongMagic = bytes;
+    wrongMagic[0] = 'X';
+    writeBytes("corrupt_matrix.bin", wrongMagic);
+    EXPECT_FALSE(m.loadBinary("corrupt_matrix.bin"));
+
+    // Размеры 2^26 x 2^26 в заголовке при 128 байтах данных: отказ без
+    // попытки выделить 2^52 значений
+    std::vector<char> forged = bytes;
+    const std::uint64_t huge = std::uint64_t(1) << 26;
+    for (std::size_t offset = 24; offset < 48; offset += 8) {
+        std::memcpy(forged.data() + offset, &huge, sizeof(huge));
+    }
+    writeBytes("corrupt_matrix.bin", forged);
+    EXPECT_FALSE(m.loadBinary("corrupt_matrix.bin"));
+    EXPECT_THROW(MappedMatrix("corrupt_matrix.bin", false), std::runtime_error);
+
+    // Неудачная загрузка не меняет матрицу
+    EXPECT_TRUE(m == RealMatrix(2, 2, 5.0));
+    EXPECT_FALSE(m.loadBinary("nonexistent_matrix.bin"));
+    EXPECT_THROW(MappedMatrix("nonexistent_matrix.bin"), std::runtime_error);
+    EXPECT_FALSE(RealMatrix().saveBinary("corrupt_matrix.bin"));
+
+    std::remove("corrupt_matrix.bin");
+}
+
+TEST(MatrixFileTest, ForeignByteOrderIsConverted) {
+    RealMatrix original = makeSequence(3, 5);
+    ASSERT_TRUE(original.saveBinary("swapped_matrix.bin"));
+    std::vector<char> bytes = readBytes("swapped_matrix.bin");
+
+    // Переворачиваем каждое поле заголовка и каждое значение
+    auto reverse = [&](std::size_t offset, std::size_t size) {
+        std::reverse(bytes.begin() + static_cast<std::ptrdiff_t>(offset),
+                     bytes.begin() + static_cast<std::ptrdiff_t>(offset + size));
+    };
+    for (std::size_t offset = 8; offset < 24; offset += 4) reverse(offset, 4);
+    for (std::size_t offset = 24; offset < 56; offset += 8) reverse(offset, 8);
+    for (std::size_t offset = binary_format::HEADER_SIZE; offset < bytes.size(); offset += 8) reverse(offset, 8);
+    writeBytes("swapped_matrix.bin", bytes);
+
+    RealMatrix loaded;
+    ASSERT_TRUE(loaded.loadBinary("swapped_matrix.bin"));
+    EXPECT_TRUE(loaded == original);
+    EXPECT_THROW(MappedMatrix("swapped_matrix.bin"), std::runtime_error);
+
+    std::remove("swapped_matrix.bin");
+}
+
+TEST(MatrixFileTest, MappedMatrixUsesFilePages) {
+    RealMatrix original = makeSequence(9, 6);
+    ASSERT_TRUE(original.saveBinary("mapped_matrix.bin"));
+
+    MappedMatrix mapped("mapped_matrix.bin");
+    EXPECT_EQ(mapped.getRows(), 9u);
+    EXPECT_EQ(mapped.getCols(), 6u);
+    EXPECT_DOUBLE_EQ(mapped.getValue(8, 5), original.getValue(8, 5));
+    EXPECT_THROW(mapped.getValue(9, 0), std::out_of_range);
+
+    // Данные начинаются с границы строки кэша
+    ConstMatrixView values = mapped.view();
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(values.getData()) % MATRIX_ALIGNMENT, 0u);
+
+    // Представление участвует в выражениях и умножении как обычная матрица
+    EXPECT_TRUE(RealMatrix(values * 2.0) == original * 2.0);
+    EXPECT_TRUE(values.transposedView() * original == original.computeTranspose() * original);
+    EXPECT_TRUE(mapped.toMatrix() == original);
+
+    MappedMatrix moved(std::move(mapped));
+    EXPECT_DOUBLE_EQ(moved.view().getValue(2, 3), original.getValue(2, 3));
+
+    std::remove("mapped_matrix.bin");
+}
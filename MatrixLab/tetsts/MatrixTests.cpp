@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 #include <fstream>
 #include <sstream>
+#include <cstdint>
+#include <utility>
 #include "matrix/Matrix.h"
 
 class RealMatrixTest : public ::testing::Test {
@@ -903,4 +905,309 @@ TEST_F(RealMatrixTest, TransposeOfTranspose) {
     RealMatrix originalAgain = transposed.computeTranspose();
 
     EXPECT_TRUE(original == originalAgain);
-}
\ No newline at end of file
+}
+// Тесты непрерывного хранения
+TEST_F(RealMatrixTest, ContiguousStorageIsAligned) {
+    RealMatrix m(5, 3, 1.0);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(m.getData()) % MATRIX_ALIGNMENT, 0u);
+    EXPECT_GE(m.getRowStride(), m.getCols());
+    EXPECT_EQ(m.getRowStride() * sizeof(double) % MATRIX_ALIGNMENT, 0u);
+
+    m.setValue(2, 1, 7.0);
+    EXPECT_DOUBLE_EQ(m.getData()[2 * m.getRowStride() + 1], 7.0);
+}
+
+TEST_F(RealMatrixTest, RowPaddingDoesNotAffectResults) {
+    RealMatrix m(3, 3, 2.0);
+    ++m;
+    m *= 2.0;
+
+    EXPECT_DOUBLE_EQ(m.calculateNorm(), 18.0);
+    for (std::size_t i = 0; i < m.getRows(); ++i) {
+        for (std::size_t j = m.getCols(); j < m.getRowStride(); ++j) {
+            EXPECT_DOUBLE_EQ(m.getData()[i * m.getRowStride() + j], 0.0);
+        }
+    }
+}
+
+TEST_F(RealMatrixTest, ChangeSizeAcrossStrideBoundary) {
+    RealMatrix m(2, 7);
+    for (std::size_t j = 0; j < 7; ++j) {
+        m.setValue(1, j, j + 1.0);
+    }
+
+    m.changeSize(3, 10, -1.0);
+    EXPECT_EQ(m.getRowStride() % (MATRIX_ALIGNMENT / sizeof(double)), 0u);
+    EXPECT_DOUBLE_EQ(m.getValue(1, 6), 7.0);
+    EXPECT_DOUBLE_EQ(m.getValue(1, 7), -1.0);
+    EXPECT_DOUBLE_EQ(m.getValue(2, 0), -1.0);
+}
+
+// Тесты LU-определителя
+TEST_F(RealMatrixTest, DeterminantOfLargeTridiagonalMatrix) {
+    // Трёхдиагональная матрица (2, -1): определитель равен n + 1
+    const std::size_t n = 200;
+    RealMatrix m(n, n, 0.0);
+    for (std::size_t i = 0; i < n; ++i) {
+        m.setValue(i, i, 2.0);
+        if (i + 1 < n) {
+            m.setValue(i, i + 1, -1.0);
+            m.setValue(i + 1, i, -1.0);
+        }
+    }
+
+    EXPECT_NEAR(m.calculateDeterminant(), 201.0, 1e-9);
+}
+
+TEST_F(RealMatrixTest, DeterminantTracksRowSwapSign) {
+    RealMatrix m(3, 3, 0.0);
+    m.setValue(0, 1, 2.0);
+    m.setValue(1, 0, 3.0);
+    m.setValue(2, 2, 4.0);
+
+    EXPECT_DOUBLE_EQ(m.calculateDeterminant(), -24.0);
+
+    int sign = 0;
+    EXPECT_NEAR(m.calculateLogDeterminant(sign), std::log(24.0), 1e-14);
+    EXPECT_EQ(sign, -1);
+}
+
+TEST_F(RealMatrixTest, LogDeterminantAvoidsOverflow) {
+    std::vector<double> diagonal(400, 10.0);
+    diagonal[7] = -10.0;
+    RealMatrix m = RealMatrix::createDiagonal(diagonal);
+
+    EXPECT_TRUE(std::isinf(m.calculateDeterminant()));
+
+    int sign = 0;
+    EXPECT_NEAR(m.calculateLogDeterminant(sign), 400.0 * std::log(10.0), 1e-9);
+    EXPECT_EQ(sign, -1);
+}
+
+TEST_F(RealMatrixTest, LogDeterminantOfSingularMatrix) {
+    RealMatrix m(3, 3, 1.0);
+    int sign = 5;
+    EXPECT_TRUE(std::isinf(m.calculateLogDeterminant(sign)));
+    EXPECT_EQ(sign, 0);
+    EXPECT_DOUBLE_EQ(m.calculateDeterminant(), 0.0);
+
+    RealMatrix nonSquare(2, 3);
+    EXPECT_THROW(nonSquare.calculateLogDeterminant(sign), std::invalid_argument);
+}
+
+TEST_F(RealMatrixTest, MoveLeavesSourceEmpty) {
+    RealMatrix source(3, 5, 2.0);
+    const double* buffer = source.getData();
+
+    RealMatrix moved(std::move(source));
+    EXPECT_EQ(moved.getData(), buffer);
+    EXPECT_EQ(moved.getRows(), 3);
+    EXPECT_EQ(moved.getCols(), 5);
+    EXPECT_EQ(source.getRows(), 0);
+    EXPECT_EQ(source.getCols(), 0);
+
+    RealMatrix assigned;
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned.getData(), buffer);
+    EXPECT_DOUBLE_EQ(assigned.getValue(2, 4), 2.0);
+    EXPECT_EQ(moved.getRows(), 0);
+}
+
+TEST_F(RealMatrixTest, CompoundOperatorsWorkInPlace) {
+    RealMatrix m(4, 5, 1.0);
+    RealMatrix other(4, 5, 3.0);
+    const double* buffer = m.getData();
+
+    m += other;
+    m -= RealMatrix(4, 5, 0.5);
+    m *= 2.0;
+    m /= 7.0;
+    ++m;
+    --m;
+
+    EXPECT_EQ(m.getData(), buffer);
+    EXPECT_DOUBLE_EQ(m.getValue(3, 4), 1.0);
+
+    RealMatrix wrongSize(5, 4);
+    EXPECT_THROW(m += wrongSize, std::invalid_argument);
+    EXPECT_THROW(m -= wrongSize, std::invalid_argument);
+    EXPECT_THROW(m /= 0.0, std::invalid_argument);
+}
+
+TEST_F(RealMatrixTest, TemporaryOperandReusesBuffer) {
+    RealMatrix a(3, 3, 1.0);
+    RealMatrix b(3, 3, 2.0);
+    const double* buffer = a.getData();
+
+    RealMatrix sum = std::move(a) + b;
+    EXPECT_EQ(sum.getData(), buffer);
+
+    RealMatrix chained = ((sum - b) * 4.0) / 2.0;
+    EXPECT_NE(chained.getData(), sum.getData());
+    EXPECT_DOUBLE_EQ(chained.getValue(1, 1), 2.0);
+    EXPECT_DOUBLE_EQ(sum.getValue(1, 1), 3.0);
+}
+
+TEST_F(RealMatrixTest, PostfixIncrementReturnsPreviousValues) {
+    RealMatrix m(2, 3, 1.0);
+    const double* buffer = m.getData();
+
+    RealMatrix before = m++;
+    EXPECT_EQ(before.getData(), buffer);
+    EXPECT_DOUBLE_EQ(before.getValue(1, 2), 1.0);
+    EXPECT_DOUBLE_EQ(m.getValue(1, 2), 2.0);
+
+    RealMatrix beforeDecrement = m--;
+    EXPECT_DOUBLE_EQ(beforeDecrement.getValue(0, 0), 2.0);
+    EXPECT_DOUBLE_EQ(m.getValue(0, 0), 1.0);
+}
+
+TEST_F(RealMatrixTest, StructureCacheFollowsMutations) {
+    RealMatrix m = upperTriangular;
+    EXPECT_TRUE(m.checkIsUpperTriangular());
+    EXPECT_FALSE(m.checkIsLowerTriangular());
+
+    m.setValue(2, 0, 1.0);
+    EXPECT_FALSE(m.checkIsUpperTriangular());
+    m.setValue(2, 0, 0.0);
+    EXPECT_TRUE(m.checkIsUpperTriangular());
+
+    // Запись через изменяемый указатель и представление тоже сбрасывает кэш
+    m.getData()[m.getRowStride()] = 7.0;
+    EXPECT_FALSE(m.checkIsUpperTriangular());
+    m.view().setValue(1, 0, 0.0);
+    EXPECT_TRUE(m.checkIsUpperTriangular());
+
+    m += lowerTriangular;
+    EXPECT_FALSE(m.checkIsUpperTriangular());
+    m = diagonalMatrix + diagonalMatrix;
+    EXPECT_TRUE(m.checkIsDiagonal());
+    m.changeSize(3, 4);
+    EXPECT_FALSE(m.checkIsDiagonal());
+
+    // Транспонирование на месте меняет треугольности местами
+    RealMatrix t = upperTriangular;
+    EXPECT_TRUE(t.checkIsUpperTriangular());
+    t.transposeInPlace();
+    EXPECT_TRUE(t.checkIsLowerTriangular());
+    EXPECT_FALSE(t.checkIsUpperTriangular());
+    EXPECT_TRUE(t == upperTriangular.computeTranspose());
+
+    // Копия наследует кэш, но изменяется независимо
+    RealMatrix copy = symmetricMatrix;
+    EXPECT_TRUE(copy.checkIsSymmetric());
+    copy.setValue(0, 1, -2.0);
+    EXPECT_FALSE(copy.checkIsSymmetric());
+    EXPECT_TRUE(symmetricMatrix.checkIsSymmetric());
+}
+
+TEST_F(RealMatrixTest, StructureCacheFollowsWritesThroughHeldView) {
+    // Представление получено до запроса свойств и пишет после него
+    RealMatrix a = RealMatrix::createIdentity(3);
+    MatrixView v = a.view();
+    EXPECT_DOUBLE_EQ(a.calculateDeterminant(), 1.0);
+    v.setValue(0, 0, 0.0);
+    v.setValue(1, 0, 1.0);
+    v.setValue(0, 1, 1.0);
+    EXPECT_FALSE(a.checkIsDiagonal());
+    EXPECT_DOUBLE_EQ(a.calculateDeterminant(), -1.0);
+
+    const RealMatrix rhs({{1.0, 2.0}, {3.0, 4.0}, {5.0, 6.0}});
+    EXPECT_TRUE(a * rhs == RealMatrix({{3.0, 4.0}, {4.0, 6.0}, {5.0, 6.0}}));
+    EXPECT_TRUE(a.computeTranspose() == a);
+
+    // Подпредставления, присваивание, составные операторы и указатель
+    RealMatrix b = RealMatrix::createIdentity(3);
+    MatrixView whole = b.view();
+    MatrixView lower = whole.row(2);
+    MatrixView transposed = whole.transposedView();
+    EXPECT_TRUE(b.checkIsDiagonal());
+    lower.setValue(0, 2, 4.0);
+    EXPECT_TRUE(b.checkIsDiagonal());
+    lower.setValue(0, 1, 4.0);
+    EXPECT_FALSE(b.checkIsDiagonal());
+    whole = RealMatrix::createIdentity(3);
+    EXPECT_TRUE(b.checkIsIdentity());
+    transposed.row(0) += RealMatrix({{0.0, 2.0, 0.0}});
+    EXPECT_TRUE(b.checkIsLowerTriangular());
+    EXPECT_FALSE(b.checkIsUpperTriangular());
+    whole *= 0.0;
+    EXPECT_TRUE(b.checkIsUpperTriangular());
+    EXPECT_TRUE(b.checkIsZero());
+    whole.col(2).fill(1.0);
+    EXPECT_TRUE(b.checkIsUpperTriangular());
+    EXPECT_FALSE(b.checkIsLowerTriangular());
+    double* data = whole.getData();
+    EXPECT_TRUE(b.checkIsUpperTriangular());
+    data[2 * b.getRowStride()] = 5.0;
+    whole.getData();
+    EXPECT_FALSE(b.checkIsUpperTriangular());
+}
+
+TEST_F(RealMatrixTest, StructuredOperationsMatchGeneralPath) {
+    // Размеры выше порога маленьких произведений: работает быстрый путь
+    std::vector<double> diagonal(40);
+    for (std::size_t i = 0; i < diagonal.size(); ++i) diagonal[i] = 1.0 + 0.25 * i;
+    RealMatrix bigDiagonal = RealMatrix::createDiagonal(diagonal);
+    RealMatrix dense(40, 45);
+    RealMatrix denseLeft(35, 40);
+    for (std::size_t i = 0; i < 40; ++i) {
+        for (std::size_t j = 0; j < 45; ++j) dense.setValue(i, j, 1.0 + i * 4.0 - j);
+    }
+    for (std::size_t i = 0; i < 35; ++i) {
+        for (std::size_t j = 0; j < 40; ++j) denseLeft.setValue(i, j, 0.5 * i - j);
+    }
+
+    // Диагональный множитель слева и справа
+    RealMatrix scaledRows = bigDiagonal * dense;
+    RealMatrix scaledCols = denseLeft * bigDiagonal;
+    EXPECT_TRUE(scaledRows == RealMatrix::multiply(bigDiagonal.view(), dense.view()));
+    EXPECT_TRUE(scaledCols == RealMatrix::multiply(denseLeft.view(), bigDiagonal.view()));
+    EXPECT_THROW(bigDiagonal * denseLeft, std::invalid_argument);
+
+    // Треугольный определитель - произведение диагонали
+    EXPECT_DOUBLE_EQ(upperTriangular.calculateDeterminant(), 24.0);
+    EXPECT_DOUBLE_EQ(lowerTriangular.calculateDeterminant(), 18.0);
+    int sign = 0;
+    EXPECT_NEAR(lowerTriangular.calculateLogDeterminant(sign), std::log(18.0), 1e-14);
+    EXPECT_EQ(sign, 1);
+
+    // Решение подстановкой совпадает с LU
+    RealMatrix rhs(3, 2);
+    for (std::size_t i = 0; i < 3; ++i) {
+        rhs.setValue(i, 0, 1.0 + i);
+        rhs.setValue(i, 1, -2.0 * i);
+    }
+    for (const RealMatrix* a : {&upperTriangular, &lowerTriangular, &diagonalMatrix, &symmetricMatrix}) {
+        RealMatrix x = a->solve(rhs);
+        EXPECT_TRUE(*a * x == rhs);
+    }
+    RealMatrix singular = upperTriangular;
+    singular.setValue(1, 1, 0.0);
+    EXPECT_THROW(singular.solve(rhs), std::runtime_error);
+    EXPECT_THROW(dense.solve(rhs), std::invalid_argument);
+
+    // Симметричная матрица транспонируется копированием
+    RealMatrix transposed = symmetricMatrix.computeTranspose();
+    EXPECT_NE(transposed.getData(), symmetricMatrix.getData());
+    EXPECT_TRUE(transposed == symmetricMatrix);
+    RealMatrix inPlace = symmetricMatrix;
+    inPlace.transposeInPlace();
+    EXPECT_TRUE(inPlace == symmetricMatrix);
+}
+
+TEST_F(RealMatrixTest, StructureToleranceDoesNotChangeResults) {
+    // Почти диагональная матрица проходит checkIsDiagonal, но умножается
+    // общим путём: малые элементы вне диагонали не теряются
+    RealMatrix nearlyDiagonal = RealMatrix::createDiagonal({2.0, 3.0});
+    nearlyDiagonal.setValue(0, 1, 1e-13);
+    EXPECT_TRUE(nearlyDiagonal.checkIsDiagonal());
+
+    nearlyDiagonal.changeSize(40, 40);
+    for (std::size_t i = 2; i < 40; ++i) nearlyDiagonal.setValue(i, i, 1.0);
+    EXPECT_TRUE(nearlyDiagonal.checkIsDiagonal());
+
+    RealMatrix b(40, 40, 1e12);
+    RealMatrix product = nearlyDiagonal * b;
+    EXPECT_DOUBLE_EQ(product.getValue(0, 0), 2e12 + 0.1);
+}
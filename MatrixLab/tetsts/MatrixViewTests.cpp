@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <stdexcept>
+#include "matrix/Matrix.h"
+
+namespace {
+
+RealMatrix makeSequence(std::size_t rows, std::size_t cols) {
+    RealMatrix m(rows, cols);
+    for (std::size_t i = 0; i < rows; ++i) {
+        for (std::size_t j = 0; j < cols; ++j) {
+            m.setValue(i, j, static_cast<double>(i * cols + j) * 0.5 - 3.0);
+        }
+    }
+    return m;
+}
+
+} // namespace
+
+TEST(MatrixViewTest, ViewsShareStorage) {
+    RealMatrix m = makeSequence(4, 5);
+
+    ConstMatrixView block = static_cast<const RealMatrix&>(m).view(1, 2, 2, 3);
+    EXPECT_EQ(block.getRows(), 2u);
+    EXPECT_EQ(block.getCols(), 3u);
+    EXPECT_DOUBLE_EQ(block.getValue(1, 2), m.getValue(2, 4));
+
+    MatrixView column = m.col(3);
+    column.setValue(2, 0, 42.0);
+    EXPECT_DOUBLE_EQ(m.getValue(2, 3), 42.0);
+
+    MatrixView transposed = m.transposedView();
+    EXPECT_EQ(transposed.getRows(), 5u);
+    EXPECT_DOUBLE_EQ(transposed.getValue(3, 2), 42.0);
+    EXPECT_DOUBLE_EQ(transposed.row(4).getValue(0, 1), m.getValue(1, 4));
+    EXPECT_DOUBLE_EQ(transposed.view(1, 2, 3, 2).getValue(2, 1), m.getValue(3, 3));
+
+    EXPECT_THROW(m.view(3, 0, 2, 1), std::out_of_range);
+    EXPECT_THROW(m.row(4), std::out_of_range);
+    EXPECT_THROW(block.getValue(2, 0), std::out_of_range);
+}
+
+TEST(MatrixViewTest, ViewsTakePartInExpressions) {
+    RealMatrix a = makeSequence(6, 6);
+    RealMatrix b = makeSequence(6, 6) * 2.0;
+
+    RealMatrix sum = a.transposedView() + b.view(0, 0, 6, 6) * 0.5;
+    RealMatrix expected = a.computeTranspose() + a;
+    EXPECT_TRUE(sum == expected);
+
+    RealMatrix rows = a.row(1) - a.row(4);
+    EXPECT_EQ(rows.getRows(), 1u);
+    EXPECT_DOUBLE_EQ(rows.getValue(0, 5), -9.0);
+
+    EXPECT_THROW(a.row(0) + a.col(0), std::invalid_argument);
+}
+
+TEST(MatrixViewTest, AssignmentWritesThroughView) {
+    RealMatrix m = makeSequence(4, 4);
+    RealMatrix original = m;
+
+    // Элементарное преобразование строк без копирования
+    m.row(2) -= m.row(0) * 3.0;
+    for (std::size_t j = 0; j < 4; ++j) {
+        EXPECT_DOUBLE_EQ(m.getValue(2, j), original.getValue(2, j) - 3.0 * original.getValue(0, j));
+    }
+
+    m.col(1) = original.col(3);
+    EXPECT_DOUBLE_EQ(m.getValue(3, 1), original.getValue(3, 3));
+
+    m.view(0, 0, 2, 2).fill(7.0);
+    EXPECT_DOUBLE_EQ(m.getValue(1, 1), 7.0);
+    EXPECT_DOUBLE_EQ(m.getValue(1, 2), original.getValue(1, 2));
+
+    m.view(2, 2, 2, 2) /= 2.0;
+    EXPECT_DOUBLE_EQ(m.getValue(3, 3), original.getValue(3, 3) / 2.0);
+
+    EXPECT_THROW(m.row(0) = original.col(0), std::invalid_argument);
+}
+
+TEST(MatrixViewTest, OverlappingAssignmentIsSafe) {
+    RealMatrix m = makeSequence(5, 5);
+    RealMatrix original = m;
+
+    m.view() = m.transposedView();
+    EXPECT_TRUE(m == original.computeTranspose());
+
+    m = original;
+    m.view(0, 0, 4, 4) = m.view(1, 1, 4, 4);
+    EXPECT_TRUE(m.view(0, 0, 4, 4) == original.view(1, 1, 4, 4));
+
+    m = original;
+    m = m.transposedView() * 2.0;
+    EXPECT_TRUE(m == original.computeTranspose() * 2.0);
+}
+
+TEST(MatrixViewTest, ProductOfViewsUsesStrides) {
+    RealMatrix a = makeSequence(70, 90);
+    RealMatrix b = makeSequence(60, 80);
+
+    RealMatrix product = a.view(5, 10, 50, 40) * b.view(3, 7, 50, 40).transposedView();
+    RealMatrix expected = a.extractSubmatrix(5, 10, 50, 40) *
+                          b.extractSubmatrix(3, 7, 50, 40).computeTranspose();
+    ASSERT_EQ(product.getRows(), 50u);
+    ASSERT_EQ(product.getCols(), 50u);
+    for (std::size_t i = 0; i < 50; i += 7) {
+        for (std::size_t j = 0; j < 50; j += 3) {
+            EXPECT_NEAR(product.getValue(i, j), expected.getValue(i, j),
+                        1e-12 * std::abs(expected.getValue(i, j)) + 1e-9);
+        }
+    }
+
+    RealMatrix mixed = a.transposedView() * (a + a);
+    EXPECT_TRUE(mixed == a.computeTranspose() * a * 2.0);
+    EXPECT_THROW(a.row(0) * b.row(0), std::invalid_argument);
+}
+
+TEST(MatrixViewTest, NormsAndPredicatesOnViews) {
+    RealMatrix m(4, 4, 0.0);
+    for (std::size_t i = 0; i < 4; ++i) {
+        for (std::size_t j = 0; j <= i; ++j) {
+            m.setValue(i, j, static_cast<double>(i + j + 1));
+        }
+    }
+
+    EXPECT_TRUE(m.view().checkIsLowerTriangular());
+    EXPECT_TRUE(m.transposedView().checkIsUpperTriangular());
+    EXPECT_FALSE(m.transposedView().checkIsLowerTriangular());
+    EXPECT_FALSE(m.view(0, 1, 2, 3).checkIsZero());
+    EXPECT_TRUE(m.view(0, 1, 1, 3).checkIsZero());
+    EXPECT_FALSE(m.view(1, 1, 2, 2).checkIsDiagonal());
+    EXPECT_DOUBLE_EQ(m.view(1, 1, 3, 3).calculateTrace(), 3.0 + 5.0 + 7.0);
+    EXPECT_DOUBLE_EQ(m.row(3).calculateNorm(), std::sqrt(16.0 + 25.0 + 36.0 + 49.0));
+    EXPECT_DOUBLE_EQ(m.col(0).calculateNorm(), m.transposedView().row(0).calculateNorm());
+    EXPECT_THROW(m.row(0).calculateTrace(), std::invalid_argument);
+
+    RealMatrix rotation = RealMatrix::createIdentity(3);
+    rotation.setValue(0, 0, 0.6);
+    rotation.setValue(0, 1, -0.8);
+    rotation.setValue(1, 0, 0.8);
+    rotation.setValue(1, 1, 0.6);
+    EXPECT_TRUE(rotation.transposedView().checkIsOrthogonal());
+    EXPECT_TRUE(rotation.view(2, 2, 1, 1).checkIsIdentity());
+    EXPECT_TRUE((m + m.transposedView()).evaluate().view(1, 1, 3, 3).checkIsSymmetric());
+}
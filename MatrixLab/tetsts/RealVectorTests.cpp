@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+#include "matrix/Gemv.h"
+#include "matrix/RealVector.h"
+#include "matrix/SimdKernels.h"
+#include "TestHelpers.h"
+
+namespace {
+
+using test_helpers::makeMatrix;
+using test_helpers::maxDifference;
+
+RealVector makeVector(std::size_t size, double seed) {
+    RealVector v(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        v.setValue(i, std::cos(seed + 0.91 * static_cast<double>(i)));
+    }
+    return v;
+}
+
+// Произведение через матрицу-столбец n x 1 и обычное умножение матриц
+RealVector referenceProduct(const ConstMatrixView& a, const RealVector& x) {
+    RealMatrix column(x.getSize(), 1);
+    for (std::size_t i = 0; i < x.getSize(); ++i) column.setValue(i, 0, x.getValue(i));
+    const RealMatrix product = RealMatrix::multiply(a, column.view());
+    RealVector result(product.getRows());
+    for (std::size_t i = 0; i < product.getRows(); ++i) result.setValue(i, product.getValue(i, 0));
+    return result;
+}
+
+} // namespace
+
+TEST(RealVectorTest, BlasLevelOneAndNorms) {
+    RealVector x(std::vector<double>{3.0, -4.0, 0.0, 12.0});
+    const RealVector y(std::vector<double>{1.0, 2.0, 3.0, 4.0});
+
+    EXPECT_DOUBLE_EQ(x.dot(y), 3.0 - 8.0 + 48.0);
+    EXPECT_DOUBLE_EQ(x.calculateNorm(), 13.0);
+    EXPECT_DOUBLE_EQ(x.calculateNorm1(), 19.0);
+    EXPECT_DOUBLE_EQ(x.calculateNormInf(), 12.0);
+
+    x.axpy(2.0, y);
+    EXPECT_EQ(x, RealVector(std::vector<double>{5.0, 0.0, 6.0, 20.0}));
+    EXPECT_EQ(x - y, RealVector(std::vector<double>{4.0, -2.0, 3.0, 16.0}));
+    EXPECT_EQ(0.5 * (x + y), RealVector(std::vector<double>{3.0, 1.0, 4.5, 12.0}));
+    EXPECT_EQ(x / 2.0, x * 0.5);
+
+    EXPECT_THROW(x.dot(RealVector(3)), std::invalid_argument);
+    EXPECT_THROW(x /= 0.0, std::invalid_argument);
+    EXPECT_THROW(x.getValue(4), std::out_of_range);
+}
+
+TEST(RealVectorTest, GemvMatchesMatrixProductOnAllLevels) {
+    const kernels::SimdLevel original = kernels::getSimdLevel();
+    // Нечётные размеры: хвосты строк и остаток строк после групп по четыре
+    const RealMatrix a = makeMatrix(103, 77, 0.4);
+    const RealVector x = makeVector(77, 1.1);
+    const RealVector z = makeVector(103, 2.3);
+    for (auto level : {kernels::SimdLevel::Scalar, kernels::SimdLevel::SSE2,
+                       kernels::SimdLevel::AVX2, kernels::SimdLevel::AVX512}) {
+        if (static_cast<int>(level) > static_cast<int>(kernels::detectSimdLevel())) break;
+        kernels::setSimdLevel(level);
+        SCOPED_TRACE(kernels::simdLevelName(level));
+
+        EXPECT_LT(maxDifference(a * x, referenceProduct(a.view(), x)), 1e-12);
+        EXPECT_LT(maxDifference(a.transposedView() * z, referenceProduct(a.transposedView(), z)), 1e-12);
+
+        const ConstMatrixView block = a.view(5, 3, 60, 41);
+        const RealVector xBlock = makeVector(41, 0.2);
+        EXPECT_LT(maxDifference(block * xBlock, referenceProduct(block, xBlock)), 1e-12);
+        const RealVector zBlock = makeVector(60, 0.9);
+        EXPECT_LT(maxDifference(block.transposedView() * zBlock,
+                                referenceProduct(block.transposedView(), zBlock)), 1e-12);
+
+        // y = 2 A x - y
+        RealVector y = z;
+        RealVector::multiply(a.view(), x, y, 2.0, -1.0);
+        EXPECT_LT(maxDifference(y, referenceProduct(a.view(), x) * 2.0 - z), 1e-12);
+    }
+    kernels::setSimdLevel(original);
+
+    RealVector wrong(10);
+    EXPECT_THROW(a * wrong, std::invalid_argument);
+    RealVector self = makeVector(103, 0.0);
+    const RealMatrix square = makeMatrix(103, 103, 0.0);
+    EXPECT_THROW(RealVector::multiply(square.view(), self, self), std::invalid_argument);
+}
+
+TEST(RealVectorTest, SymmetricProductReadsUpperTriangleOnly) {
+    const kernels::SimdLevel original = kernels::getSimdLevel();
+    // 301: несколько задач, остаток строк после групп по четыре
+    const std::size_t n = 301;
+    const RealMatrix base = makeMatrix(n, n, 0.8);
+    const RealMatrix symmetric = base + base.computeTranspose();
+    RealMatrix upperOnly(symmetric);
+    for (std::size_t i = 1; i < n; ++i) {
+        for (std::size_t j = 0; j < i; ++j) upperOnly.setValue(i, j, 1e300);
+    }
+    const RealVector x = makeVector(n, 0.6);
+    const RealVector z = makeVector(n, 1.4);
+    const RealVector expected = referenceProduct(symmetric.view(), x) * 0.5 + z * 2.0;
+    for (auto level : {kernels::SimdLevel::Scalar, kernels::SimdLevel::AVX2, kernels::SimdLevel::AVX512}) {
+        if (static_cast<int>(level) > static_cast<int>(kernels::detectSimdLevel())) break;
+        kernels::setSimdLevel(level);
+        SCOPED_TRACE(kernels::simdLevelName(level));
+        RealVector y = z;
+        kernels::symvUpper(n, 0.5, upperOnly.getData(), upperOnly.getRowStride(), x.getData(), 2.0, y.getData());
+        EXPECT_LT(maxDifference(y, expected), 1e-12);
+    }
+    kernels::setSimdLevel(original);
+}
+
+TEST(RealVectorTest, ParallelGemvIsIndependentOfThreadCount) {
+    const std::size_t previousThreads = RealMatrix::getThreadCount();
+    const RealMatrix a = makeMatrix(700, 900, 0.7);
+    const RealVector x = makeVector(900, 0.3);
+    const RealVector z = makeVector(700, 1.7);
+
+    RealMatrix::setThreadCount(1);
+    const RealVector serial = a * x;
+    const RealVector serialTransposed = a.transposedView() * z;
+    RealMatrix::setThreadCount(4);
+    const RealVector parallel = a * x;
+    const RealVector parallelTransposed = a.transposedView() * z;
+    RealMatrix::setThreadCount(previousThreads);
+
+    for (std::size_t i = 0; i < serial.getSize(); ++i) {
+        EXPECT_EQ(serial.getValue(i), parallel.getValue(i));
+    }
+    for (std::size_t i = 0; i < serialTransposed.getSize(); ++i) {
+        EXPECT_EQ(serialTransposed.getValue(i), parallelTransposed.getValue(i));
+    }
+}
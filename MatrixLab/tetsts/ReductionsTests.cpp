@@ -0,0 +1,197 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+#include "matrix/Matrix.h"
+#include "matrix/RealVector.h"
+#include "matrix/SimdKernels.h"
+#include "TestHelpers.h"
+
+namespace {
+
+using test_helpers::forEachSupportedLevel;
+using test_helpers::makeMatrix;
+
+// Эталон в long double по значениям values
+double referenceReduce(Reduction kind, const std::vector<double>& values) {
+    long double sum = 0.0L;
+    long double sumAbs = 0.0L;
+    long double sumSquares = 0.0L;
+    double minimum = values[0];
+    double maximum = values[0];
+    double maxAbs = 0.0;
+    for (double value : values) {
+        sum += value;
+        sumAbs += std::abs(value);
+        sumSquares += static_cast<long double>(value) * value;
+        minimum = std::min(minimum, value);
+        maximum = std::max(maximum, value);
+        maxAbs = std::max(maxAbs, std::abs(value));
+    }
+    switch (kind) {
+        case Reduction::Sum: return static_cast<double>(sum);
+        case Reduction::Mean: return static_cast<double>(sum / values.size());
+        case Reduction::SumAbs: return static_cast<double>(sumAbs);
+        case Reduction::Norm: return static_cast<double>(std::sqrt(sumSquares));
+        case Reduction::MaxAbs: return maxAbs;
+        case Reduction::Min: return minimum;
+        case Reduction::Max: return maximum;
+    }
+    return 0.0;
+}
+
+// Все виды свёрток представления против эталона: целиком, по строкам и по столбцам
+void expectMatchesReference(const ConstMatrixView& view) {
+    const Reduction kinds[] = {Reduction::Sum, Reduction::Mean, Reduction::SumAbs, Reduction::Norm,
+                               Reduction::MaxAbs, Reduction::Min, Reduction::Max};
+    for (Reduction kind : kinds) {
+        SCOPED_TRACE(testing::Message() << "kind " << static_cast<int>(kind));
+        std::vector<double> all;
+        for (std::size_t i = 0; i < view.getRows(); ++i) {
+            for (std::size_t j = 0; j < view.getCols(); ++j) all.push_back(view.getValue(i, j));
+        }
+        EXPECT_NEAR(view.reduce(kind), referenceReduce(kind, all), 1e-12);
+
+        const std::vector<double> rows = view.reduceRows(kind);
+        ASSERT_EQ(rows.size(), view.getRows());
+        for (std::size_t i = 0; i < view.getRows(); ++i) {
+            std::vector<double> row;
+            for (std::size_t j = 0; j < view.getCols(); ++j) row.push_back(view.getValue(i, j));
+            EXPECT_NEAR(rows[i], referenceReduce(kind, row), 1e-12);
+        }
+
+        const std::vector<double> cols = view.reduceColumns(kind);
+        ASSERT_EQ(cols.size(), view.getCols());
+        for (std::size_t j = 0; j < view.getCols(); ++j) {
+            std::vector<double> col;
+            for (std::size_t i = 0; i < view.getRows(); ++i) col.push_back(view.getValue(i, j));
+            EXPECT_NEAR(cols[j], referenceReduce(kind, col), 1e-12);
+        }
+    }
+}
+
+} // namespace
+
+TEST(ReductionsTest, AllKindsMatchReference) {
+    forEachSupportedLevel([] {
+        // 37 x 53: строки с выравнивающим хвостом и хвосты SIMD-ядер;
+        // 3 x 1100 - несколько блоков в строке
+        const RealMatrix padded = makeMatrix(37, 53, 0.2);
+        expectMatchesReference(padded.view());
+        expectMatchesReference(padded.transposedView());
+        expectMatchesReference(padded.view(5, 7, 20, 30));
+        expectMatchesReference(makeMatrix(3, 1100, 1.3).view());
+        expectMatchesReference(makeMatrix(64, 8, 0.7).view());
+    });
+
+    RealMatrix a(2, 3);
+    a.setValue(0, 0, 1.0);
+    a.setValue(0, 1, -7.0);
+    a.setValue(0, 2, 2.0);
+    a.setValue(1, 0, -3.0);
+    a.setValue(1, 1, 4.0);
+    a.setValue(1, 2, 0.5);
+    EXPECT_DOUBLE_EQ(a.calculateNorm1(), 11.0);
+    EXPECT_DOUBLE_EQ(a.calculateNormInf(), 10.0);
+    EXPECT_DOUBLE_EQ(a.calculateMaxNorm(), 7.0);
+    EXPECT_DOUBLE_EQ(a.transposedView().calculateNorm1(), 10.0);
+    EXPECT_DOUBLE_EQ(a.reduce(Reduction::Mean), -2.5 / 6.0);
+    EXPECT_EQ(a.reduceColumns(Reduction::Min), (std::vector<double>{-3.0, -7.0, 0.5}));
+    EXPECT_EQ(a.reduceRows(Reduction::Max), (std::vector<double>{2.0, 4.0}));
+}
+
+TEST(ReductionsTest, NormWithoutOverflowOrUnderflow) {
+    // Квадраты 1e200 переполняются, квадраты 1e-200 исчезают
+    for (double scale : {1e200, 1e-200, 1e-310}) {
+        SCOPED_TRACE(testing::Message() << "scale " << scale);
+        RealMatrix m(30, 41);
+        for (std::size_t i = 0; i < 30; ++i) {
+            for (std::size_t j = 0; j < 41; ++j) m.setValue(i, j, scale * (i == j ? 3.0 : 0.0));
+        }
+        m.setValue(0, 1, 4.0 * scale);
+        const double expected = scale * std::sqrt(9.0 * 30.0 + 16.0);
+        EXPECT_NEAR(m.calculateNorm(), expected, 1e-14 * expected);
+        EXPECT_NEAR(m.reduceRows(Reduction::Norm)[0], 5.0 * scale, 1e-14 * 5.0 * scale);
+        EXPECT_NEAR(m.reduceColumns(Reduction::Norm)[1], 5.0 * scale, 1e-14 * 5.0 * scale);
+
+        RealVector v(3);
+        v.setValue(0, 3.0 * scale);
+        v.setValue(2, -4.0 * scale);
+        EXPECT_NEAR(v.calculateNorm(), 5.0 * scale, 1e-14 * 5.0 * scale);
+    }
+
+    RealMatrix special(4, 4, 1.0);
+    special.setValue(2, 3, std::numeric_limits<double>::infinity());
+    EXPECT_EQ(special.calculateNorm(), std::numeric_limits<double>::infinity());
+    special.setValue(1, 1, std::numeric_limits<double>::quiet_NaN());
+    EXPECT_TRUE(std::isnan(special.calculateNorm()));
+    EXPECT_EQ(RealMatrix(5, 5).calculateNorm(), 0.0);
+}
+
+TEST(ReductionsTest, EmptyInputHasZeroNormsAndNoExtrema) {
+    // Суммы и нормы пустого набора равны 0, а не -inf или NaN
+    const RealVector empty;
+    EXPECT_EQ(empty.calculateNorm(), 0.0);
+    EXPECT_EQ(empty.calculateNorm1(), 0.0);
+    EXPECT_EQ(empty.calculateNormInf(), 0.0);
+
+    const RealMatrix m = makeMatrix(4, 5, 0.3);
+    const ConstMatrixView views[] = {m.view(1, 2, 0, 3), m.view(1, 2, 3, 0), m.view(1, 2, 0, 3).transposedView()};
+    for (const ConstMatrixView& view : views) {
+        SCOPED_TRACE(testing::Message() << view.getRows() << " x " << view.getCols());
+        EXPECT_EQ(view.calculateMaxNorm(), 0.0);
+        EXPECT_EQ(view.calculateNorm(), 0.0);
+        EXPECT_EQ(view.calculateNorm1(), 0.0);
+        EXPECT_EQ(view.calculateNormInf(), 0.0);
+        EXPECT_EQ(view.reduce(Reduction::Sum), 0.0);
+        EXPECT_EQ(view.reduce(Reduction::SumAbs), 0.0);
+
+        // Среднее, минимум и максимум пустого набора не определены
+        for (Reduction kind : {Reduction::Mean, Reduction::Min, Reduction::Max}) {
+            EXPECT_THROW(view.reduce(kind), std::invalid_argument);
+        }
+    }
+    EXPECT_EQ(RealMatrix().calculateMaxNorm(), 0.0);
+
+    // Пустые строки и столбцы непустого представления
+    const ConstMatrixView noColumns = m.view(0, 0, 3, 0);
+    EXPECT_EQ(noColumns.reduceRows(Reduction::MaxAbs), std::vector<double>(3, 0.0));
+    EXPECT_THROW(noColumns.reduceRows(Reduction::Min), std::invalid_argument);
+    EXPECT_THROW(noColumns.transposedView().reduceColumns(Reduction::Mean), std::invalid_argument);
+    const ConstMatrixView noRows = m.view(0, 0, 0, 3);
+    EXPECT_EQ(noRows.reduceColumns(Reduction::Norm), std::vector<double>(3, 0.0));
+    EXPECT_THROW(noRows.reduceColumns(Reduction::Max), std::invalid_argument);
+    EXPECT_TRUE(noRows.reduceRows(Reduction::Max).empty());
+}
+
+TEST(ReductionsTest, PairwiseAccuracyAndThreadIndependence) {
+    // 2^20 слагаемых 0.1: простой цикл ошибается примерно на 1e-10 относительно
+    const std::size_t rows = 1024;
+    const std::size_t cols = 1024;
+    RealMatrix tenths(rows, cols, 0.1);
+    const double exact = 0.1 * static_cast<double>(rows * cols);
+    EXPECT_NEAR(tenths.reduce(Reduction::Sum), exact, 4.0 * std::numeric_limits<double>::epsilon() * exact);
+    EXPECT_NEAR(tenths.calculateNorm(), std::sqrt(0.01 * static_cast<double>(rows * cols)), 1e-13);
+    EXPECT_NEAR(tenths.reduceColumns(Reduction::Sum)[5], 0.1 * rows, 1e-13);
+    EXPECT_NEAR(tenths.reduceRows(Reduction::Mean)[9], 0.1, 1e-16);
+
+    RealMatrix diagonal(600, 600);
+    for (std::size_t i = 0; i < 600; ++i) diagonal.setValue(i, i, 0.1);
+    EXPECT_NEAR(diagonal.calculateTrace(), 60.0, 1e-13);
+
+    const std::size_t previousThreads = RealMatrix::getThreadCount();
+    const RealMatrix m = makeMatrix(700, 900, 0.4);
+    RealMatrix::setThreadCount(1);
+    const double serialSum = m.reduce(Reduction::Sum);
+    const double serialNorm = m.calculateNorm();
+    const std::vector<double> serialRows = m.reduceRows(Reduction::SumAbs);
+    const std::vector<double> serialCols = m.reduceColumns(Reduction::Norm);
+    RealMatrix::setThreadCount(4);
+    EXPECT_EQ(m.reduce(Reduction::Sum), serialSum);
+    EXPECT_EQ(m.calculateNorm(), serialNorm);
+    EXPECT_EQ(m.reduceRows(Reduction::SumAbs), serialRows);
+    EXPECT_EQ(m.reduceColumns(Reduction::Norm), serialCols);
+    RealMatrix::setThreadCount(previousThreads);
+}
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include <cmath>
+#include "matrix/SimdKernels.h"
+#include "matrix/Gemm.h"
+#include "matrix/Matrix.h"
+#include "TestHelpers.h"
+
+namespace {
+
+using test_helpers::forEachSupportedLevel;
+
+std::vector<double> makeValues(std::size_t count, double seed) {
+    std::vector<double> values(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        values[i] = std::cos(seed + 0.91 * static_cast<double>(i));
+    }
+    return values;
+}
+
+} // namespace
+
+TEST(SimdKernelsTest, SetLevelIsClampedToSupported) {
+    const kernels::SimdLevel original = kernels::getSimdLevel();
+    kernels::setSimdLevel(kernels::SimdLevel::AVX512);
+    EXPECT_LE(static_cast<int>(kernels::getSimdLevel()), static_cast<int>(kernels::detectSimdLevel()));
+    kernels::setSimdLevel(original);
+}
+
+TEST(SimdKernelsTest, ArithmeticMatchesScalarForAllTails) {
+    forEachSupportedLevel([] {
+        for (std::size_t count = 0; count < 21; ++count) {
+            std::vector<double> a = makeValues(count, 0.5);
+            std::vector<double> b = makeValues(count, 2.5);
+            std::vector<double> out(count + 1, -7.0);
+
+            kernels::add(a.data(), b.data(), out.data(), count);
+            for (std::size_t i = 0; i < count; ++i) EXPECT_DOUBLE_EQ(out[i], a[i] + b[i]);
+
+            kernels::subtract(a.data(), b.data(), out.data(), count);
+            for (std::size_t i = 0; i < count; ++i) EXPECT_DOUBLE_EQ(out[i], a[i] - b[i]);
+
+            kernels::scale(a.data(), 3.0, out.data(), count);
+            for (std::size_t i = 0; i < count; ++i) EXPECT_DOUBLE_EQ(out[i], a[i] * 3.0);
+
+            kernels::addScalar(a.data(), -1.0, out.data(), count);
+            for (std::size_t i = 0; i < count; ++i) EXPECT_DOUBLE_EQ(out[i], a[i] - 1.0);
+
+            // Элемент за концом не трогается
+            EXPECT_DOUBLE_EQ(out[count], -7.0);
+
+            double expected = 0.0;
+            for (double value : a) expected += value * value;
+            EXPECT_NEAR(kernels::sumSquares(a.data(), count), expected, 1e-12);
+
+            double expectedDot = 0.0;
+            for (std::size_t i = 0; i < count; ++i) expectedDot += a[i] * b[i];
+            EXPECT_NEAR(kernels::dot(a.data(), b.data(), count), expectedDot, 1e-12);
+
+            std::vector<double> y = b;
+            y.push_back(-7.0);
+            kernels::axpy(2.0, a.data(), y.data(), count);
+            for (std::size_t i = 0; i < count; ++i) EXPECT_DOUBLE_EQ(y[i], b[i] + 2.0 * a[i]);
+            EXPECT_DOUBLE_EQ(y[count], -7.0);
+        }
+    });
+}
+
+TEST(SimdKernelsTest, ToleranceComparisonFindsViolationAnywhere) {
+    forEachSupportedLevel([] {
+        const std::size_t count = 19;
+        std::vector<double> small(count, 1e-13);
+        std::vector<double> shifted(count, 1e-13);
+        EXPECT_TRUE(kernels::allWithin(small.data(), 1e-12, count));
+        EXPECT_TRUE(kernels::allClose(small.data(), shifted.data(), 1e-12, count));
+
+        for (std::size_t position = 0; position < count; ++position) {
+            std::vector<double> broken = small;
+            broken[position] = -1e-10;
+            EXPECT_FALSE(kernels::allWithin(broken.data(), 1e-12, count));
+            EXPECT_FALSE(kernels::allClose(small.data(), broken.data(), 1e-12, count));
+        }
+    });
+}
+
+TEST(SimdKernelsTest, GemmAgreesAcrossLevels) {
+    const std::size_t m = 53, n = 67, k = 41;
+    std::vector<double> a = makeValues(m * k, 0.1);
+    std::vector<double> b = makeValues(k * n, 0.3);
+    std::vector<double> expected(m * n);
+    kernels::gemmNaive(m, n, k, 1.0, a.data(), k, 1, b.data(), n, 1, 0.0, expected.data(), n);
+
+    forEachSupportedLevel([&] {
+        std::vector<double> c(m * n, 1.0);
+        kernels::gemm(m, n, k, 2.0, a.data(), k, 1, b.data(), n, 1, 0.5, c.data(), n);
+        for (std::size_t i = 0; i < m * n; ++i) {
+            EXPECT_NEAR(c[i], 2.0 * expected[i] + 0.5, 1e-12);
+        }
+    });
+}
+
+TEST(SimdKernelsTest, MatrixMembersUseDispatchedKernels) {
+    forEachSupportedLevel([] {
+        RealMatrix a(5, 11, 2.0);
+        RealMatrix b(5, 11, 0.5);
+
+        EXPECT_TRUE((a + b) == RealMatrix(5, 11, 2.5));
+        EXPECT_TRUE((a - b) == RealMatrix(5, 11, 1.5));
+        EXPECT_TRUE((a / 4.0) == b);
+        EXPECT_DOUBLE_EQ(a.calculateNorm(), std::sqrt(4.0 * 55.0));
+
+        RealMatrix c = b;
+        --c;
+        ++c;
+        --c;
+        EXPECT_TRUE(c == RealMatrix(5, 11, -0.5));
+        EXPECT_TRUE((a - a * 1.0).evaluate().checkIsZero());
+    });
+}
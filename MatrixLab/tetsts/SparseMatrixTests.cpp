@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include "matrix/Matrix.h"
+#include "matrix/SparseMatrix.h"
+
+namespace {
+
+using Format = SparseMatrix::Format;
+
+// Детерминированная разреженная матрица: около density ненулевых элементов
+RealMatrix makeSparseDense(std::size_t rows, std::size_t cols, double density, double seed) {
+    RealMatrix m(rows, cols);
+    for (std::size_t i = 0; i < rows; ++i) {
+        for (std::size_t j = 0; j < cols; ++j) {
+            const double noise = std::sin(seed + 12.9898 * static_cast<double>(i) + 78.233 * static_cast<double>(j));
+            const double fraction = std::abs(noise * 43758.5453) - std::floor(std::abs(noise * 43758.5453));
+            if (fraction < density) {
+                m.setValue(i, j, noise * 4.0);
+            }
+        }
+    }
+    return m;
+}
+
+} // namespace
+
+TEST(SparseMatrixTest, BuildsFromTripletsSummingDuplicates) {
+    std::vector<SparseMatrix::Triplet> triplets = {
+            {2, 1, 4.0}, {0, 3, 1.0}, {2, 1, -1.5}, {1, 0, 2.0}, {0, 0, 5.0}, {1, 2, 3.0}, {1, 2, -3.0}
+    };
+
+    for (Format format : {Format::CSR, Format::CSC}) {
+        SparseMatrix s(3, 4, triplets, format);
+        EXPECT_EQ(s.getFormat(), format);
+        // Сокращающиеся повторы (1, 2) не хранятся
+        EXPECT_EQ(s.getNonZeroCount(), 4u);
+        EXPECT_DOUBLE_EQ(s.getValue(2, 1), 2.5);
+        EXPECT_DOUBLE_EQ(s.getValue(0, 3), 1.0);
+        EXPECT_DOUBLE_EQ(s.getValue(1, 2), 0.0);
+        EXPECT_DOUBLE_EQ(s.getValue(2, 3), 0.0);
+        EXPECT_THROW(s.getValue(3, 0), std::out_of_range);
+
+        EXPECT_TRUE(s.toDense() == RealMatrix({{5.0, 0.0, 0.0, 1.0},
+                                               {2.0, 0.0, 0.0, 0.0},
+                                               {0.0, 2.5, 0.0, 0.0}}));
+    }
+
+    EXPECT_THROW(SparseMatrix(3, 4, {{3, 0, 1.0}}), std::out_of_range);
+    EXPECT_THROW(SparseMatrix(0, 4), std::invalid_argument);
+}
+
+TEST(SparseMatrixTest, ConvertsBetweenFormatsAndDense) {
+    RealMatrix dense = makeSparseDense(17, 23, 0.2, 0.5);
+    SparseMatrix csr(dense);
+    SparseMatrix csc(dense, Format::CSC);
+
+    EXPECT_EQ(csr.getNonZeroCount(), csc.getNonZeroCount());
+    EXPECT_TRUE(csr.toDense() == dense);
+    EXPECT_TRUE(csc.toDense() == dense);
+    EXPECT_TRUE(csr.toFormat(Format::CSC) == csc);
+    EXPECT_EQ(csr.toFormat(Format::CSC).getIndices(), csc.getIndices());
+    EXPECT_EQ(csc.toFormat(Format::CSR).getOffsets(), csr.getOffsets());
+
+    SparseMatrix fromTriplets(17, 23, csr.toTriplets(), Format::CSC);
+    EXPECT_EQ(fromTriplets.getValues(), csc.getValues());
+
+    // Транспонирование меняет только формат
+    SparseMatrix transposed = csr.computeTranspose();
+    EXPECT_EQ(transposed.getRows(), 23u);
+    EXPECT_EQ(transposed.getFormat(), Format::CSC);
+    EXPECT_TRUE(transposed.toDense() == dense.computeTranspose());
+
+    EXPECT_NEAR(csr.calculateNorm(), dense.calculateNorm(), 1e-12);
+}
+
+TEST(SparseMatrixTest, ArithmeticMatchesDense) {
+    RealMatrix a = makeSparseDense(19, 14, 0.15, 1.0);
+    RealMatrix b = makeSparseDense(19, 14, 0.15, 2.0);
+    SparseMatrix sa(a);
+    SparseMatrix sb(b, Format::CSC);
+
+    EXPECT_TRUE((sa + sb).toDense() == a + b);
+    EXPECT_TRUE((sa - sb).toDense() == a - b);
+    EXPECT_EQ((sb - sb).getNonZeroCount(), 0u);
+    EXPECT_TRUE((2.5 * sa).toDense() == a * 2.5);
+    EXPECT_EQ((sa * 0.0).getNonZeroCount(), 0u);
+    EXPECT_TRUE(sa != sb);
+
+    EXPECT_THROW(sa + SparseMatrix(14, 19), std::invalid_argument);
+}
+
+TEST(SparseMatrixTest, ProductsMatchDense) {
+    RealMatrix a = makeSparseDense(31, 27, 0.1, 3.0);
+    RealMatrix b = makeSparseDense(27, 22, 0.1, 4.0);
+    RealMatrix denseRight = makeSparseDense(27, 9, 1.0, 5.0);
+    RealMatrix denseLeft = makeSparseDense(6, 31, 1.0, 6.0);
+    const RealMatrix expected = a * b;
+
+    for (Format leftFormat : {Format::CSR, Format::CSC}) {
+        for (Format rightFormat : {Format::CSR, Format::CSC}) {
+            SparseMatrix product = SparseMatrix(a, leftFormat) * SparseMatrix(b, rightFormat);
+            EXPECT_EQ(product.getFormat(), Format::CSR);
+            EXPECT_TRUE(product.toDense() == expected);
+        }
+        EXPECT_TRUE(SparseMatrix(a, leftFormat) * denseRight == a * denseRight);
+        EXPECT_TRUE(denseLeft * SparseMatrix(a, leftFormat) == denseLeft * a);
+    }
+
+    EXPECT_THROW(SparseMatrix(a) * SparseMatrix(a), std::invalid_argument);
+    EXPECT_THROW(SparseMatrix(a) * a, std::invalid_argument);
+    EXPECT_THROW(b * SparseMatrix(a), std::invalid_argument);
+}
+
+TEST(SparseMatrixTest, ParallelProductMatchesSerial) {
+    const std::size_t previousThreads = RealMatrix::getThreadCount();
+    const std::size_t previousThreshold = RealMatrix::getParallelThreshold();
+
+    RealMatrix a = makeSparseDense(120, 90, 0.05, 7.0);
+    RealMatrix b = makeSparseDense(90, 40, 1.0, 8.0);
+    RealMatrix::setThreadCount(1);
+    const RealMatrix serial = SparseMatrix(a) * b;
+    const RealMatrix serialLeft = b.computeTranspose() * SparseMatrix(a).computeTranspose();
+
+    RealMatrix::setThreadCount(4);
+    RealMatrix::setParallelThreshold(1);
+    EXPECT_TRUE(SparseMatrix(a) * b == serial);
+    EXPECT_TRUE(b.computeTranspose() * SparseMatrix(a).computeTranspose() == serialLeft);
+
+    RealMatrix::setParallelThreshold(previousThreshold);
+    RealMatrix::setThreadCount(previousThreads);
+}
+
+TEST(SparseMatrixTest, StreamOutputListsNonZeros) {
+    SparseMatrix s(2, 3, {{1, 2, 4.5}, {0, 1, -1.0}});
+    std::ostringstream os;
+    os << s;
+    EXPECT_EQ(os.str(), "2 3 2\n0 1 -1\n1 2 4.5");
+}
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include "matrix/Matrix.h"
+#include "matrix/StaticMatrix.h"
+
+namespace {
+
+// Вычисления на этапе компиляции
+constexpr Matrix3d ROTATION(0.0, -1.0, 0.0,
+                            1.0, 0.0, 0.0,
+                            0.0, 0.0, 1.0);
+static_assert(ROTATION.calculateDeterminant() == 1.0, "determinant is constexpr");
+static_assert(ROTATION * ROTATION.computeTranspose() == Matrix3d::createIdentity(), "product is constexpr");
+static_assert(ROTATION.computeInverse() == ROTATION.computeTranspose(), "inverse is constexpr");
+static_assert((StaticMatrix<int, 2, 3>(1, 2, 3, 4, 5, 6) * StaticMatrix<int, 3, 1>(1, 0, -1))(1, 0) == -2,
+              "integer matrices are supported");
+static_assert(sizeof(Matrix4d) == 16 * sizeof(double), "storage is exactly the values");
+
+template <std::size_t N>
+StaticMatrixD<N, N> makeWellConditioned(double seed) {
+    StaticMatrixD<N, N> m;
+    for (std::size_t i = 0; i < N; ++i) {
+        for (std::size_t j = 0; j < N; ++j) {
+            m(i, j) = std::sin(seed + 1.3 * static_cast<double>(i) + 0.7 * static_cast<double>(j * j));
+        }
+        m(i, i) += 3.0;
+    }
+    return m;
+}
+
+template <std::size_t N>
+void expectMatchesRealMatrix(double seed) {
+    const StaticMatrixD<N, N> a = makeWellConditioned<N>(seed);
+    const StaticMatrixD<N, N> b = makeWellConditioned<N>(seed + 1.0);
+    const RealMatrix denseA = a.toRealMatrix();
+    const RealMatrix denseB = b.toRealMatrix();
+
+    EXPECT_TRUE((a * b).toRealMatrix() == denseA * denseB);
+    EXPECT_TRUE((a + b).toRealMatrix() == denseA + denseB);
+    EXPECT_TRUE(a.computeTranspose().toRealMatrix() == denseA.computeTranspose());
+    EXPECT_NEAR(a.calculateDeterminant(), denseA.calculateDeterminant(), 1e-10);
+    EXPECT_NEAR(a.calculateNorm(), denseA.calculateNorm(), 1e-12);
+
+    const StaticMatrixD<N, N> product = a * a.computeInverse();
+    for (std::size_t i = 0; i < N; ++i) {
+        for (std::size_t j = 0; j < N; ++j) {
+            EXPECT_NEAR(product(i, j), i == j ? 1.0 : 0.0, 1e-12);
+        }
+    }
+}
+
+} // namespace
+
+TEST(StaticMatrixTest, MatchesRealMatrixForAllClosedFormSizes) {
+    expectMatchesRealMatrix<1>(0.1);
+    expectMatchesRealMatrix<2>(0.2);
+    expectMatchesRealMatrix<3>(0.3);
+    expectMatchesRealMatrix<4>(0.4);
+    // Больше 4 - исключение Гаусса-Жордана
+    expectMatchesRealMatrix<5>(0.5);
+    expectMatchesRealMatrix<7>(0.7);
+}
+
+TEST(StaticMatrixTest, RectangularProductAndTranspose) {
+    const StaticMatrixD<2, 3> a(1.0, 2.0, 3.0,
+                                4.0, 5.0, 6.0);
+    const StaticMatrixD<3, 2> t = a.computeTranspose();
+    EXPECT_DOUBLE_EQ(t(2, 1), 6.0);
+
+    const StaticMatrixD<2, 2> product = a * t;
+    EXPECT_TRUE(product == Matrix2d(14.0, 32.0, 32.0, 77.0));
+    EXPECT_TRUE((a * 2.0 - a) == a);
+    EXPECT_TRUE((2.0 * a / 2.0) == a);
+    EXPECT_DOUBLE_EQ(product.calculateTrace(), 91.0);
+}
+
+TEST(StaticMatrixTest, ErrorsAndConversions) {
+    const Matrix3d singular(1.0, 2.0, 3.0,
+                            2.0, 4.0, 6.0,
+                            0.0, 1.0, 1.0);
+    EXPECT_DOUBLE_EQ(singular.calculateDeterminant(), 0.0);
+    EXPECT_THROW(singular.computeInverse(), std::runtime_error);
+    EXPECT_THROW(Matrix4d::createFilled(1.0).computeInverse(), std::runtime_error);
+    EXPECT_THROW((StaticMatrixD<6, 6>::createFilled(2.0).computeInverse()), std::runtime_error);
+    EXPECT_THROW(singular / 0.0, std::invalid_argument);
+    // У целых epsilon = 0: деление на ноль тоже отклоняется, а не выполняется
+    const StaticMatrix<int, 2, 2> integers(4, -6, 8, 2);
+    EXPECT_THROW(integers / 0, std::invalid_argument);
+    EXPECT_TRUE((integers / 2 == StaticMatrix<int, 2, 2>(2, -3, 4, 1)));
+
+    Matrix3d m = Matrix3d::createIdentity();
+    m.setValue(0, 2, 5.0);
+    EXPECT_DOUBLE_EQ(m.getValue(0, 2), 5.0);
+    EXPECT_THROW(m.getValue(3, 0), std::out_of_range);
+    EXPECT_THROW(m.setValue(0, 3, 1.0), std::out_of_range);
+
+    RealMatrix dense = m.toRealMatrix();
+    EXPECT_EQ(dense.getRows(), 3u);
+    EXPECT_TRUE(Matrix3d(dense) == m);
+    EXPECT_THROW(Matrix4d{dense}, std::invalid_argument);
+
+    m *= Matrix3d::createFilled(1.0);
+    m += Matrix3d::createIdentity();
+    EXPECT_DOUBLE_EQ(m(0, 0), 7.0);
+
+    std::ostringstream os;
+    os << Matrix2d(1.0, 2.0, 3.0, 4.5);
+    EXPECT_EQ(os.str(), "1 2\n3 4.5");
+}
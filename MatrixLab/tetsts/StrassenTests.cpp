@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <stdexcept>
+#include "matrix/Matrix.h"
+#include "matrix/Strassen.h"
+#include "TestHelpers.h"
+
+namespace {
+
+using test_helpers::makeMatrix;
+using test_helpers::maxDifference;
+
+// Порог восстанавливается и при провале проверки
+class StrassenTest : public ::testing::Test {
+protected:
+    void SetUp() override { previousCrossover = RealMatrix::getStrassenCrossover(); }
+    void TearDown() override { RealMatrix::setStrassenCrossover(previousCrossover); }
+
+    std::size_t previousCrossover = 0;
+};
+
+} // namespace
+
+TEST_F(StrassenTest, MatchesGemmForOddAndRectangularSizes) {
+    // Маленький порог: несколько уровней рекурсии и отщепление нечётных краёв
+    RealMatrix::setStrassenCrossover(8);
+    const std::size_t sizes[][3] = {{64, 64, 64}, {67, 53, 71}, {33, 90, 17}, {128, 9, 128}, {5, 5, 5}};
+    for (const auto& size : sizes) {
+        SCOPED_TRACE(testing::Message() << size[0] << "x" << size[2] << " * " << size[2] << "x" << size[1]);
+        const RealMatrix a = makeMatrix(size[0], size[2], 0.3);
+        const RealMatrix b = makeMatrix(size[2], size[1], 1.9);
+        const RealMatrix product = RealMatrix::multiplyStrassen(a.view(), b.view());
+        EXPECT_EQ(product.getRows(), size[0]);
+        EXPECT_EQ(product.getCols(), size[1]);
+        EXPECT_LT(maxDifference(product, a * b), 1e-11);
+    }
+}
+
+TEST_F(StrassenTest, AcceptsTransposedAndSubmatrixViews) {
+    RealMatrix::setStrassenCrossover(16);
+    const RealMatrix a = makeMatrix(75, 60, 0.7);
+    const RealMatrix b = makeMatrix(75, 81, 2.2);
+
+    const RealMatrix expected = RealMatrix::multiply(a.transposedView(), b.view());
+    EXPECT_LT(maxDifference(RealMatrix::multiplyStrassen(a.transposedView(), b.view()), expected), 1e-11);
+
+    const RealMatrix block = RealMatrix::multiplyStrassen(a.view(3, 5, 50, 40), b.view(10, 2, 40, 70));
+    EXPECT_LT(maxDifference(block, RealMatrix::multiply(a.view(3, 5, 50, 40), b.view(10, 2, 40, 70))), 1e-11);
+
+    EXPECT_THROW(RealMatrix::multiplyStrassen(a.view(), b.view()), std::invalid_argument);
+}
+
+TEST_F(StrassenTest, WorkspaceIsSharedAcrossLevels) {
+    // Ниже порога рекурсии нет и память не нужна
+    EXPECT_EQ(kernels::strassenWorkspaceSize(1000, 1000, 1000, 1024), 0u);
+    // Один уровень: три блока 512 x 512
+    EXPECT_EQ(kernels::strassenWorkspaceSize(1024, 1024, 1024, 1024), 3u * 512 * 512);
+    // Уровни занимают буфер по очереди: сумма по уровням меньше 4/3 верхнего
+    const std::size_t twoLevels = kernels::strassenWorkspaceSize(2048, 2048, 2048, 1024);
+    EXPECT_EQ(twoLevels, 3u * 1024 * 1024 + 3u * 512 * 512);
+
+    RealMatrix::setStrassenCrossover(0);
+    EXPECT_EQ(RealMatrix::getStrassenCrossover(), 2u);
+}
@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+#include "matrix/Svd.h"
+#include "matrix/SymmetricEigen.h"
+#include "matrix/Factorization.h"
+#include "TestHelpers.h"
+
+namespace {
+
+using test_helpers::makeMatrix;
+using test_helpers::maxDifference;
+
+// Ортонормированные столбцы U и V, убывающие sigma и A = U S V^T
+void expectValidDecomposition(const RealMatrix& a, const SingularValueDecomposition& svd, double tolerance) {
+    const RealMatrix u = svd.getU();
+    const RealMatrix v = svd.getV();
+    const std::vector<double> sigma = svd.getSingularValues();
+    const std::size_t r = sigma.size();
+    ASSERT_EQ(u.getRows(), a.getRows());
+    ASSERT_EQ(v.getRows(), a.getCols());
+    ASSERT_EQ(u.getCols(), r);
+    ASSERT_EQ(v.getCols(), r);
+    EXPECT_LT(maxDifference(svd.reconstruct(), a), tolerance);
+    EXPECT_LT(maxDifference(u.computeTranspose() * u, RealMatrix::createIdentity(r)), tolerance);
+    EXPECT_LT(maxDifference(v.computeTranspose() * v, RealMatrix::createIdentity(r)), tolerance);
+    for (std::size_t i = 1; i < r; ++i) {
+        EXPECT_GE(sigma[i - 1], sigma[i]);
+    }
+    EXPECT_GE(sigma.back(), 0.0);
+}
+
+} // namespace
+
+TEST(SvdTest, SquareTallAndWideMatrices) {
+    RealMatrix a(2, 2);
+    a.setValue(0, 0, 3.0);
+    a.setValue(1, 0, 4.0);
+    a.setValue(1, 1, 5.0);
+    const SingularValueDecomposition small(a);
+    EXPECT_NEAR(small.getSingularValues()[0], 3.0 * std::sqrt(5.0), 1e-14);
+    EXPECT_NEAR(small.getSingularValues()[1], std::sqrt(5.0), 1e-14);
+    expectValidDecomposition(a, small, 1e-14);
+
+    // sigma^2 - собственные значения A^T A
+    for (auto shape : {std::make_pair(70u, 70u), std::make_pair(90u, 35u), std::make_pair(20u, 55u)}) {
+        SCOPED_TRACE(testing::Message() << shape.first << " x " << shape.second);
+        const RealMatrix m = makeMatrix(shape.first, shape.second, 0.3);
+        const SingularValueDecomposition svd(m);
+        expectValidDecomposition(m, svd, 1e-11);
+
+        const RealMatrix gram = shape.first >= shape.second ? m.computeTranspose() * m : m * m.computeTranspose();
+        std::vector<double> expected = SymmetricEigenDecomposition(gram, false).getEigenvalues();
+        std::reverse(expected.begin(), expected.end());
+        const std::vector<double> sigma = svd.getSingularValues();
+        for (std::size_t i = 0; i < sigma.size(); ++i) {
+            EXPECT_NEAR(sigma[i] * sigma[i], expected[i], 1e-10 * expected[0]);
+        }
+    }
+}
+
+TEST(SvdTest, RankDeficientMatrix) {
+    // Ранг 3: шумовые строки обнуляются, нулевым sigma соответствуют
+    // дополненные столбцы V
+    const RealMatrix left = makeMatrix(40, 3, 1.1);
+    const RealMatrix right = makeMatrix(3, 30, 2.7);
+    const RealMatrix a = left * right;
+    const SingularValueDecomposition svd(a);
+    expectValidDecomposition(a, svd, 1e-12);
+    const std::vector<double> sigma = svd.getSingularValues();
+    EXPECT_GT(sigma[2], 1e-3);
+    for (std::size_t i = 3; i < sigma.size(); ++i) {
+        EXPECT_LT(sigma[i], 1e-12);
+    }
+
+    const RealMatrix zero(6, 4);
+    const SingularValueDecomposition zeroSvd(zero);
+    expectValidDecomposition(zero, zeroSvd, 1e-15);
+    for (double value : zeroSvd.getSingularValues()) EXPECT_EQ(value, 0.0);
+}
+
+TEST(SvdTest, RandomizedTopSingularTriplets) {
+    // A = Q1 diag(2^-i) Q2^T с быстро убывающим спектром
+    const std::size_t m = 600;
+    const std::size_t n = 80;
+    const RealMatrix q1 = QRDecomposition(makeMatrix(m, n, 0.9)).getQ();
+    const RealMatrix q2 = QRDecomposition(makeMatrix(n, n, 1.7)).getQ();
+    RealMatrix scaled(q1);
+    for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            scaled.setValue(i, j, q1.getValue(i, j) * std::pow(0.5, static_cast<double>(j)));
+        }
+    }
+    const RealMatrix a = scaled * q2.computeTranspose();
+
+    const std::size_t rank = 8;
+    const SingularValueDecomposition topK = SingularValueDecomposition::computeRandomized(a, rank, 10, 2, 42);
+    const std::vector<double> sigma = topK.getSingularValues();
+    ASSERT_EQ(sigma.size(), rank);
+    for (std::size_t i = 0; i < rank; ++i) {
+        EXPECT_NEAR(sigma[i], std::pow(0.5, static_cast<double>(i)), 1e-12);
+    }
+    const RealMatrix u = topK.getU();
+    const RealMatrix v = topK.getV();
+    EXPECT_LT(maxDifference(u.computeTranspose() * u, RealMatrix::createIdentity(rank)), 1e-12);
+    EXPECT_LT(maxDifference(v.computeTranspose() * v, RealMatrix::createIdentity(rank)), 1e-12);
+    // Оптимум по Фробениусу: sqrt(sum_{i >= k} sigma_i^2) = 2^-k sqrt(4/3)
+    EXPECT_LT(RealMatrix(a - topK.reconstruct()).calculateNorm(), 1.01 * std::sqrt(4.0 / 3.0) * std::pow(0.5, static_cast<double>(rank)));
+
+    // Тот же seed - тот же результат; для широкой матрицы - A^T
+    const SingularValueDecomposition again = SingularValueDecomposition::computeRandomized(a, rank, 10, 2, 42);
+    EXPECT_EQ(maxDifference(again.getU(), u), 0.0);
+    const SingularValueDecomposition wide = SingularValueDecomposition::computeRandomized(a.computeTranspose(), rank);
+    for (std::size_t i = 0; i < rank; ++i) {
+        EXPECT_NEAR(wide.getSingularValues()[i], sigma[i], 1e-12);
+    }
+
+    EXPECT_THROW(SingularValueDecomposition::computeRandomized(a, 0), std::invalid_argument);
+    EXPECT_THROW(SingularValueDecomposition::computeRandomized(a, n + 1), std::invalid_argument);
+}
@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+#include "matrix/SymmetricEigen.h"
+#include "matrix/Factorization.h"
+#include "TestHelpers.h"
+
+namespace {
+
+using test_helpers::maxDifference;
+
+RealMatrix makeSymmetricMatrix(std::size_t n, double seed) {
+    RealMatrix m(n, n);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j <= i; ++j) {
+            const double value = std::sin(seed + 0.61 * static_cast<double>(i * j) + 1.37 * static_cast<double>(i + j));
+            m.setValue(i, j, value);
+            m.setValue(j, i, value);
+        }
+    }
+    return m;
+}
+
+// Q diag(values) Q^T со случайной ортогональной Q
+RealMatrix makeMatrixWithSpectrum(const std::vector<double>& values) {
+    const std::size_t n = values.size();
+    const RealMatrix q = QRDecomposition(makeSymmetricMatrix(n, 2.5)).getQ();
+    RealMatrix scaled(q);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            scaled.setValue(i, j, q.getValue(i, j) * values[j]);
+        }
+    }
+    RealMatrix result = scaled * q.computeTranspose();
+    // Симметрия без погрешности округления
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < i; ++j) {
+            result.setValue(j, i, result.getValue(i, j));
+        }
+    }
+    return result;
+}
+
+// max |A V - V diag(lambda)| и max |V^T V - I|
+void expectValidDecomposition(const RealMatrix& a, const SymmetricEigenDecomposition& eigen, double tolerance) {
+    const std::size_t n = a.getRows();
+    const std::vector<double> values = eigen.getEigenvalues();
+    const RealMatrix v = eigen.getEigenvectors();
+    RealMatrix scaled(v);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            scaled.setValue(i, j, v.getValue(i, j) * values[j]);
+        }
+    }
+    EXPECT_LT(maxDifference(a * v, scaled), tolerance);
+    EXPECT_LT(maxDifference(v.computeTranspose() * v, RealMatrix::createIdentity(n)), tolerance);
+    for (std::size_t i = 1; i < n; ++i) {
+        EXPECT_LE(values[i - 1], values[i]);
+    }
+}
+
+} // namespace
+
+TEST(SymmetricEigenTest, SmallMatricesAndErrors) {
+    RealMatrix a(2, 2);
+    a.setValue(0, 0, 2.0);
+    a.setValue(0, 1, 1.0);
+    a.setValue(1, 0, 1.0);
+    a.setValue(1, 1, 2.0);
+    const SymmetricEigenDecomposition eigen(a);
+    EXPECT_NEAR(eigen.getEigenvalues()[0], 1.0, 1e-14);
+    EXPECT_NEAR(eigen.getEigenvalues()[1], 3.0, 1e-14);
+    expectValidDecomposition(a, eigen, 1e-14);
+
+    // Уже диагональная матрица: внедиагональные элементы T нулевые
+    RealMatrix diagonal(5, 5);
+    const double entries[] = {4.0, -1.0, 7.0, 0.5, -3.0};
+    for (std::size_t i = 0; i < 5; ++i) diagonal.setValue(i, i, entries[i]);
+    const SymmetricEigenDecomposition diagonalEigen(diagonal);
+    EXPECT_EQ(diagonalEigen.getEigenvalues(), (std::vector<double>{-3.0, -1.0, 0.5, 4.0, 7.0}));
+    expectValidDecomposition(diagonal, diagonalEigen, 1e-15);
+
+    RealMatrix nonSymmetric(3, 3, 1.0);
+    nonSymmetric.setValue(0, 2, 2.0);
+    EXPECT_THROW(SymmetricEigenDecomposition{nonSymmetric}, std::invalid_argument);
+    EXPECT_THROW(SymmetricEigenDecomposition{RealMatrix(2, 3)}, std::invalid_argument);
+
+    const SymmetricEigenDecomposition valuesOnly(a, false);
+    EXPECT_FALSE(valuesOnly.hasEigenvectors());
+    EXPECT_THROW(valuesOnly.getEigenvectors(), std::runtime_error);
+}
+
+TEST(SymmetricEigenTest, GeneralMatrixAcrossBlocksAndMerges) {
+    // 150 > FACTORIZATION_BLOCK и несколько уровней слияния
+    for (std::size_t n : {33u, 150u}) {
+        SCOPED_TRACE(testing::Message() << "n = " << n);
+        const RealMatrix a = makeSymmetricMatrix(n, 0.4);
+        const SymmetricEigenDecomposition eigen(a);
+        expectValidDecomposition(a, eigen, 1e-11);
+
+        double trace = 0.0;
+        for (double value : eigen.getEigenvalues()) trace += value;
+        EXPECT_NEAR(trace, a.calculateTrace(), 1e-10);
+
+        const std::vector<double> withVectors = eigen.getEigenvalues();
+        const std::vector<double> valuesOnly = SymmetricEigenDecomposition(a, false).getEigenvalues();
+        for (std::size_t i = 0; i < n; ++i) {
+            EXPECT_NEAR(valuesOnly[i], withVectors[i], 1e-11);
+        }
+    }
+}
+
+TEST(SymmetricEigenTest, ClusteredAndRepeatedEigenvalues) {
+    // Кратные значения и кластеры проверяют отделение при слиянии
+    std::vector<double> spectrum;
+    for (std::size_t i = 0; i < 120; ++i) {
+        if (i % 3 == 0) {
+            spectrum.push_back(1.0);
+        } else if (i % 3 == 1) {
+            spectrum.push_back(2.0 + 1e-12 * static_cast<double>(i));
+        } else {
+            spectrum.push_back(-5.0 + 0.1 * static_cast<double>(i));
+        }
+    }
+    const RealMatrix a = makeMatrixWithSpectrum(spectrum);
+    const SymmetricEigenDecomposition eigen(a);
+    expectValidDecomposition(a, eigen, 1e-11);
+
+    std::vector<double> expected = spectrum;
+    std::sort(expected.begin(), expected.end());
+    const std::vector<double> values = eigen.getEigenvalues();
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_NEAR(values[i], expected[i], 1e-11);
+    }
+
+    // Ранг 4: почти все значения - шум округления, QL должен сойтись
+    const std::size_t n = 100;
+    RealMatrix lowRank(n, n);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            lowRank.setValue(i, j, std::sin(1.5 + 0.37 * static_cast<double>(i) + 1.11 * static_cast<double>(j)));
+        }
+    }
+    lowRank = lowRank + lowRank.computeTranspose();
+    const SymmetricEigenDecomposition lowRankEigen(lowRank);
+    expectValidDecomposition(lowRank, lowRankEigen, 1e-10);
+    std::size_t nonZero = 0;
+    for (double value : SymmetricEigenDecomposition(lowRank, false).getEigenvalues()) {
+        if (std::abs(value) > 1e-10) ++nonZero;
+    }
+    EXPECT_EQ(nonZero, 4u);
+
+    const SymmetricEigenDecomposition identity(RealMatrix::createIdentity(n));
+    for (double value : identity.getEigenvalues()) EXPECT_DOUBLE_EQ(value, 1.0);
+    expectValidDecomposition(RealMatrix::createIdentity(n), identity, 1e-15);
+}
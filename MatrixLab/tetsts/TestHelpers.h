@@ -0,0 +1,76 @@
+/**
+ * @file TestHelpers.h
+ * @brief Shared test data generators and comparison helpers
+ * @author Shchurko
+ * @date 2025
+ */
+
+#ifndef MATRIXLAB_TESTHELPERS_H
+#define MATRIXLAB_TESTHELPERS_H
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include "matrix/Matrix.h"
+#include "matrix/RealVector.h"
+#include "matrix/SimdKernels.h"
+
+namespace test_helpers {
+
+// Прогоняет проверку на каждом уровне SIMD, который есть у процессора;
+// исходный уровень восстанавливается
+template <typename Check>
+void forEachSupportedLevel(Check check) {
+    const kernels::SimdLevel original = kernels::getSimdLevel();
+    const kernels::SimdLevel levels[] = {
+            kernels::SimdLevel::Scalar, kernels::SimdLevel::SSE2,
+            kernels::SimdLevel::AVX2, kernels::SimdLevel::AVX512
+    };
+    for (kernels::SimdLevel level : levels) {
+        if (static_cast<int>(level) > static_cast<int>(kernels::detectSimdLevel())) break;
+        kernels::setSimdLevel(level);
+        SCOPED_TRACE(kernels::simdLevelName(level));
+        check();
+    }
+    kernels::setSimdLevel(original);
+}
+
+// Значения sin(seed + 0.73 i j + 1.29 (i + 2 j)) из [-1, 1]. Слагаемое
+// i j делает матрицу полного ранга: без него sin(a i + b j) даёт ранг 2,
+// и проверки разложений и решения систем на таких данных вырождены
+inline RealMatrix makeMatrix(std::size_t rows, std::size_t cols, double seed) {
+    RealMatrix m(rows, cols);
+    for (std::size_t i = 0; i < rows; ++i) {
+        for (std::size_t j = 0; j < cols; ++j) {
+            m.setValue(i, j, std::sin(seed + 0.73 * static_cast<double>(i * j) + 1.29 * static_cast<double>(i + 2 * j)));
+        }
+    }
+    return m;
+}
+
+// Максимальное отклонение от эталона в double; actual - матрица любой
+// точности или представление
+template <typename Actual>
+double maxDifference(const Actual& actual, const RealMatrix& expected) {
+    double difference = 0.0;
+    for (std::size_t i = 0; i < expected.getRows(); ++i) {
+        for (std::size_t j = 0; j < expected.getCols(); ++j) {
+            difference = std::max(difference, std::abs(static_cast<double>(actual.getValue(i, j)) -
+                                                       expected.getValue(i, j)));
+        }
+    }
+    return difference;
+}
+
+inline double maxDifference(const RealVector& actual, const RealVector& expected) {
+    double difference = 0.0;
+    for (std::size_t i = 0; i < expected.getSize(); ++i) {
+        difference = std::max(difference, std::abs(actual.getValue(i) - expected.getValue(i)));
+    }
+    return difference;
+}
+
+} // namespace test_helpers
+
+#endif // MATRIXLAB_TESTHELPERS_H
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include "matrix/Matrix.h"
+#include "matrix/TextFormat.h"
+
+namespace {
+
+RealMatrix makeValues(std::size_t rows, std::size_t cols) {
+    RealMatrix m(rows, cols);
+    for (std::size_t i = 0; i < rows; ++i) {
+        for (std::size_t j = 0; j < cols; ++j) {
+            m.setValue(i, j, std::sin(0.37 * static_cast<double>(i * cols + j)) * 1e3);
+        }
+    }
+    return m;
+}
+
+void writeText(const char* filename, const std::string& text) {
+    std::ofstream file(filename, std::ios::binary);
+    file << text;
+}
+
+} // namespace
+
+TEST(TextFormatTest, RoundTripIsExact) {
+    RealMatrix original = makeValues(6, 9);
+    original.setValue(0, 0, 1.0 / 3.0);
+    original.setValue(5, 8, -2.2250738585072014e-308);
+    ASSERT_TRUE(original.writeToFile("text_matrix.txt"));
+
+    RealMatrix loaded;
+    ASSERT_TRUE(loaded.readFromFile("text_matrix.txt"));
+    for (std::size_t i = 0; i < 6; ++i) {
+        for (std::size_t j = 0; j < 9; ++j) {
+            EXPECT_EQ(loaded.getValue(i, j), original.getValue(i, j));
+        }
+    }
+
+    std::remove("text_matrix.txt");
+}
+
+TEST(TextFormatTest, AcceptsSeparatorsSignsAndBlankLines) {
+    writeText("text_matrix.txt", "\n  +1.5\t-2e1 3\r\n \t\n4 .5   6e-1\r\n\n");
+
+    RealMatrix loaded;
+    ASSERT_TRUE(loaded.readFromFile("text_matrix.txt"));
+    EXPECT_TRUE(loaded == RealMatrix({{1.5, -20.0, 3.0}, {4.0, 0.5, 0.6}}));
+
+    std::remove("text_matrix.txt");
+}
+
+TEST(TextFormatTest, RejectsMalformedValues) {
+    const char* malformed[] = {"1 2\n3 4x\n", "1 2\n3 abc\n", "1 +-2\n", "1 2 3\n4 5\n", "1\n2 3\n", "1e999 2\n"};
+    for (const char* text : malformed) {
+        SCOPED_TRACE(text);
+        writeText("text_matrix.txt", text);
+        RealMatrix m(1, 1, 7.0);
+        EXPECT_FALSE(m.readFromFile("text_matrix.txt"));
+        EXPECT_DOUBLE_EQ(m.getValue(0, 0), 7.0);
+    }
+
+    writeText("text_matrix.txt", " \n\t\n");
+    RealMatrix m;
+    EXPECT_FALSE(m.readFromFile("text_matrix.txt"));
+
+    std::remove("text_matrix.txt");
+}
+
+TEST(TextFormatTest, ParsesLargeFilesInParallelChunks) {
+    const std::size_t originalThreads = RealMatrix::getThreadCount();
+    RealMatrix::setThreadCount(4);
+
+    // Около 6 МБ текста: несколько кусков по границам строк
+    RealMatrix original = makeValues(400, 700);
+    ASSERT_TRUE(original.writeToFile("large_text_matrix.txt"));
+
+    std::ifstream file("large_text_matrix.txt", std::ios::binary);
+    const std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    file.close();
+
+    text_format::Layout layout;
+    ASSERT_TRUE(text_format::scan(text.data(), text.size(), layout));
+    EXPECT_GT(layout.chunkFirstRow.size(), 1u);
+    EXPECT_EQ(layout.rows, 400u);
+    EXPECT_EQ(layout.cols, 700u);
+
+    RealMatrix loaded;
+    ASSERT_TRUE(loaded.readFromFile("large_text_matrix.txt"));
+    EXPECT_TRUE((loaded - original).evaluate().checkIsZero());
+
+    // Строка с лишним значением в последнем куске обнаруживается
+    writeText("large_text_matrix.txt", text + "\n" + text.substr(0, text.find('\n')) + " 1");
+    EXPECT_FALSE(loaded.readFromFile("large_text_matrix.txt"));
+
+    RealMatrix::setThreadCount(originalThreads);
+    std::remove("large_text_matrix.txt");
+}
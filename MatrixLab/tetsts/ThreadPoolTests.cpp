@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "matrix/ThreadPool.h"
+#include "matrix/Matrix.h"
+
+TEST(ThreadPoolTest, RunsEveryTaskExactlyOnce) {
+    ThreadPool pool(4);
+    EXPECT_EQ(pool.getThreadCount(), 4u);
+
+    std::vector<std::atomic<int>> hits(1000);
+    for (int round = 0; round < 3; ++round) {
+        pool.parallelFor(hits.size(), [&](std::size_t i) { ++hits[i]; });
+    }
+    for (const auto& count : hits) {
+        EXPECT_EQ(count.load(), 3);
+    }
+}
+
+TEST(ThreadPoolTest, NestedCallsRunInline) {
+    ThreadPool pool(3);
+    std::atomic<int> total{0};
+    pool.parallelFor(6, [&](std::size_t) {
+        pool.parallelFor(5, [&](std::size_t) { ++total; });
+    });
+    EXPECT_EQ(total.load(), 30);
+}
+
+TEST(ThreadPoolTest, PropagatesTaskException) {
+    ThreadPool pool(2);
+    EXPECT_THROW(pool.parallelFor(10, [](std::size_t i) {
+        if (i == 7) throw std::runtime_error("task failed");
+    }), std::runtime_error);
+
+    // Пул остаётся рабочим после исключения
+    std::atomic<int> total{0};
+    pool.parallelFor(10, [&](std::size_t) { ++total; });
+    EXPECT_EQ(total.load(), 10);
+}
+
+TEST(ThreadPoolTest, ZeroThreadsRejected) {
+    EXPECT_THROW(ThreadPool(0), std::invalid_argument);
+}
+
+TEST(ThreadPoolTest, ParallelProductIsBitwiseDeterministic) {
+    const std::size_t previousThreads = RealMatrix::getThreadCount();
+    const std::size_t previousThreshold = RealMatrix::getParallelThreshold();
+    RealMatrix::setParallelThreshold(0);
+
+    RealMatrix left(150, 300);
+    RealMatrix right(300, 170);
+    for (std::size_t i = 0; i < 150; ++i) {
+        for (std::size_t j = 0; j < 300; ++j) {
+            left.setValue(i, j, std::sin(0.013 * static_cast<double>(i * 300 + j)));
+        }
+    }
+    for (std::size_t i = 0; i < 300; ++i) {
+        for (std::size_t j = 0; j < 170; ++j) {
+            right.setValue(i, j, std::cos(0.007 * static_cast<double>(i * 170 + j)));
+        }
+    }
+
+    RealMatrix::setThreadCount(1);
+    RealMatrix serial = left * right;
+
+    for (std::size_t threads : {2u, 3u, 5u}) {
+        RealMatrix::setThreadCount(threads);
+        EXPECT_EQ(RealMatrix::getThreadCount(), threads);
+        RealMatrix parallel = left * right;
+        for (std::size_t i = 0; i < serial.getRows(); ++i) {
+            EXPECT_EQ(std::memcmp(serial.getData() + i * serial.getRowStride(),
+                                  parallel.getData() + i * parallel.getRowStride(),
+                                  serial.getCols() * sizeof(double)), 0);
+        }
+    }
+
+    RealMatrix::setThreadCount(previousThreads);
+    RealMatrix::setParallelThreshold(previousThreshold);
+}
+
+TEST(ThreadPoolTest, GlobalPoolCanBeResizedWhileInUse) {
+    const std::size_t previousThreads = RealMatrix::getThreadCount();
+    RealMatrix::setThreadCount(4);
+
+    // Пул, полученный до смены размера, остаётся рабочим
+    std::shared_ptr<ThreadPool> held = ThreadPool::global();
+    RealMatrix::setThreadCount(3);
+    EXPECT_EQ(held->getThreadCount(), 4u);
+    EXPECT_EQ(ThreadPool::getGlobalThreadCount(), 3u);
+    std::atomic<std::size_t> done{0};
+    held->parallelFor(16, [&](std::size_t) { ++done; });
+    EXPECT_EQ(done.load(), 16u);
+    held.reset();
+
+    // Смена размера изнутри задачи не разрушает пул, который её выполняет
+    done = 0;
+    ThreadPool::global()->parallelFor(8, [&](std::size_t i) {
+        RealMatrix::setThreadCount(2 + i % 3);
+        ++done;
+    });
+    EXPECT_EQ(done.load(), 8u);
+
+    // Свёртки в одних потоках и смена размера в другом
+    const RealMatrix m(600, 600, 0.5);
+    std::atomic<bool> stop{false};
+    std::thread resizer([&] {
+        for (std::size_t round = 0; !stop.load(); ++round) {
+            RealMatrix::setThreadCount(1 + round % 4);
+        }
+    });
+    std::vector<std::thread> readers;
+    std::atomic<int> mismatches{0};
+    for (int t = 0; t < 3; ++t) {
+        readers.emplace_back([&] {
+            for (int round = 0; round < 50; ++round) {
+                if (m.reduce(Reduction::Sum) != 0.5 * 600.0 * 600.0) ++mismatches;
+            }
+        });
+    }
+    for (std::thread& reader : readers) reader.join();
+    stop = true;
+    resizer.join();
+    EXPECT_EQ(mismatches.load(), 0);
+
+    RealMatrix::setThreadCount(previousThreads);
+}
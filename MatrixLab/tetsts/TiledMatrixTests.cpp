@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include "matrix/TiledMatrix.h"
+#include "TestHelpers.h"
+
+namespace {
+
+using test_helpers::makeMatrix;
+using test_helpers::maxDifference;
+
+constexpr std::size_t TILE_BYTES = 16 * 16 * sizeof(double);
+
+} // namespace
+
+TEST(TiledMatrixTest, RoundTripWithPartialEdgeTiles) {
+    const RealMatrix dense = makeMatrix(37, 50, 0.4);
+    {
+        TiledMatrix tiled = TiledMatrix::fromMatrix(dense, "tiled_roundtrip.tiles", 16);
+        EXPECT_EQ(tiled.getTileRows(), 3u);
+        EXPECT_EQ(tiled.getTileCols(), 4u);
+        EXPECT_EQ(tiled.getTileHeight(2), 5u);
+        EXPECT_EQ(tiled.getTileWidth(3), 2u);
+    }
+
+    const TiledMatrix reopened("tiled_roundtrip.tiles");
+    EXPECT_EQ(reopened.getRows(), 37u);
+    EXPECT_EQ(reopened.getCols(), 50u);
+    EXPECT_EQ(reopened.toMatrix(), dense);
+    EXPECT_EQ(reopened.loadTile(2, 3), RealMatrix(dense.extractSubmatrix(32, 48, 5, 2)));
+
+    // Дополнение крайней плитки хранится нулями
+    std::vector<double> buffer(16 * 16, -1.0);
+    reopened.readTile(2, 3, buffer.data());
+    EXPECT_DOUBLE_EQ(buffer[0], dense.getValue(32, 48));
+    EXPECT_DOUBLE_EQ(buffer[2], 0.0);
+    EXPECT_DOUBLE_EQ(buffer[5 * 16], 0.0);
+
+    EXPECT_THROW(reopened.readTile(3, 0, buffer.data()), std::out_of_range);
+    TiledMatrix readOnly("tiled_roundtrip.tiles");
+    EXPECT_THROW(readOnly.writeTile(0, 0, buffer.data()), std::runtime_error);
+    std::remove("tiled_roundtrip.tiles");
+}
+
+TEST(TiledMatrixTest, MultiplyMatchesInMemoryProduct) {
+    const RealMatrix a = makeMatrix(70, 45, 0.3);
+    const RealMatrix b = makeMatrix(45, 83, 1.9);
+    const RealMatrix expected = a * b;
+    const TiledMatrix left = TiledMatrix::fromMatrix(a, "tiled_left.tiles", 16);
+    const TiledMatrix right = TiledMatrix::fromMatrix(b, "tiled_right.tiles", 16);
+
+    // Минимальный бюджет (панели по одной плитке), средний и с запасом
+    for (std::size_t budgetTiles : {5u, 12u, 200u}) {
+        SCOPED_TRACE(testing::Message() << budgetTiles << " tiles");
+        const TiledMatrix product = TiledMatrix::multiply(left, right, "tiled_product.tiles",
+                                                          budgetTiles * TILE_BYTES);
+        EXPECT_LT(maxDifference(product.toMatrix(), expected), 1e-12);
+
+        std::vector<double> edge(16 * 16);
+        product.readTile(4, 5, edge.data());
+        EXPECT_DOUBLE_EQ(edge[15], 0.0);
+        EXPECT_DOUBLE_EQ(edge[6 * 16], 0.0);
+    }
+
+    EXPECT_EQ(TiledMatrix::panelTiles(16, 5 * TILE_BYTES), 1u);
+    EXPECT_EQ(TiledMatrix::panelTiles(16, 12 * TILE_BYTES), 2u);
+    EXPECT_THROW(TiledMatrix::multiply(left, right, "tiled_product.tiles", 4 * TILE_BYTES),
+                 std::invalid_argument);
+    EXPECT_THROW(TiledMatrix::multiply(right, left, "tiled_product.tiles", 100 * TILE_BYTES),
+                 std::invalid_argument);
+
+    std::remove("tiled_left.tiles");
+    std::remove("tiled_right.tiles");
+    std::remove("tiled_product.tiles");
+}
+
+TEST(TiledMatrixTest, RejectsInvalidFiles) {
+    EXPECT_THROW(TiledMatrix("missing_matrix.tiles"), std::runtime_error);
+
+    {
+        std::ofstream file("not_tiled.tiles", std::ios::binary);
+        file << "definitely not a tiled matrix";
+    }
+    EXPECT_THROW(TiledMatrix("not_tiled.tiles"), std::runtime_error);
+    std::remove("not_tiled.tiles");
+
+    // Обрезанный файл: заголовок цел, плиток не хватает
+    {
+        TiledMatrix::create("truncated.tiles", 64, 64, 16);
+    }
+    {
+        std::ifstream source("truncated.tiles", std::ios::binary);
+        std::vector<char> bytes(TILED_HEADER_SIZE + 100);
+        source.read(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        source.close();
+        std::ofstream target("truncated.tiles", std::ios::binary | std::ios::trunc);
+        target.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+    EXPECT_THROW(TiledMatrix("truncated.tiles"), std::runtime_error);
+    std::remove("truncated.tiles");
+}
+
+TEST(TiledMatrixTest, RejectsOverflowingHeaderDimensions) {
+    {
+        TiledMatrix::create("forged.tiles", 32, 32, 16);
+    }
+    std::vector<char> bytes;
+    {
+        std::ifstream source("forged.tiles", std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(source), std::istreambuf_iterator<char>());
+    }
+    ASSERT_GT(bytes.size(), TILED_HEADER_SIZE);
+
+    // rows, cols и tileSize по смещениям 24, 32 и 40: число плиток, их
+    // площадь или округление размера вверх переполняют 64 бита
+    const std::uint64_t forgeries[][3] = {
+            {32, 32, std::uint64_t(1) << 32},
+            {std::uint64_t(1) << 40, std::uint64_t(1) << 40, 1},
+            {UINT64_MAX, 32, 16},
+            {32, UINT64_MAX - 7, 8}
+    };
+    for (const auto& fields : forgeries) {
+        SCOPED_TRACE(testing::Message() << fields[0] << " x " << fields[1] << " / " << fields[2]);
+        std::vector<char> forged = bytes;
+        std::memcpy(forged.data() + 24, fields, sizeof(fields));
+        {
+            std::ofstream target("forged.tiles", std::ios::binary | std::ios::trunc);
+            target.write(forged.data(), static_cast<std::streamsize>(forged.size()));
+        }
+        EXPECT_THROW(TiledMatrix("forged.tiles"), std::runtime_error);
+    }
+    std::remove("forged.tiles");
+
+    EXPECT_THROW(TiledMatrix::create("forged.tiles", std::size_t(1) << 40, std::size_t(1) << 40, 1),
+                 std::invalid_argument);
+    EXPECT_FALSE(std::ifstream("forged.tiles").good());
+}
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include "matrix/Transpose.h"
+#include "matrix/SimdKernels.h"
+#include "matrix/Matrix.h"
+#include "TestHelpers.h"
+
+namespace {
+
+using test_helpers::forEachSupportedLevel;
+
+// Уникальное значение каждой позиции, чтобы ловить перестановки
+double valueAt(std::size_t i, std::size_t j) {
+    return static_cast<double>(i) * 1000.0 + static_cast<double>(j);
+}
+
+} // namespace
+
+TEST(TransposeTest, OutOfPlaceMatchesDefinition) {
+    const std::size_t shapes[][2] = {{1, 1}, {3, 17}, {8, 8}, {33, 65}, {130, 7}, {257, 300}};
+    forEachSupportedLevel([&] {
+        for (const auto& shape : shapes) {
+            const std::size_t rows = shape[0];
+            const std::size_t cols = shape[1];
+            const std::size_t sourceStride = cols + 3;
+            const std::size_t destinationStride = rows + 5;
+            std::vector<double> source(rows * sourceStride, -1.0);
+            std::vector<double> destination(cols * destinationStride, -7.0);
+            for (std::size_t i = 0; i < rows; ++i) {
+                for (std::size_t j = 0; j < cols; ++j) {
+                    source[i * sourceStride + j] = valueAt(i, j);
+                }
+            }
+
+            kernels::transpose(rows, cols, source.data(), sourceStride,
+                               destination.data(), destinationStride);
+
+            for (std::size_t j = 0; j < cols; ++j) {
+                for (std::size_t i = 0; i < rows; ++i) {
+                    ASSERT_EQ(destination[j * destinationStride + i], valueAt(i, j));
+                }
+                // Промежутки между строками приёмника не трогаются
+                for (std::size_t i = rows; i < destinationStride; ++i) {
+                    ASSERT_EQ(destination[j * destinationStride + i], -7.0);
+                }
+            }
+        }
+    });
+}
+
+TEST(TransposeTest, InPlaceSquareMatchesDefinition) {
+    const std::size_t sizes[] = {1, 2, 5, 8, 31, 33, 64, 100, 129};
+    forEachSupportedLevel([&] {
+        for (std::size_t n : sizes) {
+            const std::size_t stride = n + 2;
+            std::vector<double> data(n * stride, -1.0);
+            for (std::size_t i = 0; i < n; ++i) {
+                for (std::size_t j = 0; j < n; ++j) {
+                    data[i * stride + j] = valueAt(i, j);
+                }
+            }
+
+            kernels::transposeInPlace(n, data.data(), stride);
+
+            for (std::size_t i = 0; i < n; ++i) {
+                for (std::size_t j = 0; j < n; ++j) {
+                    ASSERT_EQ(data[i * stride + j], valueAt(j, i)) << "n=" << n;
+                }
+                for (std::size_t j = n; j < stride; ++j) {
+                    ASSERT_EQ(data[i * stride + j], -1.0);
+                }
+            }
+        }
+    });
+}
+
+TEST(TransposeTest, MatrixTransposeInPlace) {
+    RealMatrix square(45, 45);
+    RealMatrix rectangle(13, 70);
+    for (std::size_t i = 0; i < 45; ++i) {
+        for (std::size_t j = 0; j < 45; ++j) {
+            square.setValue(i, j, valueAt(i, j));
+        }
+    }
+    for (std::size_t i = 0; i < 13; ++i) {
+        for (std::size_t j = 0; j < 70; ++j) {
+            rectangle.setValue(i, j, valueAt(i, j));
+        }
+    }
+
+    RealMatrix expectedSquare = square.computeTranspose();
+    const double* buffer = square.getData();
+    square.transposeInPlace();
+    EXPECT_EQ(square.getData(), buffer);
+    EXPECT_TRUE(square == expectedSquare);
+
+    rectangle.transposeInPlace();
+    ASSERT_EQ(rectangle.getRows(), 70u);
+    ASSERT_EQ(rectangle.getCols(), 13u);
+    EXPECT_EQ(rectangle.getValue(69, 12), valueAt(12, 69));
+    // Хвост строки остаётся нулевым
+    EXPECT_EQ(rectangle.getData()[rectangle.getRowStride() - 1], 0.0);
+}
+
+TEST(TransposeTest, TransposedViewCopyUsesBlockedKernel) {
+    RealMatrix m(37, 90);
+    for (std::size_t i = 0; i < 37; ++i) {
+        for (std::size_t j = 0; j < 90; ++j) {
+            m.setValue(i, j, valueAt(i, j));
+        }
+    }
+
+    RealMatrix copy = m.transposedView();
+    EXPECT_TRUE(copy == m.computeTranspose());
+
+    RealMatrix target(90, 37);
+    target.transposedView() = m;
+    EXPECT_TRUE(target.transposedView() == m);
+}